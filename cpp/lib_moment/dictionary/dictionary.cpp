@@ -8,6 +8,10 @@
 
 #include "symbolic/symbol_table.h"
 
+#include "scenarios/context.h"
+
+#include "utilities/memory_footprint.h"
+
 #include <atomic>
 #include <ranges>
 #include <stdexcept>
@@ -38,11 +42,16 @@ namespace Moment {
         read_lock.unlock();
 
         // Create new OSG
-        auto new_osg = this->context.new_osg(npa_level);
+        std::unique_ptr<OperatorSequenceGenerator> new_osg;
         std::unique_ptr<OperatorSequenceGenerator> conj_osg;
-        if (this->context.can_be_nonhermitian()) {
-            conj_osg = new_osg->conjugate();
+        {
+            Instrumentation::ScopedPhase timer{this->context.instrumentation(), Instrumentation::Phase::OSGGeneration};
+            new_osg = this->context.new_osg(npa_level);
+            if (this->context.can_be_nonhermitian()) {
+                conj_osg = new_osg->conjugate();
+            }
         }
+        Instrumentation::count(this->context.instrumentation(), Instrumentation::Counter::OSGWords, new_osg->size());
 
         // Get exclusive access lock
         auto write_lock = const_cast<Dictionary*>(this)->get_write_lock();
@@ -71,4 +80,16 @@ namespace Moment {
         return pair().size();
     }
 
+    size_t Dictionary::memory_footprint() const {
+        auto read_lock = this->get_read_lock();
+        size_t total = Memory::container_bytes(this->osgs) + Memory::container_bytes(this->npa_level_to_offset);
+        for (const auto& osg_pair : this->osgs) {
+            total += osg_pair().memory_footprint();
+            if (!osg_pair.self_adjoint()) {
+                total += osg_pair.conjugate().memory_footprint();
+            }
+        }
+        return total;
+    }
+
 }
\ No newline at end of file
@@ -75,5 +75,10 @@ namespace Moment {
             return this->osgs.size();
         }
 
+        /**
+         * Approximate bytes used by all generated operator sequences.
+         */
+        [[nodiscard]] virtual size_t memory_footprint() const;
+
     };
 }
\ No newline at end of file
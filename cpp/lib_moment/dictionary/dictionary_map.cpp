@@ -12,6 +12,8 @@
 
 #include "symbolic/symbol_table.h"
 
+#include "utilities/memory_footprint.h"
+
 #include <ranges>
 #include <sstream>
 
@@ -73,4 +75,9 @@ namespace Moment {
         }
         return {val, false};
     }
-}
\ No newline at end of file
+
+    size_t DictionaryMap::memory_footprint() const {
+        std::shared_lock read_lock = this->get_read_lock();
+        return Memory::container_bytes(this->symbol_map);
+    }
+}
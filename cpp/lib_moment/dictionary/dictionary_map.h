@@ -61,6 +61,11 @@ namespace Moment {
          * @return Pair, first: symbol id, second: true if symbol is conjugated.
          */
         std::pair<symbol_name_t, bool> operator()(size_t index) const;
+
+        /**
+         * Approximate bytes used by map.
+         */
+        [[nodiscard]] size_t memory_footprint() const;
     };
 
 }
\ No newline at end of file
@@ -65,7 +65,7 @@ namespace Moment {
          * @param context Associated context.
          * @param sign_type Whether to interpret the sequence with +1, +i, -1, -i in front of it.
          */
-         OperatorSequence(const ConstructRawFlag&, sequence_storage_t operators, uint64_t hash,
+         OperatorSequence(const ConstructRawFlag&, sequence_storage_t operators, hash_t hash,
                           const Context& context, SequenceSignType sign_type = SequenceSignType::Positive) noexcept
               : HashedSequence{std::move(operators), hash, sign_type}, context{&context} {
              // No simplification, or check-sum of hash!
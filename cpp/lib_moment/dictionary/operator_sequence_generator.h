@@ -9,6 +9,8 @@
 #include "operator_sequence.h"
 #include "scenarios/context.h"
 
+#include "utilities/memory_footprint.h"
+
 namespace Moment {
     /**
      * Range over all unique permutations of operators in the supplied context.
@@ -77,5 +79,10 @@ namespace Moment {
             assert(index < unique_sequences.size());
             return this->unique_sequences[index];
         };
+
+        /** Approximate bytes used by generator and its sequences. */
+        [[nodiscard]] size_t memory_footprint() const noexcept {
+            return sizeof(OperatorSequenceGenerator) + Memory::deep_container_bytes(this->unique_sequences);
+        }
     };
 }
\ No newline at end of file
@@ -0,0 +1,79 @@
+/**
+ * buffered_writer.cpp
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+
+#include "buffered_writer.h"
+
+#include <array>
+#include <cassert>
+#include <charconv>
+#include <ostream>
+
+namespace Moment {
+
+    void append_number(std::string& output, const double value) {
+        std::array<char, 32> digits; // NOLINT(*-pro-type-member-init)
+        const auto result = std::to_chars(digits.data(), digits.data() + digits.size(), value);
+        assert(result.ec == std::errc{});
+        output.append(digits.data(), result.ptr);
+    }
+
+    void append_number(std::string& output, const size_t value) {
+        std::array<char, 24> digits; // NOLINT(*-pro-type-member-init)
+        const auto result = std::to_chars(digits.data(), digits.data() + digits.size(), value);
+        assert(result.ec == std::errc{});
+        output.append(digits.data(), result.ptr);
+    }
+
+    BufferedWriter::BufferedWriter(std::ostream& output, const size_t capacity)
+        : output{output}, capacity{capacity > 0 ? capacity : 1} {
+        this->buffer.reserve(this->capacity);
+    }
+
+    BufferedWriter::~BufferedWriter() noexcept {
+        try {
+            this->flush();
+        } catch (...) {
+            // Destructor must not throw; explicit flush() reports errors.
+        }
+    }
+
+    BufferedWriter& BufferedWriter::operator<<(const std::string_view text) {
+        this->buffer.append(text);
+        this->flush_if_full();
+        return *this;
+    }
+
+    BufferedWriter& BufferedWriter::operator<<(const char c) {
+        this->buffer.push_back(c);
+        this->flush_if_full();
+        return *this;
+    }
+
+    BufferedWriter& BufferedWriter::operator<<(const double value) {
+        append_number(this->buffer, value);
+        this->flush_if_full();
+        return *this;
+    }
+
+    BufferedWriter& BufferedWriter::operator<<(const size_t value) {
+        append_number(this->buffer, value);
+        this->flush_if_full();
+        return *this;
+    }
+
+    void BufferedWriter::flush() {
+        if (this->buffer.empty()) {
+            return;
+        }
+        this->output.write(this->buffer.data(), static_cast<std::streamsize>(this->buffer.size()));
+        if (!this->output) {
+            throw std::ios_base::failure{"Could not write to output stream."};
+        }
+        this->flushed_bytes += this->buffer.size();
+        this->buffer.clear();
+    }
+}
@@ -0,0 +1,75 @@
+/**
+ * buffered_writer.h
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+namespace Moment {
+
+    /**
+     * Append shortest round-trip decimal representation of a floating point number to a string.
+     */
+    void append_number(std::string& output, double value);
+
+    /**
+     * Append decimal representation of an unsigned integer to a string.
+     */
+    void append_number(std::string& output, size_t value);
+
+    /**
+     * Accumulates text in memory, and passes it to an output stream in large chunks.
+     */
+    class BufferedWriter {
+    public:
+        /** Default number of bytes to accumulate before writing to the stream. */
+        constexpr static const size_t default_capacity = 1ULL << 20; // 1 MiB
+
+    private:
+        std::ostream& output;
+        std::string buffer;
+        size_t capacity;
+        size_t flushed_bytes = 0;
+
+    public:
+        explicit BufferedWriter(std::ostream& output, size_t capacity = default_capacity);
+
+        BufferedWriter(const BufferedWriter&) = delete;
+
+        /** Flushes remaining text; errors at this point are not reported, so call flush() explicitly first. */
+        ~BufferedWriter() noexcept;
+
+        BufferedWriter& operator<<(std::string_view text);
+
+        BufferedWriter& operator<<(char c);
+
+        BufferedWriter& operator<<(double value);
+
+        BufferedWriter& operator<<(size_t value);
+
+        /**
+         * Write accumulated text to the output stream.
+         * @throws std::ios_base::failure If the stream could not be written to.
+         */
+        void flush();
+
+        /** Total number of bytes passed to writer so far. */
+        [[nodiscard]] size_t bytes_written() const noexcept {
+            return this->flushed_bytes + this->buffer.size();
+        }
+
+    private:
+        void flush_if_full() {
+            if (this->buffer.size() >= this->capacity) {
+                this->flush();
+            }
+        }
+    };
+}
@@ -0,0 +1,116 @@
+/**
+ * cbf_exporter.cpp
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+
+#include "cbf_exporter.h"
+
+#include "matrix/symbolic_matrix.h"
+
+#include <algorithm>
+
+namespace Moment {
+
+    namespace {
+        /** Append " row col value", with (row, col) transposed into the lower triangle. */
+        void append_lower_entry(std::string& text, const ExportEntry& entry) {
+            text.push_back(' ');
+            append_number(text, entry.col);
+            text.push_back(' ');
+            append_number(text, entry.row);
+            text.push_back(' ');
+            append_number(text, entry.value);
+            text.push_back('\n');
+        }
+    }
+
+    void CBFExporter::do_write(BufferedWriter& output, const std::span<const SymbolicMatrix* const> blocks,
+                               const std::vector<double>& objective) const {
+        const size_t variables = this->variable_count();
+
+        output << "# Moment: " << blocks.size() << " semidefinite block(s)\n";
+        output << "VER\n3\n\n";
+        output << "OBJSENSE\nMIN\n\n";
+        output << "VAR\n" << variables << (variables > 0 ? " 1\n" : " 0\n");
+        if (variables > 0) {
+            output << "F " << variables << '\n';
+        }
+        output << '\n';
+
+        const auto nonzero_objective = static_cast<size_t>(std::count_if(objective.cbegin(), objective.cend(),
+                                                                         [](double c) { return c != 0.0; }));
+        if (nonzero_objective > 0) {
+            output << "OBJACOORD\n" << nonzero_objective << '\n';
+            for (size_t variable = 0; variable < objective.size(); ++variable) {
+                if (objective[variable] != 0.0) {
+                    output << variable << ' ' << objective[variable] << '\n';
+                }
+            }
+            output << '\n';
+        }
+
+        output << "PSDCON\n" << blocks.size() << '\n';
+        for (const auto* block : blocks) {
+            output << block_dimension(*block) << '\n';
+        }
+        output << '\n';
+
+        // First pass: count variable entries, and keep constant entries.
+        std::vector<size_t> variable_entry_counts(blocks.size(), 0);
+        std::vector<std::string> constant_text(blocks.size());
+        std::vector<size_t> constant_entry_counts(blocks.size(), 0);
+        size_t total_constant_entries = 0;
+        this->format_blocks(blocks,
+            [&](const size_t block_index, const SymbolicMatrix& matrix) {
+                std::string text;
+                for (const auto& entry : this->block_entries(matrix)) {
+                    if (entry.variable == 0) {
+                        append_number(text, block_index);
+                        append_lower_entry(text, entry);
+                        ++constant_entry_counts[block_index];
+                    } else {
+                        ++variable_entry_counts[block_index];
+                    }
+                }
+                return text;
+            },
+            [&](const size_t block_index, std::string&& text) {
+                constant_text[block_index] = std::move(text);
+                total_constant_entries += constant_entry_counts[block_index];
+            });
+
+        size_t total_variable_entries = 0;
+        for (const auto count : variable_entry_counts) {
+            total_variable_entries += count;
+        }
+
+        // Second pass: stream variable entries.
+        if (total_variable_entries > 0) {
+            output << "HCOORD\n" << total_variable_entries << '\n';
+            this->format_blocks(output, blocks, [this](const size_t block_index, const SymbolicMatrix& matrix) {
+                std::string text;
+                for (const auto& entry : this->block_entries(matrix)) {
+                    if (entry.variable == 0) {
+                        continue;
+                    }
+                    append_number(text, block_index);
+                    text.push_back(' ');
+                    append_number(text, entry.variable - 1);
+                    append_lower_entry(text, entry);
+                }
+                return text;
+            });
+            output << '\n';
+        }
+
+        if (total_constant_entries > 0) {
+            output << "DCOORD\n" << total_constant_entries << '\n';
+            for (const auto& text : constant_text) {
+                output << std::string_view{text};
+            }
+            output << '\n';
+        }
+    }
+}
@@ -0,0 +1,32 @@
+/**
+ * cbf_exporter.h
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+
+#pragma once
+
+#include "solver_exporter.h"
+
+namespace Moment {
+
+    /**
+     * Writes matrices in the Conic Benchmark Format (.cbf), version 3.
+     *
+     * The problem written is: minimize c.x over free variables x, subject to sum_j F_j x_j + G being positive
+     * semidefinite, with one PSD constraint per exported matrix. Entries are written 0-indexed, in the lower triangle.
+     * As CBF requires entry counts before entries, blocks are formatted twice: the first pass counts the variable
+     * entries (HCOORD) and keeps the (sparse) constant entries (DCOORD); the second pass streams the variable entries.
+     */
+    class CBFExporter : public SolverExporter {
+    public:
+        explicit CBFExporter(const MatrixSystem& system,
+                             Multithreading::MultiThreadPolicy policy = Multithreading::MultiThreadPolicy::Optional)
+            : SolverExporter{system, policy} { }
+
+    protected:
+        void do_write(BufferedWriter& output, std::span<const SymbolicMatrix* const> blocks,
+                      const std::vector<double>& objective) const override;
+    };
+}
@@ -0,0 +1,53 @@
+/**
+ * sdpa_exporter.cpp
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+
+#include "sdpa_exporter.h"
+
+#include "matrix/symbolic_matrix.h"
+
+namespace Moment {
+
+    void SDPAExporter::do_write(BufferedWriter& output, const std::span<const SymbolicMatrix* const> blocks,
+                                const std::vector<double>& objective) const {
+        output << "\"Moment: " << blocks.size() << " semidefinite block(s)\"\n";
+        output << this->variable_count() << " = mDIM\n";
+        output << blocks.size() << " = nBLOCK\n";
+        for (size_t block_index = 0; block_index < blocks.size(); ++block_index) {
+            if (block_index != 0) {
+                output << ' ';
+            }
+            output << block_dimension(*blocks[block_index]);
+        }
+        output << " = bLOCKsTRUCT\n";
+
+        for (size_t variable = 0; variable < objective.size(); ++variable) {
+            if (variable != 0) {
+                output << ' ';
+            }
+            output << objective[variable];
+        }
+        output << '\n';
+
+        // Lines are "matrix block row col value", 1-indexed, upper triangle; F_0 = -(constant part of block).
+        this->format_blocks(output, blocks, [this](const size_t block_index, const SymbolicMatrix& matrix) {
+            std::string text;
+            for (const auto& entry : this->block_entries(matrix)) {
+                append_number(text, entry.variable);
+                text.push_back(' ');
+                append_number(text, block_index + 1);
+                text.push_back(' ');
+                append_number(text, entry.row + 1);
+                text.push_back(' ');
+                append_number(text, entry.col + 1);
+                text.push_back(' ');
+                append_number(text, entry.variable == 0 ? -entry.value : entry.value);
+                text.push_back('\n');
+            }
+            return text;
+        });
+    }
+}
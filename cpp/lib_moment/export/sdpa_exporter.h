@@ -0,0 +1,31 @@
+/**
+ * sdpa_exporter.h
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+
+#pragma once
+
+#include "solver_exporter.h"
+
+namespace Moment {
+
+    /**
+     * Writes matrices in SDPA sparse format (.dat-s).
+     *
+     * The problem written is: minimize c.x subject to X = sum_i F_i x_i - F_0 being positive semidefinite, with one
+     * diagonal block per exported matrix. As entries may appear in any order, each block is written as soon as it has
+     * been formatted.
+     */
+    class SDPAExporter : public SolverExporter {
+    public:
+        explicit SDPAExporter(const MatrixSystem& system,
+                              Multithreading::MultiThreadPolicy policy = Multithreading::MultiThreadPolicy::Optional)
+            : SolverExporter{system, policy} { }
+
+    protected:
+        void do_write(BufferedWriter& output, std::span<const SymbolicMatrix* const> blocks,
+                      const std::vector<double>& objective) const override;
+    };
+}
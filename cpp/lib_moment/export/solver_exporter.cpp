@@ -0,0 +1,302 @@
+/**
+ * solver_exporter.cpp
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+
+#include "solver_exporter.h"
+
+#include "matrix/monomial_matrix.h"
+#include "matrix/polynomial_matrix.h"
+#include "matrix_system/matrix_system.h"
+#include "symbolic/polynomial.h"
+#include "symbolic/polynomial_factory.h"
+#include "symbolic/symbol_table.h"
+#include "utilities/float_utils.h"
+
+#include <algorithm>
+#include <cassert>
+#include <exception>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+namespace Moment {
+
+    namespace {
+        using term_list_t = std::vector<std::pair<size_t, double>>;
+
+        /**
+         * Accumulates the terms of one matrix element, and emits them as block entries.
+         */
+        class ElementEntryBuilder {
+        private:
+            const SymbolTable& symbols;
+            const size_t real_basis_count;
+            const double zero_tolerance;
+            const size_t dimension;
+            const bool embed;
+            std::vector<ExportEntry>& output;
+
+            term_list_t real_terms;
+            term_list_t imaginary_terms;
+
+        public:
+            ElementEntryBuilder(const SymbolTable& symbols, const double zero_tolerance,
+                                const SymbolicMatrix& matrix, std::vector<ExportEntry>& output)
+                : symbols{symbols}, real_basis_count{symbols.Basis.RealSymbolCount()},
+                  zero_tolerance{zero_tolerance}, dimension{matrix.Dimension()},
+                  embed{matrix.HasComplexBasis() || matrix.HasComplexCoefficients()}, output{output} { }
+
+            /** Add c (a + i s b) to element, where s = -1 if conjugated. */
+            void add(const Monomial& mono) {
+                if (mono.id <= 0) {
+                    return;
+                }
+                const auto [re_key, im_key] = this->symbols.Basis(mono.id);
+                const double sign = mono.conjugated ? -1.0 : 1.0;
+                if (re_key >= 0) {
+                    const auto variable = static_cast<size_t>(re_key);
+                    this->real_terms.emplace_back(variable, mono.factor.real());
+                    this->imaginary_terms.emplace_back(variable, mono.factor.imag());
+                }
+                if (im_key >= 0) {
+                    const size_t variable = this->real_basis_count + static_cast<size_t>(im_key);
+                    this->real_terms.emplace_back(variable, -sign * mono.factor.imag());
+                    this->imaginary_terms.emplace_back(variable, sign * mono.factor.real());
+                }
+            }
+
+            /** Write entries for element at (row, col), with row <= col, and reset. */
+            void emit(const size_t row, const size_t col) {
+                assert(row <= col);
+                this->consolidate(this->real_terms);
+                for (const auto& [variable, value] : this->real_terms) {
+                    this->output.emplace_back(ExportEntry{variable, row, col, value});
+                }
+
+                if (this->embed) {
+                    for (const auto& [variable, value] : this->real_terms) {
+                        this->output.emplace_back(ExportEntry{variable, this->dimension + row,
+                                                              this->dimension + col, value});
+                    }
+
+                    // Upper-right block is -Im M; as M is Hermitian, Im M is antisymmetric.
+                    this->consolidate(this->imaginary_terms);
+                    for (const auto& [variable, value] : this->imaginary_terms) {
+                        this->output.emplace_back(ExportEntry{variable, row, this->dimension + col, -value});
+                    }
+                    if (row != col) {
+                        for (const auto& [variable, value] : this->imaginary_terms) {
+                            this->output.emplace_back(ExportEntry{variable, col, this->dimension + row, value});
+                        }
+                    }
+                }
+                this->real_terms.clear();
+                this->imaginary_terms.clear();
+            }
+
+        private:
+            /** Sort terms by variable, merge repeated variables, and remove zeros. */
+            void consolidate(term_list_t& terms) const {
+                if (terms.size() > 1) {
+                    std::sort(terms.begin(), terms.end(),
+                              [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+                    auto write_iter = terms.begin();
+                    for (auto read_iter = terms.begin() + 1; read_iter != terms.end(); ++read_iter) {
+                        if (read_iter->first == write_iter->first) {
+                            write_iter->second += read_iter->second;
+                        } else {
+                            ++write_iter;
+                            *write_iter = *read_iter;
+                        }
+                    }
+                    terms.erase(write_iter + 1, terms.end());
+                }
+                std::erase_if(terms, [this](const auto& term) {
+                    return approximately_zero(term.second, this->zero_tolerance);
+                });
+            }
+        };
+    }
+
+    SolverExporter::SolverExporter(const MatrixSystem& system, const Multithreading::MultiThreadPolicy policy)
+        : system{system}, symbols{system.Symbols()}, factory{system.polynomial_factory()}, mt_policy{policy} { }
+
+    size_t SolverExporter::variable_count() const noexcept {
+        const size_t real_count = this->symbols.Basis.RealSymbolCount();
+        return (real_count > 0 ? real_count - 1 : 0) + this->symbols.Basis.ImaginarySymbolCount();
+    }
+
+    size_t SolverExporter::block_dimension(const SymbolicMatrix& matrix) noexcept {
+        const bool embed = matrix.HasComplexBasis() || matrix.HasComplexCoefficients();
+        return embed ? 2 * matrix.Dimension() : matrix.Dimension();
+    }
+
+    std::vector<ExportEntry> SolverExporter::block_entries(const SymbolicMatrix& matrix) const {
+        if (!matrix.Hermitian()) {
+            std::stringstream errSS;
+            errSS << "Cannot export \"" << matrix.Description() << "\" as a semidefinite block, as it is not Hermitian.";
+            throw errors::bad_export{errSS.str()};
+        }
+
+        std::vector<ExportEntry> output;
+        ElementEntryBuilder builder{this->symbols, this->factory.zero_tolerance, matrix, output};
+        const size_t dimension = matrix.Dimension();
+
+        if (matrix.is_monomial()) {
+            const auto& mono_matrix = dynamic_cast<const MonomialMatrix&>(matrix);
+            output.reserve(dimension * (dimension + 1) / 2);
+            for (size_t col = 0; col < dimension; ++col) {
+                for (size_t row = 0; row <= col; ++row) {
+                    builder.add(mono_matrix.SymbolMatrix(row, col));
+                    builder.emit(row, col);
+                }
+            }
+        } else {
+            const auto& poly_matrix = dynamic_cast<const PolynomialMatrix&>(matrix);
+            for (size_t col = 0; col < dimension; ++col) {
+                for (size_t row = 0; row <= col; ++row) {
+                    for (const auto& mono : poly_matrix.SymbolMatrix(row, col)) {
+                        builder.add(mono);
+                    }
+                    builder.emit(row, col);
+                }
+            }
+        }
+        return output;
+    }
+
+    std::vector<double> SolverExporter::objective_coefficients(const Polynomial& objective) const {
+        const size_t real_count = this->symbols.Basis.RealSymbolCount();
+        std::vector<double> output(this->variable_count(), 0.0);
+        for (const auto& mono : objective) {
+            if ((mono.id <= 0) || (static_cast<size_t>(mono.id) >= this->symbols.size())) {
+                continue;
+            }
+            // Real part of c (a + i s b) is Re(c) a - s Im(c) b.
+            const auto [re_key, im_key] = this->symbols.Basis(mono.id);
+            if (re_key > 0) {
+                output[static_cast<size_t>(re_key) - 1] += mono.factor.real();
+            }
+            if (im_key >= 0) {
+                const double sign = mono.conjugated ? -1.0 : 1.0;
+                output[real_count + static_cast<size_t>(im_key) - 1] -= sign * mono.factor.imag();
+            }
+        }
+        return output;
+    }
+
+    void SolverExporter::write(std::ostream& os, const std::span<const ptrdiff_t> matrix_indices,
+                               const Polynomial& objective) const {
+        auto lock = this->system.get_read_lock();
+
+        std::vector<const SymbolicMatrix*> blocks;
+        blocks.reserve(matrix_indices.size());
+        for (const auto index : matrix_indices) {
+            const auto& matrix = this->system[index];
+            if (!matrix.Hermitian()) {
+                std::stringstream errSS;
+                errSS << "Cannot export matrix " << index << " as a semidefinite block, as it is not Hermitian.";
+                throw errors::bad_export{errSS.str()};
+            }
+            blocks.emplace_back(&matrix);
+        }
+
+        const auto objective_vector = this->objective_coefficients(objective);
+
+        try {
+            BufferedWriter output{os, this->buffer_capacity};
+            this->do_write(output, blocks, objective_vector);
+            output.flush();
+        } catch (const std::ios_base::failure& failure) {
+            throw errors::bad_export{failure.what()};
+        }
+    }
+
+    void SolverExporter::write(std::ostream& os, const std::span<const ptrdiff_t> matrix_indices) const {
+        this->write(os, matrix_indices, Polynomial{});
+    }
+
+    void SolverExporter::write_file(const std::filesystem::path& path, const std::span<const ptrdiff_t> matrix_indices,
+                                    const Polynomial& objective) const {
+        std::ofstream file{path, std::ios::out | std::ios::trunc};
+        if (!file) {
+            std::stringstream errSS;
+            errSS << "Could not open \"" << path.string() << "\" for writing.";
+            throw errors::bad_export{errSS.str()};
+        }
+        this->write(file, matrix_indices, objective);
+    }
+
+    void SolverExporter::write_file(const std::filesystem::path& path,
+                                    const std::span<const ptrdiff_t> matrix_indices) const {
+        this->write_file(path, matrix_indices, Polynomial{});
+    }
+
+    void SolverExporter::format_blocks(const std::span<const SymbolicMatrix* const> blocks,
+                                       const block_formatter_t& formatter, const block_sink_t& sink) const {
+        size_t total_elements = 0;
+        for (const auto* block : blocks) {
+            const size_t dimension = block_dimension(*block);
+            total_elements += dimension * dimension;
+        }
+
+        if ((blocks.size() < 2) || !Multithreading::should_multithread_export(this->mt_policy, total_elements)) {
+            for (size_t block_index = 0; block_index < blocks.size(); ++block_index) {
+                sink(block_index, formatter(block_index, *blocks[block_index]));
+            }
+            return;
+        }
+
+        // Format one batch of blocks in parallel, then pass on in order, so at most one batch is held in memory.
+        const size_t worker_count = std::min(Multithreading::get_max_worker_threads(), blocks.size());
+        std::vector<std::string> texts(worker_count);
+        std::vector<std::exception_ptr> errors(worker_count);
+        for (size_t batch_start = 0; batch_start < blocks.size(); batch_start += worker_count) {
+            const size_t batch_size = std::min(worker_count, blocks.size() - batch_start);
+            std::vector<std::thread> workers;
+            workers.reserve(batch_size);
+            try {
+                for (size_t worker_id = 0; worker_id < batch_size; ++worker_id) {
+                    workers.emplace_back([&, worker_id]() {
+                        try {
+                            const size_t block_index = batch_start + worker_id;
+                            texts[worker_id] = formatter(block_index, *blocks[block_index]);
+                        } catch (...) {
+                            errors[worker_id] = std::current_exception();
+                        }
+                    });
+                }
+            } catch (...) {
+                // Could not launch every worker: wait for those that did start, before propagating
+                for (auto& worker : workers) {
+                    worker.join();
+                }
+                throw;
+            }
+            for (auto& worker : workers) {
+                worker.join();
+            }
+
+            // Nothing from a failed batch is passed on
+            for (const auto& error : errors) {
+                if (error) {
+                    std::rethrow_exception(error);
+                }
+            }
+            for (size_t worker_id = 0; worker_id < batch_size; ++worker_id) {
+                sink(batch_start + worker_id, std::move(texts[worker_id]));
+                texts[worker_id].clear();
+            }
+        }
+    }
+
+    void SolverExporter::format_blocks(BufferedWriter& output, const std::span<const SymbolicMatrix* const> blocks,
+                                       const block_formatter_t& formatter) const {
+        this->format_blocks(blocks, formatter, [&output](size_t, std::string&& text) {
+            output << std::string_view{text};
+        });
+    }
+}
@@ -0,0 +1,158 @@
+/**
+ * solver_exporter.h
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+
+#pragma once
+
+#include "buffered_writer.h"
+
+#include "multithreading/multithreading.h"
+
+#include <filesystem>
+#include <functional>
+#include <iosfwd>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Moment {
+
+    class MatrixSystem;
+    class Polynomial;
+    class PolynomialFactory;
+    class SymbolicMatrix;
+    class SymbolTable;
+
+    namespace errors {
+        /**
+         * Error issued when matrices cannot be exported to a solver file.
+         */
+        class bad_export : public std::runtime_error {
+        public:
+            explicit bad_export(const std::string& what) : std::runtime_error{what} { }
+        };
+    }
+
+    /**
+     * Coefficient of one scalar variable in one upper-triangular entry of an exported block.
+     */
+    struct ExportEntry {
+        /** Variable index: 0 for the constant term, otherwise 1-based. */
+        size_t variable;
+        size_t row;
+        size_t col;
+        double value;
+    };
+
+    /**
+     * Base class for writing the positive-semidefinite constraints of a matrix system in a solver's file format.
+     *
+     * Each exported matrix becomes one block, M = F_0 + sum_i x_i F_i. The scalar variables are the real basis elements
+     * of the symbol table, other than the identity, followed by all imaginary basis elements, so that variable k (for
+     * 1 <= k < R) is the real basis element k, and variable R + k the imaginary basis element k. Matrices that may take
+     * complex values are written as their real embedding [[Re M, -Im M], [Im M, Re M]], of twice the dimension.
+     *
+     * Entries are generated directly from the symbolic matrices, one block at a time; no basis matrices are built.
+     */
+    class SolverExporter {
+    public:
+        /** Produces the text for one block. */
+        using block_formatter_t = std::function<std::string(size_t block_index, const SymbolicMatrix& matrix)>;
+
+        /** Consumes the text for one block; called in block order, from the calling thread. */
+        using block_sink_t = std::function<void(size_t block_index, std::string&& text)>;
+
+        const MatrixSystem& system;
+        const SymbolTable& symbols;
+        const PolynomialFactory& factory;
+
+        /** Whether blocks are formatted in parallel. */
+        const Multithreading::MultiThreadPolicy mt_policy;
+
+        /** Number of bytes accumulated before writing to output. */
+        size_t buffer_capacity = BufferedWriter::default_capacity;
+
+    protected:
+        SolverExporter(const MatrixSystem& system, Multithreading::MultiThreadPolicy policy);
+
+    public:
+        virtual ~SolverExporter() noexcept = default;
+
+        /**
+         * Write matrices as positive-semidefinite constraints to a stream. Acquires the system's read lock.
+         * @param os The output stream.
+         * @param matrix_indices Indices of the matrices in the system to export, one block each.
+         * @param objective Polynomial whose real part is minimized; constant terms are ignored.
+         * @throws errors::missing_component If a matrix index is invalid.
+         * @throws errors::bad_export If a matrix is not Hermitian, or the output could not be written.
+         */
+        void write(std::ostream& os, std::span<const ptrdiff_t> matrix_indices, const Polynomial& objective) const;
+
+        /**
+         * Write matrices as positive-semidefinite constraints, with zero objective, to a stream.
+         */
+        void write(std::ostream& os, std::span<const ptrdiff_t> matrix_indices) const;
+
+        /**
+         * Write matrices as positive-semidefinite constraints to a file.
+         * @throws errors::bad_export If the file cannot be opened.
+         */
+        void write_file(const std::filesystem::path& path, std::span<const ptrdiff_t> matrix_indices,
+                        const Polynomial& objective) const;
+
+        /**
+         * Write matrices as positive-semidefinite constraints, with zero objective, to a file.
+         */
+        void write_file(const std::filesystem::path& path, std::span<const ptrdiff_t> matrix_indices) const;
+
+        /**
+         * Number of scalar variables. For thread safety, call with the system's read lock held.
+         */
+        [[nodiscard]] size_t variable_count() const noexcept;
+
+        /**
+         * Dimension of the block a matrix is exported as: twice the matrix dimension, if it may take complex values.
+         */
+        [[nodiscard]] static size_t block_dimension(const SymbolicMatrix& matrix) noexcept;
+
+        /**
+         * Non-zero entries of the upper triangle of the block a matrix is exported as, element by element.
+         * Entries sharing a variable within an element are merged. For thread safety, call with the read lock held.
+         * @throws errors::bad_export If the matrix is not Hermitian.
+         */
+        [[nodiscard]] std::vector<ExportEntry> block_entries(const SymbolicMatrix& matrix) const;
+
+        /**
+         * Dense vector of objective coefficients, for variables 1 to variable_count().
+         */
+        [[nodiscard]] std::vector<double> objective_coefficients(const Polynomial& objective) const;
+
+    protected:
+        /**
+         * Write the file contents.
+         * @param output The buffered output.
+         * @param blocks The matrices to export, in block order.
+         * @param objective Dense objective coefficients, as from objective_coefficients().
+         */
+        virtual void do_write(BufferedWriter& output, std::span<const SymbolicMatrix* const> blocks,
+                              const std::vector<double>& objective) const = 0;
+
+        /**
+         * Format every block, and pass the results to the sink in block order.
+         * Depending on the multithreading policy and total size, blocks are formatted in parallel batches.
+         */
+        void format_blocks(std::span<const SymbolicMatrix* const> blocks,
+                           const block_formatter_t& formatter, const block_sink_t& sink) const;
+
+        /**
+         * Format every block, and write the results to the output in block order.
+         */
+        void format_blocks(BufferedWriter& output, std::span<const SymbolicMatrix* const> blocks,
+                           const block_formatter_t& formatter) const;
+    };
+}
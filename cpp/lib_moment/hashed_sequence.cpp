@@ -79,7 +79,7 @@ namespace Moment {
                 os << "X" << o;
             }
         }
-        os << " [" << seq.the_hash << "]";
+        os << " [" << hash_to_string(seq.the_hash) << "]";
         return os;
     }
 
@@ -69,7 +69,7 @@ namespace Moment {
          * @param hash The calculated hash of the sequence.
          * @param is_negated True if the sequence should be interpreted with a minus sign in front of it.
          */
-        HashedSequence(sequence_storage_t oper_ids, const uint64_t hash,
+        HashedSequence(sequence_storage_t oper_ids, const hash_t hash,
                        SequenceSignType sign_type = SequenceSignType::Positive)
                 : the_hash{hash}, operators{std::move(oper_ids)}, sign{sign_type} { }
 
@@ -171,6 +171,9 @@ namespace Moment {
         /** The length of the operator string */
         [[nodiscard]] constexpr size_t size() const noexcept { return this->operators.size(); }
 
+        /** Bytes of heap memory owned by the operator string (zero for short strings). */
+        [[nodiscard]] constexpr size_t heap_bytes() const noexcept { return this->operators.heap_bytes(); }
+
         /** Operator at index N */
         [[nodiscard]] oper_name_t operator[](size_t index) const noexcept {
             assert(index < this->operators.size());
@@ -188,13 +191,34 @@ namespace Moment {
             return this->operators;
         }
 
+        /**
+         * Concatenate two sequences, composing the hash from the hashes of each part.
+         * The result is only canonical if the concatenation requires no further simplification.
+         * @param lhs The prefix sequence.
+         * @param rhs The suffix sequence.
+         * @param hasher The hasher that produced the hashes of lhs and rhs.
+         * @return The sequence 'lhs rhs', with the product of the signs of lhs and rhs.
+         */
+        [[nodiscard]] static HashedSequence concatenate(const HashedSequence& lhs, const HashedSequence& rhs,
+                                                        const ShortlexHasher& hasher) {
+            if (lhs.zero() || rhs.zero()) [[unlikely]] {
+                return HashedSequence{true};
+            }
+            sequence_storage_t joined;
+            joined.reserve(lhs.size() + rhs.size());
+            joined.insert(joined.end(), lhs.operators.begin(), lhs.operators.end());
+            joined.insert(joined.end(), rhs.operators.begin(), rhs.operators.end());
+            return HashedSequence{std::move(joined), hasher.concatenate(lhs.the_hash, rhs.the_hash, rhs.size()),
+                                  lhs.sign * rhs.sign};
+        }
+
         /** Recalculate sequence's hash  (only required after raw access write or re-contextualizing sequence) */
         inline void rehash(const ShortlexHasher& hasher) {
             this->the_hash = hasher(this->operators);
         }
 
         /** Manually reset sequence's hash (only required after raw access write or re-contextualizing sequence). */
-        inline void rehash(const uint64_t hash) {
+        inline void rehash(const hash_t hash) {
             this->the_hash = hash;
         }
 
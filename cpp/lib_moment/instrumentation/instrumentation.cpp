@@ -0,0 +1,178 @@
+/**
+ * instrumentation.cpp
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+
+#include "instrumentation.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <iomanip>
+#include <ostream>
+
+namespace Moment::Instrumentation {
+
+    namespace {
+        /** Small integer labelling the calling thread, assigned on first use. */
+        size_t current_thread_index() noexcept {
+            static std::atomic<size_t> next_index{0};
+            thread_local const size_t index = next_index.fetch_add(1, std::memory_order_relaxed);
+            return index;
+        }
+
+        /** Write nanoseconds as microseconds, with three decimal places. */
+        void write_microseconds(std::ostream& os, const std::chrono::nanoseconds time) {
+            const auto ns = static_cast<uint64_t>(time.count() > 0 ? time.count() : 0);
+            std::array<char, 32> buffer; // NOLINT(*-pro-type-member-init)
+            std::snprintf(buffer.data(), buffer.size(), "%" PRIu64 ".%03" PRIu64, ns / 1000, ns % 1000);
+            os << buffer.data();
+        }
+    }
+
+    std::string_view phase_name(const Phase phase) noexcept {
+        switch (phase) {
+            case Phase::OSGGeneration:
+                return "OSG generation";
+            case Phase::OSMGeneration:
+                return "Operator matrix generation";
+            case Phase::AliasGeneration:
+                return "Alias generation";
+            case Phase::SymbolIdentification:
+                return "Symbol identification";
+            case Phase::SymbolMerge:
+                return "Symbol table merge";
+            case Phase::BasisCreation:
+                return "Basis creation";
+            case Phase::RulebookCompletion:
+                return "Rulebook completion";
+        }
+        return "Unknown phase";
+    }
+
+    std::string_view counter_name(const Counter counter) noexcept {
+        switch (counter) {
+            case Counter::OSGWords:
+                return "OSG words";
+            case Counter::OSMElements:
+                return "Operator matrix elements";
+            case Counter::AliasedElements:
+                return "Aliased matrix elements";
+            case Counter::SymbolsOffered:
+                return "Symbols offered";
+            case Counter::SymbolsAdded:
+                return "Symbols added";
+            case Counter::RuleReductions:
+                return "Rule reductions";
+            case Counter::RulesAdded:
+                return "Rules added";
+        }
+        return "Unknown counter";
+    }
+
+    Recorder::Recorder(const size_t event_limit) : event_limit{event_limit}, epoch{clock_t::now()} { }
+
+    void Recorder::record(const Phase phase, const clock_t::time_point start, const clock_t::time_point end) {
+        const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        const auto phase_index = static_cast<size_t>(phase);
+        this->phase_calls[phase_index].fetch_add(1, std::memory_order_relaxed);
+        this->phase_nanoseconds[phase_index].fetch_add(static_cast<uint64_t>(duration.count()),
+                                                       std::memory_order_relaxed);
+
+        std::lock_guard lock{this->event_mutex};
+        if (this->event_list.size() >= this->event_limit) {
+            ++this->dropped;
+            return;
+        }
+        this->event_list.emplace_back(PhaseEvent{phase, current_thread_index(),
+                                                 std::chrono::duration_cast<std::chrono::nanoseconds>(start - epoch),
+                                                 duration});
+    }
+
+    PhaseSummary Recorder::summary(const Phase phase) const noexcept {
+        const auto phase_index = static_cast<size_t>(phase);
+        return PhaseSummary{this->phase_calls[phase_index].load(std::memory_order_relaxed),
+                            std::chrono::nanoseconds{static_cast<std::chrono::nanoseconds::rep>(
+                                    this->phase_nanoseconds[phase_index].load(std::memory_order_relaxed))}};
+    }
+
+    std::vector<PhaseEvent> Recorder::events() const {
+        std::lock_guard lock{this->event_mutex};
+        return this->event_list;
+    }
+
+    size_t Recorder::dropped_events() const {
+        std::lock_guard lock{this->event_mutex};
+        return this->dropped;
+    }
+
+    void Recorder::reset() {
+        std::lock_guard lock{this->event_mutex};
+        for (auto& calls : this->phase_calls) {
+            calls.store(0, std::memory_order_relaxed);
+        }
+        for (auto& nanoseconds : this->phase_nanoseconds) {
+            nanoseconds.store(0, std::memory_order_relaxed);
+        }
+        for (auto& counter : this->counters) {
+            counter.store(0, std::memory_order_relaxed);
+        }
+        this->event_list.clear();
+        this->dropped = 0;
+        this->epoch = clock_t::now();
+    }
+
+    void Recorder::write_chrome_trace(std::ostream& os) const {
+        std::lock_guard lock{this->event_mutex};
+
+        os << "{\"traceEvents\":[";
+        std::chrono::nanoseconds last_time{0};
+        bool first = true;
+        for (const auto& event : this->event_list) {
+            os << (first ? "\n" : ",\n");
+            first = false;
+            os << "{\"name\":\"" << phase_name(event.phase) << "\",\"cat\":\"moment\",\"ph\":\"X\",\"ts\":";
+            write_microseconds(os, event.start);
+            os << ",\"dur\":";
+            write_microseconds(os, event.duration);
+            os << ",\"pid\":1,\"tid\":" << event.thread << "}";
+            last_time = std::max(last_time, event.start + event.duration);
+        }
+
+        // Final counter values, as one counter event at the end of the trace.
+        os << (first ? "\n" : ",\n") << "{\"name\":\"Counters\",\"cat\":\"moment\",\"ph\":\"C\",\"ts\":";
+        write_microseconds(os, last_time);
+        os << ",\"pid\":1,\"tid\":0,\"args\":{";
+        for (size_t counter_index = 0; counter_index < counter_count; ++counter_index) {
+            if (counter_index != 0) {
+                os << ",";
+            }
+            os << "\"" << counter_name(static_cast<Counter>(counter_index)) << "\":"
+               << this->counters[counter_index].load(std::memory_order_relaxed);
+        }
+        os << "}}\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"droppedEvents\":" << this->dropped << "}}\n";
+    }
+
+    std::ostream& operator<<(std::ostream& os, const Recorder& recorder) {
+        const auto old_flags = os.flags();
+        const auto old_precision = os.precision();
+        os << std::fixed << std::setprecision(3);
+        for (size_t phase_index = 0; phase_index < phase_count; ++phase_index) {
+            const auto phase = static_cast<Phase>(phase_index);
+            const auto phase_summary = recorder.summary(phase);
+            const std::chrono::duration<double, std::milli> total = phase_summary.total;
+            os << std::left << std::setw(28) << phase_name(phase) << std::right
+               << std::setw(12) << total.count() << " ms in " << phase_summary.calls << " call(s)\n";
+        }
+        for (size_t counter_index = 0; counter_index < counter_count; ++counter_index) {
+            const auto counter = static_cast<Counter>(counter_index);
+            os << std::left << std::setw(28) << counter_name(counter) << std::right
+               << std::setw(12) << recorder.count(counter) << "\n";
+        }
+        os.flags(old_flags);
+        os.precision(old_precision);
+        return os;
+    }
+}
@@ -0,0 +1,198 @@
+/**
+ * instrumentation.h
+ *
+ * Lightweight timers and counters for the expensive phases of matrix system construction.
+ * Recording in the library's hot paths is only compiled in if MOMENT_INSTRUMENTATION is defined (CMake option
+ * MOMENT_INSTRUMENTATION); otherwise scoped timers and counters are empty, and optimized away.
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace Moment::Instrumentation {
+
+#ifdef MOMENT_INSTRUMENTATION
+    /** True: library phases are timed and counted. */
+    constexpr const bool enabled = true;
+#else
+    /** False: library phases are not timed or counted. */
+    constexpr const bool enabled = false;
+#endif
+
+    /** Timed phases. */
+    enum class Phase : uint8_t {
+        /** Generation of operator sequences for a dictionary. */
+        OSGGeneration,
+        /** Generation of operator sequence matrices. */
+        OSMGeneration,
+        /** Generation of aliased operator sequence matrices. */
+        AliasGeneration,
+        /** Identification of symbols in operator sequence matrices. */
+        SymbolIdentification,
+        /** Merging of symbols into symbol table. */
+        SymbolMerge,
+        /** Construction of matrix bases. */
+        BasisCreation,
+        /** Completion of moment rulebooks. */
+        RulebookCompletion
+    };
+
+    /** Number of distinct phases. */
+    constexpr const size_t phase_count = 7;
+
+    /** Counted quantities. */
+    enum class Counter : uint8_t {
+        /** Operator sequences generated for dictionaries. */
+        OSGWords,
+        /** Elements of operator sequence matrices generated. */
+        OSMElements,
+        /** Elements of aliased operator sequence matrices generated. */
+        AliasedElements,
+        /** Symbols offered to the symbol table for merging. */
+        SymbolsOffered,
+        /** Symbols newly added to the symbol table. */
+        SymbolsAdded,
+        /** Monomials and polynomials rewritten by moment rules. */
+        RuleReductions,
+        /** Rules added to rulebooks by completion. */
+        RulesAdded
+    };
+
+    /** Number of distinct counters. */
+    constexpr const size_t counter_count = 7;
+
+    /** Human-readable name of phase. */
+    [[nodiscard]] std::string_view phase_name(Phase phase) noexcept;
+
+    /** Human-readable name of counter. */
+    [[nodiscard]] std::string_view counter_name(Counter counter) noexcept;
+
+    /** One timed execution of a phase. */
+    struct PhaseEvent {
+        Phase phase;
+        /** Small integer identifying the thread that executed the phase. */
+        size_t thread;
+        /** Start time, relative to the recorder's epoch. */
+        std::chrono::nanoseconds start;
+        std::chrono::nanoseconds duration;
+    };
+
+    /** Accumulated timing of one phase. */
+    struct PhaseSummary {
+        uint64_t calls = 0;
+        std::chrono::nanoseconds total{0};
+    };
+
+    /**
+     * Thread-safe store of phase timings and counters, e.g. for one matrix system.
+     * Summaries and counters are always kept; individual events are kept up to a limit, for trace export.
+     */
+    class Recorder {
+    public:
+        using clock_t = std::chrono::steady_clock;
+
+        /** Default maximum number of individual events retained. */
+        constexpr static const size_t default_event_limit = 65536;
+
+        /** Maximum number of individual events retained. */
+        const size_t event_limit;
+
+    private:
+        clock_t::time_point epoch;
+
+        std::array<std::atomic<uint64_t>, phase_count> phase_calls{};
+        std::array<std::atomic<uint64_t>, phase_count> phase_nanoseconds{};
+        std::array<std::atomic<uint64_t>, counter_count> counters{};
+
+        mutable std::mutex event_mutex;
+        std::vector<PhaseEvent> event_list;
+        size_t dropped = 0;
+
+    public:
+        explicit Recorder(size_t event_limit = default_event_limit);
+
+        Recorder(const Recorder&) = delete;
+
+        /** Record execution of a phase. */
+        void record(Phase phase, clock_t::time_point start, clock_t::time_point end);
+
+        /** Add to counter. */
+        void add(Counter counter, uint64_t amount = 1) noexcept {
+            this->counters[static_cast<size_t>(counter)].fetch_add(amount, std::memory_order_relaxed);
+        }
+
+        /** Accumulated timing of phase. */
+        [[nodiscard]] PhaseSummary summary(Phase phase) const noexcept;
+
+        /** Value of counter. */
+        [[nodiscard]] uint64_t count(Counter counter) const noexcept {
+            return this->counters[static_cast<size_t>(counter)].load(std::memory_order_relaxed);
+        }
+
+        /** Copy of retained events, in order of completion. */
+        [[nodiscard]] std::vector<PhaseEvent> events() const;
+
+        /** Number of events not retained, due to the event limit. */
+        [[nodiscard]] size_t dropped_events() const;
+
+        /** Clear all timings, counters and events, and restart the epoch. Not safe during recording. */
+        void reset();
+
+        /**
+         * Write retained events and final counter values in the Chrome trace event format (JSON),
+         * as read by chrome://tracing and Perfetto.
+         */
+        void write_chrome_trace(std::ostream& os) const;
+
+        /** Write table of phase timings and counters. */
+        friend std::ostream& operator<<(std::ostream& os, const Recorder& recorder);
+    };
+
+    /**
+     * Times the enclosing scope as a phase, if instrumentation is enabled.
+     */
+    class ScopedPhase {
+#ifdef MOMENT_INSTRUMENTATION
+    private:
+        Recorder& recorder;
+        const Phase phase;
+        const Recorder::clock_t::time_point start;
+
+    public:
+        ScopedPhase(Recorder& recorder, const Phase phase) noexcept
+            : recorder{recorder}, phase{phase}, start{Recorder::clock_t::now()} { }
+
+        ~ScopedPhase() noexcept {
+            try {
+                this->recorder.record(this->phase, this->start, Recorder::clock_t::now());
+            } catch (...) {
+                // Failure to record is not an error of the instrumented code.
+            }
+        }
+#else
+    public:
+        constexpr ScopedPhase(const Recorder& /**/, Phase /**/) noexcept { }
+#endif
+        ScopedPhase(const ScopedPhase&) = delete;
+    };
+
+    /**
+     * Add to counter, if instrumentation is enabled.
+     */
+    inline void count(Recorder& recorder, const Counter counter, const uint64_t amount = 1) noexcept {
+        if constexpr (enabled) {
+            recorder.add(counter, amount);
+        }
+    }
+}
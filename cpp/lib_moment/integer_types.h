@@ -8,6 +8,7 @@
 
 #include <cinttypes>
 #include <cstddef>
+#include <limits>
 
 namespace Moment {
 
@@ -45,6 +46,22 @@ namespace Moment {
      */
     using symbol_name_t = int32_t;
 
+#ifdef MOMENT_WIDE_HASH
+    /**
+     * For (shortlex) hashes of operator sequences: 128-bit, permitting longer words and larger alphabets.
+     */
+    using hash_t = unsigned __int128;
+
+    // Shortlex hashing relies on numeric_limits, which strict (non-GNU) standard modes leave unspecialized.
+    static_assert(std::numeric_limits<hash_t>::digits == 128,
+                  "MOMENT_WIDE_HASH requires numeric_limits<unsigned __int128>; compile with GNU extensions.");
+#else
+    /**
+     * For (shortlex) hashes of operator sequences.
+     */
+    using hash_t = uint64_t;
+#endif
+
     /**
      * The maximum length of operator sequence before heap allocations are required
      */
@@ -8,6 +8,8 @@
 #include "matrix_basis.h"
 #include "symbolic_matrix.h"
 
+#include "scenarios/context.h"
+
 namespace Moment {
   namespace {
         template<typename BasisInfo>
@@ -187,6 +189,25 @@ namespace Moment {
         return this->matrix.create_sparse_complex_basis();
     }
 
+    size_t MatrixBasis::memory_footprint() const {
+        return this->Dense.memory_footprint() + this->DenseComplex.memory_footprint()
+               + this->Sparse.memory_footprint() + this->SparseComplex.memory_footprint()
+               + this->DenseMonolithic.memory_footprint() + this->DenseMonolithicComplex.memory_footprint()
+               + this->SparseMonolithic.memory_footprint() + this->SparseMonolithicComplex.memory_footprint();
+    }
+
+    size_t MatrixBasis::drop_cache() {
+        std::unique_lock lock{this->mutex};
+        return this->Dense.drop_cache() + this->DenseComplex.drop_cache()
+               + this->Sparse.drop_cache() + this->SparseComplex.drop_cache()
+               + this->DenseMonolithic.drop_cache() + this->DenseMonolithicComplex.drop_cache()
+               + this->SparseMonolithic.drop_cache() + this->SparseMonolithicComplex.drop_cache();
+    }
+
+    Instrumentation::Recorder& MatrixBasis::recorder() const noexcept {
+        return this->matrix.context.instrumentation();
+    }
+
     template<>
     DenseBasisInfo::MakeStorageType
     MatrixBasis::MatrixBasisImpl<DenseBasisInfo>::create_basis() const {
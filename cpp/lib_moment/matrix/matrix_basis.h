@@ -8,6 +8,11 @@
 #pragma once
 #include "matrix_basis_type.h"
 
+#include "instrumentation/instrumentation.h"
+
+#include "utilities/eigen_utils.h"
+#include "utilities/memory_footprint.h"
+
 #include <atomic>
 #include <mutex>
 #include <stdexcept>
@@ -67,6 +72,7 @@ namespace Moment {
                 }
 
                 // Create and flag as done
+                Instrumentation::ScopedPhase timer{this->basis.recorder(), Instrumentation::Phase::BasisCreation};
                 auto [re_part, im_part] = this->create_basis();
                 this->re = std::move(re_part);
                 this->im = std::move(im_part);
@@ -78,6 +84,44 @@ namespace Moment {
 
             /** Constructs the basis from scratch */
             [[nodiscard]] typename MBTInfo::MakeStorageType create_basis() const;
+
+            /** Approximate bytes used by the cached basis (zero, if it has not been created). */
+            [[nodiscard]] size_t memory_footprint() const {
+                std::unique_lock lock{this->basis.mutex};
+                if (!this->done.load(std::memory_order_acquire)) {
+                    return 0;
+                }
+                return storage_bytes(this->re) + storage_bytes(this->im);
+            }
+
+            /**
+             * Release the cached basis, so that it is created again on next access.
+             * Invalidates references previously returned by operator().
+             * @return Approximate bytes released.
+             */
+            size_t drop_cache() {
+                std::unique_lock lock{this->basis.mutex};
+                const size_t released = this->memory_footprint();
+                this->done.store(false, std::memory_order_release);
+                this->re = typename MBTInfo::RealStorageType{};
+                this->im = typename MBTInfo::ImStorageType{};
+                return released;
+            }
+
+        private:
+            template<typename matrix_t>
+            [[nodiscard]] static size_t storage_bytes(const std::vector<matrix_t>& cells) noexcept {
+                size_t total = Memory::container_bytes(cells);
+                for (const auto& cell : cells) {
+                    total += heap_bytes(cell);
+                }
+                return total;
+            }
+
+            template<typename matrix_t>
+            [[nodiscard]] static size_t storage_bytes(const std::unique_ptr<matrix_t>& monolith) noexcept {
+                return monolith ? (sizeof(matrix_t) + heap_bytes(*monolith)) : 0;
+            }
         };
 
     public:
@@ -135,7 +179,20 @@ namespace Moment {
 
         MatrixBasis(const SymbolicMatrix& matrix, MatrixBasis&& rhs) noexcept;
 
+        /** Approximate bytes used by all cached bases. */
+        [[nodiscard]] size_t memory_footprint() const;
+
+        /**
+         * Release all cached bases, so that they are created again on next access.
+         * Invalidates references to bases; for thread safety, call for write lock on the matrix system first.
+         * @return Approximate bytes released.
+         */
+        size_t drop_cache();
+
     private:
+        /** Phase recorder of the matrix's context. */
+        [[nodiscard]] Instrumentation::Recorder& recorder() const noexcept;
+
         DenseBasisInfo::MakeStorageType create_dense();
         SparseBasisInfo::MakeStorageType create_sparse();
         DenseComplexBasisInfo::MakeStorageType create_dense_complex();
@@ -71,6 +71,14 @@ namespace Moment {
 
     MonomialMatrix::~MonomialMatrix() noexcept = default;
 
+    size_t MonomialMatrix::symbol_data_bytes() const noexcept {
+        size_t total = SymbolicMatrix::symbol_data_bytes();
+        if (this->sym_exp_matrix) {
+            total += sizeof(SquareMatrix<Monomial>) + this->sym_exp_matrix->ElementCount * sizeof(Monomial);
+        }
+        return total;
+    }
+
     void MonomialMatrix::renumerate_bases(const SymbolTable &symbols, double zero_tolerance) {
         for (auto& symbol : *this->sym_exp_matrix) {
             // Make conjugation status canonical:~
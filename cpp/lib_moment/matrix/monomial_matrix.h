@@ -6,6 +6,7 @@
  */
 #pragma once
 
+#include "prepared_monomial_matrix.h"
 #include "symbolic_matrix.h"
 
 #include "symbolic/monomial.h"
@@ -94,6 +95,8 @@ namespace Moment {
             return this->sym_exp_matrix->raw();
         }
 
+        [[nodiscard]] size_t symbol_data_bytes() const noexcept override;
+
         using SymbolicMatrix::pre_multiply;
 
         using SymbolicMatrix::post_multiply;
@@ -179,6 +182,17 @@ namespace Moment {
                                            Multithreading::MultiThreadPolicy mt_policy
                                             = Multithreading::MultiThreadPolicy::Optional);
 
+        /**
+         * Constructs a matrix by identifying unique symbols in prepared operator matrices, then registering them.
+         * @param symbol_table The symbol table (matrix system should be under write lock).
+         * @param prepared The generated operator matrices; must not be empty.
+         * @param mt_policy The multithreading policy for symbol identification.
+         */
+        static std::unique_ptr<MonomialMatrix>
+        register_symbols_and_create_matrix(SymbolTable& symbol_table, PreparedMonomialMatrix&& prepared,
+                                           Multithreading::MultiThreadPolicy mt_policy
+                                            = Multithreading::MultiThreadPolicy::Optional);
+
 
     };
 
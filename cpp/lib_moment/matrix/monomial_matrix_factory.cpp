@@ -30,6 +30,10 @@ namespace Moment {
             SymbolTable& symbol_table;
             const OperatorMatrix& osm;
 
+            /** Symbols of previously registered matrix, forming top-left block of this matrix (or nullptr). */
+            const SquareMatrix<Monomial>* nested_symbols = nullptr;
+            size_t nested_dimension = 0;
+
         public:
             const bool hermitian = false;
             const std::complex<double> prefactor = {1.0, 1.0};
@@ -44,6 +48,15 @@ namespace Moment {
                       prefactor{the_factor} {}
 
 
+            /**
+             * Copy symbols in top-left block from previously registered matrix, instead of looking them up.
+             */
+            void copy_nested_block(const SquareMatrix<Monomial>* nested) noexcept {
+                assert((nested == nullptr) || (nested->dimension < osm.dimension));
+                this->nested_symbols = nested;
+                this->nested_dimension = (nested != nullptr) ? nested->dimension : 0;
+            }
+
             std::unique_ptr<SquareMatrix<Monomial>> operator()() {
                 auto unique_sequences = hermitian ? identify_unique_sequences_hermitian()
                                                   : identify_unique_sequences_generic();
@@ -55,10 +68,13 @@ namespace Moment {
             }
 
         private:
+            [[nodiscard]] inline bool in_nested_block(const size_t row, const size_t col) const noexcept {
+                return (row < this->nested_dimension) && (col < this->nested_dimension);
+            }
 
             [[nodiscard]] std::vector<Symbol> identify_unique_sequences_hermitian() const {
                 std::vector<Symbol> build_unique;
-                std::set<size_t> known_hashes;
+                std::set<hash_t> known_hashes;
 
                 // First, always manually insert zero and one
                 build_unique.emplace_back(Symbol::Zero(context));
@@ -73,8 +89,13 @@ namespace Moment {
 
                 if constexpr (only_hermitian_ops) {
                     while (iter != iter_end) {
+                        // Symbols in nested block are already registered
+                        if (this->in_nested_block(iter.Row(), iter.Col())) {
+                            ++iter;
+                            continue;
+                        }
                         const auto& conj_elem = *iter;
-                        const size_t hash = conj_elem.hash();
+                        const hash_t hash = conj_elem.hash();
                         // Don't add what is already known
                         if (known_hashes.contains(hash)) {
                             ++iter;
@@ -91,14 +112,18 @@ namespace Moment {
                         // numbered according to the top /row/ of moment matrices, if possible.
                         // Thus, we look at a col-major iterator over the lower triangle, which actually gives us the
                         // conjugates of what were generated; but we define what we find as the conjugate element.
+                        if (this->in_nested_block(iter.Row(), iter.Col())) {
+                            ++iter;
+                            continue;
+                        }
                         const auto& conj_elem = *iter;
                         const auto elem = conj_elem.conjugate();
 
                         int compare = OperatorSequence::compare_same_negation(elem, conj_elem);
                         const bool elem_hermitian = (compare == 1);
 
-                        const size_t hash = elem.hash();
-                        const size_t conj_hash = conj_elem.hash();
+                        const hash_t hash = elem.hash();
+                        const hash_t conj_hash = conj_elem.hash();
 
                         // Don't add what is already known
                         if (known_hashes.contains(hash) || (!elem_hermitian && known_hashes.contains(conj_hash))) {
@@ -128,7 +153,7 @@ namespace Moment {
 
             [[nodiscard]] std::vector<Symbol> identify_unique_sequences_generic() const {
                 std::vector<Symbol> build_unique;
-                std::set<size_t> known_hashes;
+                std::set<hash_t> known_hashes;
 
                 // First, always manually insert zero and one
                 build_unique.emplace_back(Symbol::Zero(context));
@@ -139,8 +164,12 @@ namespace Moment {
 
                 // Now, look at elements and see if they are unique or not
                 if constexpr (only_hermitian_ops) {
-                    for (const auto& elem: osm) {
-                        const size_t hash = elem.hash();
+                    for (size_t offset = 0; offset < osm.ElementCount; ++offset) {
+                        if (this->in_nested_block(offset % osm.dimension, offset / osm.dimension)) {
+                            continue;
+                        }
+                        const auto& elem = osm[offset];
+                        const hash_t hash = elem.hash();
                         // Don't add what is already known
                         if (known_hashes.contains(hash)) {
                             continue;
@@ -152,14 +181,18 @@ namespace Moment {
                     }
                 } else {
                     // Now, look at elements and see if they are unique or not
-                    for (const auto& elem: osm) {
+                    for (size_t offset = 0; offset < osm.ElementCount; ++offset) {
+                        if (this->in_nested_block(offset % osm.dimension, offset / osm.dimension)) {
+                            continue;
+                        }
+                        const auto& elem = osm[offset];
 
                         const auto conj_elem = elem.conjugate();
                         int compare = OperatorSequence::compare_same_negation(elem, conj_elem);
                         const bool elem_hermitian = (compare == 1);
 
-                        const size_t hash = elem.hash();
-                        const size_t conj_hash = conj_elem.hash();
+                        const hash_t hash = elem.hash();
+                        const hash_t conj_hash = conj_elem.hash();
 
                         // Don't add what is already known
                         if (known_hashes.contains(hash) || (!elem_hermitian && known_hashes.contains(conj_hash))) {
@@ -198,9 +231,21 @@ namespace Moment {
                 while (iter != iter_end) {
                     const size_t row = iter.Row();
                     const size_t col = iter.Col();
+
+                    // Copy symbols from nested block
+                    if (this->in_nested_block(row, col)) {
+                        symbolic_representation[iter.Offset()] = (*this->nested_symbols)(row, col);
+                        if (!iter.diagonal()) {
+                            size_t lower_offset = osm.index_to_offset_no_checks(std::array<size_t, 2>{col, row});
+                            symbolic_representation[lower_offset] = (*this->nested_symbols)(col, row);
+                        }
+                        ++iter;
+                        continue;
+                    }
+
                     const auto& elem = *iter;
 
-                    const size_t hash = elem.hash();
+                    const hash_t hash = elem.hash();
 
                     const auto monomial_sign = to_scalar(elem.get_sign());
 
@@ -255,13 +300,20 @@ namespace Moment {
             [[nodiscard]] std::unique_ptr<SquareMatrix<Monomial>> build_symbol_matrix_generic() const {
                 std::vector<Monomial> symbolic_representation(osm.dimension * osm.dimension);
                 for (size_t offset = 0; offset < osm.ElementCount; ++offset) {
+                    const size_t row = offset % osm.dimension;
+                    const size_t col = offset / osm.dimension;
+                    if (this->in_nested_block(row, col)) {
+                        symbolic_representation[offset] = (*this->nested_symbols)(row, col);
+                        continue;
+                    }
+
                     const auto& elem = osm[offset];
 
                     auto elem_factor = to_scalar(elem.get_sign());
                     if constexpr (has_prefactor) {
                         elem_factor *= this->prefactor;
                     }
-                    const size_t hash = elem.hash();
+                    const hash_t hash = elem.hash();
 
                     auto [symbol_id, conjugated] = symbol_table.hash_to_index(hash);
                     if (symbol_id == std::numeric_limits<ptrdiff_t>::max()) {
@@ -283,22 +335,32 @@ namespace Moment {
 
 
         [[nodiscard]] std::unique_ptr<SquareMatrix<Monomial>>
-        do_os_to_sym_st(SymbolTable& symbols, const OperatorMatrix& op_matrix) {
+        do_os_to_sym_st(SymbolTable& symbols, const OperatorMatrix& op_matrix,
+                        const SquareMatrix<Monomial>* nested_symbols) {
             const auto& context = op_matrix.context;
             if (context.can_be_nonhermitian()) {
-                return OpSeqToSymbolConverter<false, false>{context, symbols, op_matrix}();
+                OpSeqToSymbolConverter<false, false> converter{context, symbols, op_matrix};
+                converter.copy_nested_block(nested_symbols);
+                return converter();
             } else {
-                return OpSeqToSymbolConverter<false, true>{context, symbols, op_matrix}();
+                OpSeqToSymbolConverter<false, true> converter{context, symbols, op_matrix};
+                converter.copy_nested_block(nested_symbols);
+                return converter();
             }
         }
 
         [[nodiscard]] std::unique_ptr<SquareMatrix<Monomial>>
-        do_os_to_sym_st(SymbolTable& symbols, const OperatorMatrix& op_matrix, const std::complex<double> prefactor) {
+        do_os_to_sym_st(SymbolTable& symbols, const OperatorMatrix& op_matrix, const std::complex<double> prefactor,
+                        const SquareMatrix<Monomial>* nested_symbols) {
             const auto& context = op_matrix.context;
             if (context.can_be_nonhermitian()) {
-                return OpSeqToSymbolConverter<true, false>{context, symbols, op_matrix, prefactor}();
+                OpSeqToSymbolConverter<true, false> converter{context, symbols, op_matrix, prefactor};
+                converter.copy_nested_block(nested_symbols);
+                return converter();
             } else {
-                return OpSeqToSymbolConverter<true, true>{context, symbols, op_matrix, prefactor}();
+                OpSeqToSymbolConverter<true, true> converter{context, symbols, op_matrix, prefactor};
+                converter.copy_nested_block(nested_symbols);
+                return converter();
             }
         }
 
@@ -389,7 +451,7 @@ namespace Moment {
 
     void MonomialMatrixFactoryWorker::identify_unique_symbols_hermitian() {
         const size_t row_length = bundle.dimension;
-        std::set<size_t> known_hashes;
+        std::set<hash_t> known_hashes;
 
         // First, always manually insert zero and one (if thread 0).
         if (this->worker_id == 0) {
@@ -399,9 +461,11 @@ namespace Moment {
             known_hashes.emplace(1);
         }
 
-        // Now, look at elements and see if they are unique or not
+        // Now, look at elements and see if they are unique or not [skipping already-registered nested block]
+        const size_t nested_dimension = this->bundle.nested_dimension;
         for (size_t col_idx = worker_id; col_idx < row_length; col_idx += max_workers) {
-            for (size_t row_idx = col_idx; row_idx < row_length; ++row_idx) {
+            const size_t first_row = (col_idx < nested_dimension) ? nested_dimension : col_idx;
+            for (size_t row_idx = first_row; row_idx < row_length; ++row_idx) {
                 const size_t offset = (col_idx * row_length) + row_idx;
                 const size_t conj_offset = (row_idx * row_length) + col_idx;
                 const auto &elem = this->bundle.os_data_ptr[offset];
@@ -410,8 +474,8 @@ namespace Moment {
                 int compare = OperatorSequence::compare_same_negation(elem, conj_elem);
                 const bool elem_hermitian = (compare == 1);
 
-                const size_t hash = elem.hash();
-                const size_t conj_hash = conj_elem.hash();
+                const hash_t hash = elem.hash();
+                const hash_t conj_hash = conj_elem.hash();
 
                 // Don't add what is already known
                 if (known_hashes.contains(hash)) {
@@ -440,7 +504,7 @@ namespace Moment {
 
     void MonomialMatrixFactoryWorker::identify_unique_symbols_generic() {
         const size_t row_length = bundle.dimension;
-        std::set<size_t> known_hashes;
+        std::set<hash_t> known_hashes;
 
         // First, always manually insert zero and one (if thread 0).
         if (this->worker_id == 0) {
@@ -451,9 +515,11 @@ namespace Moment {
         }
 
 
-        // Now, look at elements and see if they are unique or not
+        // Now, look at elements and see if they are unique or not [skipping already-registered nested block]
+        const size_t nested_dimension = this->bundle.nested_dimension;
         for (size_t col_idx = worker_id; col_idx < row_length; col_idx += max_workers) {
-            for (size_t row_idx = 0; row_idx < row_length; ++row_idx) {
+            const size_t first_row = (col_idx < nested_dimension) ? nested_dimension : 0;
+            for (size_t row_idx = first_row; row_idx < row_length; ++row_idx) {
                 const size_t offset = (col_idx * row_length) + row_idx;
                 const auto &elem = this->bundle.os_data_ptr[offset];
 
@@ -461,8 +527,8 @@ namespace Moment {
                 int compare = OperatorSequence::compare_same_negation(elem, conj_elem);
                 const bool elem_hermitian = (compare == 1);
 
-                const size_t hash = elem.hash();
-                const size_t conj_hash = conj_elem.hash();
+                const hash_t hash = elem.hash();
+                const hash_t conj_hash = conj_elem.hash();
 
                 // Don't add what is already known
                 if (known_hashes.contains(hash)) {
@@ -552,10 +618,15 @@ namespace Moment {
             for (size_t row_idx = 0; row_idx < row_length; ++row_idx) {
 
                 const size_t offset = (col_idx * row_length) + row_idx;
+                if (this->bundle.in_nested_block(row_idx, col_idx)) {
+                    this->bundle.sm_data_ptr[offset] = (*this->bundle.nested_symbols)(row_idx, col_idx);
+                    continue;
+                }
+
                 const auto& elem = this->bundle.os_data_ptr[offset];
 
                 const auto mono_factor = prefactor * to_scalar(elem.get_sign());
-                const size_t hash = elem.hash();
+                const hash_t hash = elem.hash();
                 auto [symbol_id, conjugated] = symbol_table.hash_to_index(hash);
 
                 if (symbol_id == std::numeric_limits<ptrdiff_t>::max()) {
@@ -587,9 +658,15 @@ namespace Moment {
 
                 const size_t offset = (col_idx * row_length) + row_idx;
                 const size_t trans_offset = (row_idx * row_length) + col_idx;
+                if (this->bundle.in_nested_block(row_idx, col_idx)) {
+                    write_ptr[offset] = (*this->bundle.nested_symbols)(row_idx, col_idx);
+                    write_ptr[trans_offset] = (*this->bundle.nested_symbols)(col_idx, row_idx);
+                    continue;
+                }
+
                 const auto& elem = this->bundle.os_data_ptr[offset];
 
-                const size_t hash = elem.hash();
+                const hash_t hash = elem.hash();
                 const auto monomial_sign = to_scalar(elem.get_sign());
 
                 auto [symbol_id, conjugated] = symbol_table.hash_to_index(hash);
@@ -622,13 +699,16 @@ namespace Moment {
 
     MonomialMatrixFactoryMultithreaded::MonomialMatrixFactoryMultithreaded(SymbolTable& symbols,
                                                                            const OperatorMatrix& input_matrix,
-                                                                           std::complex<double> prefactor)
+                                                                           std::complex<double> prefactor,
+                                                                           const SquareMatrix<Monomial>* nested)
         : context{input_matrix.context}, symbols{symbols},
           dimension{input_matrix.Dimension()}, os_data_ptr{input_matrix.raw()}, prefactor{prefactor},
-          is_hermitian{input_matrix.is_hermitian()} {
+          is_hermitian{input_matrix.is_hermitian()},
+          nested_symbols{nested}, nested_dimension{(nested != nullptr) ? nested->dimension : 0} {
 
         // Check OS matrix is good
         assert(os_data_ptr != nullptr);
+        assert(nested_dimension < dimension || (nested_symbols == nullptr));
 
 
         // Clear progress flags
@@ -725,9 +805,11 @@ namespace Moment {
         register_symbols_and_create_matrix_singlethread(SymbolTable& symbols,
                                                         std::unique_ptr<OperatorMatrix> unaliased_operator_matrix,
                                                         std::unique_ptr<OperatorMatrix> aliased_operator_matrix,
-                                                        std::complex<double> prefactor) {
+                                                        std::complex<double> prefactor,
+                                                        const SquareMatrix<Monomial>* nested_symbols) {
             assert(unaliased_operator_matrix);
             const auto& context = unaliased_operator_matrix->context;
+            Instrumentation::ScopedPhase timer{context.instrumentation(), Instrumentation::Phase::SymbolIdentification};
 
             std::unique_ptr<SquareMatrix<Monomial>> symbolic_matrix;
             if (context.can_have_aliases()) {
@@ -735,17 +817,17 @@ namespace Moment {
 
                 if (prefactor != 1.0) {
 
-                    symbolic_matrix = do_os_to_sym_st(symbols, *aliased_operator_matrix, prefactor);
+                    symbolic_matrix = do_os_to_sym_st(symbols, *aliased_operator_matrix, prefactor, nested_symbols);
 
                 } else {
-                    symbolic_matrix = do_os_to_sym_st(symbols, *aliased_operator_matrix);;
+                    symbolic_matrix = do_os_to_sym_st(symbols, *aliased_operator_matrix, nested_symbols);
                 }
             } else {
                 assert(aliased_operator_matrix == nullptr);
                 if (prefactor != 1.0) {
-                    symbolic_matrix = do_os_to_sym_st(symbols, *unaliased_operator_matrix, prefactor);
+                    symbolic_matrix = do_os_to_sym_st(symbols, *unaliased_operator_matrix, prefactor, nested_symbols);
                 } else {
-                    symbolic_matrix = do_os_to_sym_st(symbols, *unaliased_operator_matrix);
+                    symbolic_matrix = do_os_to_sym_st(symbols, *unaliased_operator_matrix, nested_symbols);
                 }
             }
 
@@ -760,7 +842,8 @@ namespace Moment {
         register_symbols_and_create_matrix_multithread(SymbolTable& symbols,
                                                        std::unique_ptr<OperatorMatrix> unaliased_operator_matrix,
                                                        std::unique_ptr<OperatorMatrix> aliased_operator_matrix,
-                                                       std::complex<double> prefactor) {
+                                                       std::complex<double> prefactor,
+                                                       const SquareMatrix<Monomial>* nested_symbols) {
 
             assert(unaliased_operator_matrix != nullptr);
             const OperatorMatrix& src_matrix = (aliased_operator_matrix != nullptr)
@@ -768,8 +851,13 @@ namespace Moment {
                                                 : *unaliased_operator_matrix;
 
 
-            MonomialMatrixFactoryMultithreaded factory{symbols, src_matrix, prefactor};
-            auto symbolic_matrix = factory.execute();
+            std::unique_ptr<SquareMatrix<Monomial>> symbolic_matrix;
+            {
+                Instrumentation::ScopedPhase timer{src_matrix.context.instrumentation(),
+                                                   Instrumentation::Phase::SymbolIdentification};
+                MonomialMatrixFactoryMultithreaded factory{symbols, src_matrix, prefactor, nested_symbols};
+                symbolic_matrix = factory.execute();
+            }
 
             return std::make_unique<MonomialMatrix>(symbols,
                                                     std::move(unaliased_operator_matrix),
@@ -790,10 +878,38 @@ namespace Moment {
         const size_t numel = unaliased_operator_matrix->Dimension() * unaliased_operator_matrix->Dimension();
         if (Multithreading::should_multithread_matrix_creation(mt_policy, numel)) {
             return register_symbols_and_create_matrix_multithread(symbols, std::move(unaliased_operator_matrix),
-                                                                   std::move(aliased_operator_matrix), prefactor);
+                                                                   std::move(aliased_operator_matrix), prefactor,
+                                                                   nullptr);
         } else {
             return register_symbols_and_create_matrix_singlethread(symbols, std::move(unaliased_operator_matrix),
-                                                                  std::move(aliased_operator_matrix), prefactor);
+                                                                  std::move(aliased_operator_matrix), prefactor,
+                                                                  nullptr);
+        }
+    }
+
+    std::unique_ptr<MonomialMatrix>
+    MonomialMatrix::register_symbols_and_create_matrix(SymbolTable& symbols, PreparedMonomialMatrix&& prepared,
+                                                       Multithreading::MultiThreadPolicy mt_policy) {
+        assert(!prepared.empty());
+
+        // Symbols of nested block can be copied, if they have the same prefactor
+        const SquareMatrix<Monomial>* nested_symbols = nullptr;
+        if ((prepared.nested_matrix != nullptr) && (prepared.nested_matrix->global_factor() == prepared.prefactor)) {
+            nested_symbols = &(prepared.nested_matrix->SymbolMatrix());
+        }
+
+        const size_t numel = prepared.unaliased_operator_matrix->Dimension()
+                                * prepared.unaliased_operator_matrix->Dimension();
+        if (Multithreading::should_multithread_matrix_creation(mt_policy, numel)) {
+            return register_symbols_and_create_matrix_multithread(symbols,
+                                                                  std::move(prepared.unaliased_operator_matrix),
+                                                                  std::move(prepared.aliased_operator_matrix),
+                                                                  prepared.prefactor, nested_symbols);
+        } else {
+            return register_symbols_and_create_matrix_singlethread(symbols,
+                                                                   std::move(prepared.unaliased_operator_matrix),
+                                                                   std::move(prepared.aliased_operator_matrix),
+                                                                   prepared.prefactor, nested_symbols);
         }
     }
 
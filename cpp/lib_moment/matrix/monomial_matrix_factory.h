@@ -31,7 +31,7 @@ namespace Moment {
         std::promise<bool> done_symbol_identification;
         std::promise<bool> done_sm_generation;
 
-        std::map<size_t, Symbol> unique_elements;
+        std::map<hash_t, Symbol> unique_elements;
 
 
         /** Divide and conquer 'ready' index.
@@ -60,7 +60,7 @@ namespace Moment {
             this->the_thread = std::thread(&MonomialMatrixFactoryWorker::execute, this);
         }
 
-        [[nodiscard]] std::map<size_t, Symbol>& yield_unique_elements() noexcept {
+        [[nodiscard]] std::map<hash_t, Symbol>& yield_unique_elements() noexcept {
             return this->unique_elements;
         }
 
@@ -118,6 +118,12 @@ namespace Moment {
         /** True, if OperatorSequence matrix is Hermitian. */
         const bool is_hermitian;
 
+        /** Symbols of previously registered matrix, forming top-left block of this matrix (or nullptr). */
+        SquareMatrix<Monomial> const * const nested_symbols;
+
+        /** Size of top-left block copied from nested symbols. */
+        const size_t nested_dimension;
+
     private:
         std::vector<std::unique_ptr<worker_t>> workers;
 
@@ -135,7 +141,8 @@ namespace Moment {
     public:
         explicit MonomialMatrixFactoryMultithreaded(SymbolTable& symbols,
                                                     const OperatorMatrix& input_matrix,
-                                                    const std::complex<double> prefactor);
+                                                    const std::complex<double> prefactor,
+                                                    const SquareMatrix<Monomial>* nested = nullptr);
 
         /** No copy constructor! */
         MonomialMatrixFactoryMultithreaded(const MonomialMatrixFactoryMultithreaded&) = delete;
@@ -151,6 +158,13 @@ namespace Moment {
          */
         std::unique_ptr<SquareMatrix<Monomial>> execute();
 
+        /**
+         * True if symbol at (row, col) can be copied from nested matrix.
+         */
+        [[nodiscard]] inline bool in_nested_block(const size_t row, const size_t col) const noexcept {
+            return (row < this->nested_dimension) && (col < this->nested_dimension);
+        }
+
     private:
         void identify_unique_symbols();
 
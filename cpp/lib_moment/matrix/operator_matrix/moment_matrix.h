@@ -9,6 +9,7 @@
 #include "operator_matrix.h"
 #include "operator_matrix_impl.h"
 
+#include "matrix/monomial_matrix.h"
 #include "scenarios/context.h"
 #include "dictionary/dictionary.h"
 #include "matrix_system/indices/moment_matrix_index.h"
@@ -73,5 +74,43 @@ namespace Moment {
         [[nodiscard]] std::string description() const override {
             return this->Index.to_string();
         }
+
+        /**
+         * Generation of operator matrices, reusing a lower-level moment matrix as the top-left block.
+         * As the dictionary of level k is the start of the dictionary of level k+1, only the new border rows and
+         * columns need to be generated. Falls back to full generation if the nested matrix cannot be reused.
+         * @param context The operator context.
+         * @param index The hierarchy depth of the new moment matrix.
+         * @param nested_matrix Previously created moment matrix, of lower hierarchy depth.
+         * @param mt_policy Multithreading policy for generation.
+         */
+        [[nodiscard]] static PreparedMonomialMatrix
+        prepare_nested_matrix(const Context& context, MomentMatrixIndex index, const MonomialMatrix& nested_matrix,
+                              Multithreading::MultiThreadPolicy mt_policy
+                                = Multithreading::MultiThreadPolicy::Optional) {
+            const auto* nested_unaliased = to_operator_matrix_ptr(nested_matrix, false);
+            const auto* nested_aliased = context.can_have_aliases() ? to_operator_matrix_ptr(nested_matrix, true)
+                                                                    : nullptr;
+            if (nested_unaliased == nullptr) {
+                return prepare_matrix(context, index, mt_policy);
+            }
+
+            OperatorMatrixFactory<MomentMatrix, Context, MomentMatrixIndex, MomentMatrixGenerator>
+                    creation_factory{context, index, MomentMatrixGenerator{context, index},
+                                     true, std::complex<double>{1.0, 0.0}, mt_policy};
+            const bool use_nested = creation_factory.use_nested_block(*nested_unaliased, nested_aliased);
+
+            PreparedMonomialMatrix output;
+            if (context.can_have_aliases()) {
+                auto pair_ptrs = creation_factory.make_aliased();
+                output = PreparedMonomialMatrix{std::move(pair_ptrs.first), std::move(pair_ptrs.second)};
+            } else {
+                output = PreparedMonomialMatrix{creation_factory.make_unaliased(), nullptr};
+            }
+            if (use_nested) {
+                output.nested_matrix = &nested_matrix;
+            }
+            return output;
+        }
     };
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
  * @author Andrew J. P. Garner
  */
 #include "operator_matrix.h"
+#include "operator_matrix_regenerator.h"
 #include "operator_matrix_transformation.h"
 
 #include "dictionary/operator_sequence_generator.h"
@@ -67,6 +68,10 @@ namespace Moment {
         throw std::runtime_error{"Generic OperatorMatrix does not have any attached generators."};
     }
 
+    std::unique_ptr<OperatorMatrixRegenerator> OperatorMatrix::regenerator() const {
+        return nullptr;
+    }
+
     void OperatorMatrix::set_properties(SymbolicMatrix &matrix) const {
         matrix.description = this->description();
         matrix.hermitian = this->is_hermitian();
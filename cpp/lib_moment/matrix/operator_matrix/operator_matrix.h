@@ -31,6 +31,7 @@
 
 namespace Moment {
 
+    class OperatorMatrixRegenerator;
     class Polynomial;
     class SymbolTable;
     class SymbolMatrix;
@@ -79,6 +80,11 @@ namespace Moment {
          */
          [[nodiscard]] virtual const OSGPair& generators() const;
 
+        /**
+         * Object that can generate this matrix afresh, or nullptr if the matrix was not made from an index.
+         */
+        [[nodiscard]] virtual std::unique_ptr<OperatorMatrixRegenerator> regenerator() const;
+
         /** Apply the properties from this operator matrix to the supplied matrix. */
         void set_properties(SymbolicMatrix& matrix) const;
 
@@ -43,9 +43,6 @@ namespace Moment {
         /** Operator context */
         const context_t& context;
 
-        /** Symbol table w/ write access. */
-        SymbolTable& symbols;
-
         /** Full index, for purposes of labelling resultant matrix  */
         const index_t Index;
 
@@ -82,27 +79,34 @@ namespace Moment {
         /** True, if we cannot guarantee the resulting matrix is Hermitian (even if it should be). */
         bool could_be_non_hermitian = true;
 
+        /** Previously generated matrix, whose elements form the top-left block of this matrix (or nullptr). */
+        os_matrix_t const* nested_unaliased = nullptr;
+
+        /** Aliased version of previously generated matrix (or nullptr if context has no aliases). */
+        os_matrix_t const* nested_aliased = nullptr;
+
+        /** Size of top-left block that can be copied from the nested matrix. */
+        size_t nested_dimension = 0;
+
     public:
 
         /**
-         * Class that produces a moment matrix by first generating its operator matrix, applying any implicit symmetries,
-         * identifying (and registering) the unique sequences in the matrix as symbols, and then producing the resulting
-         * symbolic monomial (i.e. 'moment') matrix.
+         * Class that generates an operator matrix, applying any implicit symmetries.
+         * This does not touch the symbol table, so can be invoked without a write lock on the matrix system.
          *
          * Depending on mt_policy, this may use single or multi-threaded execution.
          *
          * @param context The operator context.
-         * @param symbols The symbol table (whole matrix system should be under write lock).
          * @param matrix_index The index labelling the dictionary used to generate the matrix.
          * @param the_functor The function that combines elements from the dictionary to form matrix element operators.
          * @param should_be_hermitian True, if logically the matrix generated must be Hermitian.
          * @param prefactor Constant factor to multiply all operator sequences in matrix by.
          * @param mt_policy Should we use multi-threaded creation?
          */
-        OperatorMatrixFactory(const context_t& context, SymbolTable& symbols, const index_t& matrix_index,
+        OperatorMatrixFactory(const context_t& context, const index_t& matrix_index,
                               functor_t the_functor, bool should_be_hermitian, std::complex<double> prefactor,
                               const Multithreading::MultiThreadPolicy mt_policy)
-                : context{context}, symbols{symbols}, elem_functor{std::move(the_functor)},
+                : context{context}, elem_functor{std::move(the_functor)},
                   should_be_hermitian{should_be_hermitian}, prefactor{prefactor},
                   Index{matrix_index},
                   OSGIndex{functor_t::get_osg_index(matrix_index)},
@@ -124,6 +128,62 @@ namespace Moment {
                                            || this->context.can_make_unexpected_nonhermitian_matrices();
         }
 
+        /**
+         * Copy the top-left block of the matrix from previously generated operator matrices, instead of regenerating.
+         * The caller must ensure that the nested matrix was generated with an equivalent element functor (e.g. the
+         * product row * col of a moment matrix), as only the generators are verified.
+         * @param unaliased The previously generated matrix.
+         * @param aliased The aliased version of the previously generated matrix (if context can have aliases).
+         * @return True if the nested matrix will be used; false if its generators are not a prefix of this matrix's.
+         */
+        bool use_nested_block(const os_matrix_t& unaliased, const os_matrix_t* aliased) {
+            if (this->context.can_have_aliases() && (aliased == nullptr)) {
+                return false;
+            }
+
+            // Nested dictionary must be strictly smaller, and be the start of this matrix's dictionary
+            const auto& nested_col_gen = unaliased.generators()();
+            const size_t block_dimension = nested_col_gen.size();
+            if ((block_dimension >= this->dimension) || (block_dimension != unaliased.Dimension())) {
+                return false;
+            }
+            for (size_t index = 0; index < block_dimension; ++index) {
+                if (nested_col_gen[index].hash() != (*this->colGen)[index].hash()) {
+                    return false;
+                }
+            }
+
+            this->nested_unaliased = &unaliased;
+            this->nested_aliased = aliased;
+            this->nested_dimension = block_dimension;
+            return true;
+        }
+
+        /**
+         * True if the element at (row, col) can be copied from the nested matrix.
+         */
+        [[nodiscard]] inline bool in_nested_block(const size_t row, const size_t col) const noexcept {
+            return (row < this->nested_dimension) && (col < this->nested_dimension);
+        }
+
+        /**
+         * Element (row, col) of the nested matrix, before aliasing. Must be within the nested block.
+         */
+        [[nodiscard]] inline const OperatorSequence&
+        nested_unaliased_element(const size_t row, const size_t col) const noexcept(!debug_mode) {
+            assert(this->in_nested_block(row, col));
+            return (*this->nested_unaliased)(row, col);
+        }
+
+        /**
+         * Element (row, col) of the nested matrix, after aliasing. Must be within the nested block.
+         */
+        [[nodiscard]] inline const OperatorSequence&
+        nested_aliased_element(const size_t row, const size_t col) const noexcept(!debug_mode) {
+            assert(this->in_nested_block(row, col) && (this->nested_aliased != nullptr));
+            return (*this->nested_aliased)(row, col);
+        }
+
         [[nodiscard]] std::unique_ptr<os_matrix_t> make_unaliased() {
             // Determine, from dimension and mt_policy, whether we should use multithreading:
             if (Multithreading::should_multithread_matrix_creation(mt_policy, numel)) {
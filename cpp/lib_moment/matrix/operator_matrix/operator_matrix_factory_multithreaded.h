@@ -9,6 +9,8 @@
 
 #include "dictionary/operator_sequence_generator.h"
 
+#include "instrumentation/instrumentation.h"
+
 #include "multithreading/multithreading.h"
 
 #include "symbolic/symbol_table.h"
@@ -120,7 +122,8 @@ namespace Moment {
             const auto& col_osg = (*bundle.factory.colGen);
             const auto& row_osg = (*bundle.factory.rowGen);
 
-            const size_t row_length = bundle.factory.dimension;
+            const auto& factory = bundle.factory;
+            const size_t row_length = factory.dimension;
 
             for (size_t col_idx = worker_id; col_idx < row_length; col_idx += max_workers) {
                 const auto &colSeq = col_osg[col_idx];
@@ -128,14 +131,22 @@ namespace Moment {
                 // Diagonal element
                 const size_t diag_idx = (col_idx * row_length) + col_idx;
                 const auto &conjColSeq = row_osg[col_idx]; // <- Conjugate by construction
-                this->bundle.os_data_ptr[diag_idx] = functor(conjColSeq, colSeq);
+                if (factory.in_nested_block(col_idx, col_idx)) {
+                    this->bundle.os_data_ptr[diag_idx] = factory.nested_unaliased_element(col_idx, col_idx);
+                } else {
+                    this->bundle.os_data_ptr[diag_idx] = functor(conjColSeq, colSeq);
+                }
 
                 // Off diagonal elements
                 for (size_t row_idx = col_idx+1; row_idx < row_length; ++row_idx) {
                     const auto &rowSeq = row_osg[row_idx];
 
                     const size_t total_idx = (col_idx * row_length) + row_idx;
-                    this->bundle.os_data_ptr[total_idx] = functor(rowSeq, colSeq);
+                    if (factory.in_nested_block(row_idx, col_idx)) {
+                        this->bundle.os_data_ptr[total_idx] = factory.nested_unaliased_element(row_idx, col_idx);
+                    } else {
+                        this->bundle.os_data_ptr[total_idx] = functor(rowSeq, colSeq);
+                    }
 
                     const size_t conj_idx = (row_idx * row_length) + col_idx;
                     this->bundle.os_data_ptr[conj_idx] = this->bundle.os_data_ptr[total_idx].conjugate();
@@ -153,7 +164,8 @@ namespace Moment {
             const auto& col_osg = (*bundle.factory.colGen);
             const auto& row_osg = (*bundle.factory.rowGen);
 
-            const size_t row_length = bundle.factory.dimension;
+            const auto& factory = bundle.factory;
+            const size_t row_length = factory.dimension;
 
             for (size_t col_idx = worker_id; col_idx < row_length; col_idx += max_workers) {
                 const auto &colSeq = col_osg[col_idx];
@@ -161,7 +173,11 @@ namespace Moment {
 
                 // Diagonal element
                 const size_t diag_idx = (col_idx * row_length) + col_idx;
-                this->bundle.os_data_ptr[diag_idx] = functor(conjColSeq, colSeq);
+                if (factory.in_nested_block(col_idx, col_idx)) {
+                    this->bundle.os_data_ptr[diag_idx] = factory.nested_unaliased_element(col_idx, col_idx);
+                } else {
+                    this->bundle.os_data_ptr[diag_idx] = functor(conjColSeq, colSeq);
+                }
 
                 // Check for Hermiticity if not yet non-hermitian
                 if (!this->non_hermitian.has_value()) {
@@ -178,10 +194,14 @@ namespace Moment {
                     const auto &conjRowSeq = col_osg[row_idx]; // <- Conjugate by construction
 
                     const size_t total_idx = (col_idx * row_length) + row_idx;
-                    this->bundle.os_data_ptr[total_idx] = functor(rowSeq, colSeq);
-
                     const size_t conj_idx = (row_idx * row_length) + col_idx;
-                    this->bundle.os_data_ptr[conj_idx] = functor(conjColSeq, conjRowSeq);
+                    if (factory.in_nested_block(row_idx, col_idx)) {
+                        this->bundle.os_data_ptr[total_idx] = factory.nested_unaliased_element(row_idx, col_idx);
+                        this->bundle.os_data_ptr[conj_idx] = factory.nested_unaliased_element(col_idx, row_idx);
+                    } else {
+                        this->bundle.os_data_ptr[total_idx] = functor(rowSeq, colSeq);
+                        this->bundle.os_data_ptr[conj_idx] = functor(conjColSeq, conjRowSeq);
+                    }
 
                     // Check for Hermiticity if not yet nonhermitian
                     if (!this->non_hermitian.has_value()) {
@@ -211,14 +231,19 @@ namespace Moment {
             // Reset non-Hermitian information
             this->non_hermitian.reset();
 
-            const auto& context = this->bundle.factory.context;
-            const size_t row_length = bundle.factory.dimension;
+            const auto& factory = this->bundle.factory;
+            const auto& context = factory.context;
+            const size_t row_length = factory.dimension;
             for (size_t col_idx = worker_id; col_idx < row_length; col_idx += max_workers) {
 
                 // Diagonal element
                 const size_t diag_idx = (col_idx * row_length) + col_idx;
-                this->bundle.alias_data_ptr[diag_idx] =
-                        context.simplify_as_moment(this->bundle.os_data_ptr[diag_idx]);
+                if (factory.in_nested_block(col_idx, col_idx)) {
+                    this->bundle.alias_data_ptr[diag_idx] = factory.nested_aliased_element(col_idx, col_idx);
+                } else {
+                    this->bundle.alias_data_ptr[diag_idx] =
+                            context.simplify_as_moment(this->bundle.os_data_ptr[diag_idx]);
+                }
 
                 // Check for Hermiticity if not yet non-hermitian
                 if (!this->non_hermitian.has_value()) {
@@ -233,10 +258,15 @@ namespace Moment {
                     const size_t total_idx = (col_idx * row_length) + row_idx;
                     const size_t conj_idx  = (row_idx * row_length) + col_idx;
 
-                    this->bundle.alias_data_ptr[total_idx] =
-                            context.simplify_as_moment(this->bundle.os_data_ptr[total_idx]);
-                    this->bundle.alias_data_ptr[conj_idx] =
-                            context.simplify_as_moment(this->bundle.os_data_ptr[conj_idx]);
+                    if (factory.in_nested_block(row_idx, col_idx)) {
+                        this->bundle.alias_data_ptr[total_idx] = factory.nested_aliased_element(row_idx, col_idx);
+                        this->bundle.alias_data_ptr[conj_idx] = factory.nested_aliased_element(col_idx, row_idx);
+                    } else {
+                        this->bundle.alias_data_ptr[total_idx] =
+                                context.simplify_as_moment(this->bundle.os_data_ptr[total_idx]);
+                        this->bundle.alias_data_ptr[conj_idx] =
+                                context.simplify_as_moment(this->bundle.os_data_ptr[conj_idx]);
+                    }
 
                     // Check for Hermiticity if not yet non-Hermitian
                     if (!this->non_hermitian.has_value()) {
@@ -256,23 +286,32 @@ namespace Moment {
             assert(this->bundle.os_data_ptr != nullptr);
             assert(this->bundle.alias_data_ptr != nullptr);
 
-            const auto& context = bundle.factory.context;
+            const auto& factory = bundle.factory;
+            const auto& context = factory.context;
 
-            const size_t row_length = bundle.factory.dimension;
+            const size_t row_length = factory.dimension;
 
             for (size_t col_idx = worker_id; col_idx < row_length; col_idx += max_workers) {
 
                 // Diagonal element
                 const size_t diag_idx = (col_idx * row_length) + col_idx;
-                this->bundle.alias_data_ptr[diag_idx] =
-                        context.simplify_as_moment(this->bundle.os_data_ptr[diag_idx]);
+                if (factory.in_nested_block(col_idx, col_idx)) {
+                    this->bundle.alias_data_ptr[diag_idx] = factory.nested_aliased_element(col_idx, col_idx);
+                } else {
+                    this->bundle.alias_data_ptr[diag_idx] =
+                            context.simplify_as_moment(this->bundle.os_data_ptr[diag_idx]);
+                }
 
                 for (size_t row_idx = col_idx+1; row_idx < row_length; ++row_idx) {
                     const size_t total_idx = (col_idx * row_length) + row_idx;
                     const size_t conj_idx  = (row_idx * row_length) + col_idx;
 
-                    this->bundle.alias_data_ptr[total_idx] =
-                            context.simplify_as_moment(OperatorSequence{this->bundle.os_data_ptr[total_idx]});
+                    if (factory.in_nested_block(row_idx, col_idx)) {
+                        this->bundle.alias_data_ptr[total_idx] = factory.nested_aliased_element(row_idx, col_idx);
+                    } else {
+                        this->bundle.alias_data_ptr[total_idx] =
+                                context.simplify_as_moment(OperatorSequence{this->bundle.os_data_ptr[total_idx]});
+                    }
                     // simplify_as_moment must commute with Hermitian conjugation:
                     this->bundle.alias_data_ptr[conj_idx] = this->bundle.alias_data_ptr[total_idx].conjugate();
                 }
@@ -437,6 +476,10 @@ namespace Moment {
 
     private:
         void generate_operator_sequence_matrix() {
+            Instrumentation::ScopedPhase timer{this->factory.context.instrumentation(),
+                                               Instrumentation::Phase::OSMGeneration};
+            Instrumentation::count(this->factory.context.instrumentation(), Instrumentation::Counter::OSMElements,
+                                   this->factory.numel);
 
             // Signal all workers to begin
             this->ready_to_begin_osm_generation.test_and_set(std::memory_order_release);
@@ -456,6 +499,12 @@ namespace Moment {
         }
 
         void generate_aliased_operator_sequence_matrix() {
+            Instrumentation::ScopedPhase timer{this->factory.context.instrumentation(),
+                                               Instrumentation::Phase::AliasGeneration};
+            Instrumentation::count(this->factory.context.instrumentation(),
+                                   Instrumentation::Counter::AliasedElements,
+                                   this->factory.numel);
+
             // Signal all workers to begin
             this->ready_to_begin_alias_generation.test_and_set(std::memory_order_release);
             this->ready_to_begin_alias_generation.notify_all();
@@ -57,12 +57,22 @@ namespace Moment {
 
     private:
         std::unique_ptr<os_matrix_t> make_operator_matrix() {
+            Instrumentation::ScopedPhase timer{this->factory.context.instrumentation(),
+                                               Instrumentation::Phase::OSMGeneration};
+            Instrumentation::count(this->factory.context.instrumentation(), Instrumentation::Counter::OSMElements,
+                                   this->factory.numel);
+
             // Generate unaliased matrix
             std::vector<OperatorSequence> matrix_data;
             matrix_data.reserve(this->factory.dimension * this->factory.dimension);
-            for (const auto &colSeq: *factory.colGen) {
-                for (const auto &rowSeq: *factory.rowGen) {
-                    matrix_data.emplace_back(factory.elem_functor(rowSeq, colSeq));
+            for (size_t col_idx = 0; col_idx < factory.dimension; ++col_idx) {
+                const auto &colSeq = (*factory.colGen)[col_idx];
+                for (size_t row_idx = 0; row_idx < factory.dimension; ++row_idx) {
+                    if (factory.in_nested_block(row_idx, col_idx)) {
+                        matrix_data.emplace_back(factory.nested_unaliased_element(row_idx, col_idx));
+                    } else {
+                        matrix_data.emplace_back(factory.elem_functor((*factory.rowGen)[row_idx], colSeq));
+                    }
                 }
             }
             return std::make_unique<os_matrix_t>(factory.context, factory.Index,
@@ -72,15 +82,26 @@ namespace Moment {
 
         std::unique_ptr<os_matrix_t>
         make_aliased_operator_matrix(const os_matrix_t& unaliased_matrix) {
+            Instrumentation::ScopedPhase timer{this->factory.context.instrumentation(),
+                                               Instrumentation::Phase::AliasGeneration};
+            Instrumentation::count(this->factory.context.instrumentation(),
+                                   Instrumentation::Counter::AliasedElements,
+                                   this->factory.numel);
+
             // Generate aliased operator matrix, if this could exist
             std::vector<OperatorSequence> aliased_data;
             aliased_data.reserve(this->factory.dimension * this->factory.dimension);
             const auto& context = this->factory.context;
 
-            std::transform(unaliased_matrix.cbegin(), unaliased_matrix.cend(), std::back_inserter(aliased_data),
-                            [&context](const OperatorSequence& unaliased_sequence) {
-                        return context.simplify_as_moment(unaliased_sequence);
-                    });
+            for (size_t col_idx = 0; col_idx < factory.dimension; ++col_idx) {
+                for (size_t row_idx = 0; row_idx < factory.dimension; ++row_idx) {
+                    if (factory.in_nested_block(row_idx, col_idx)) {
+                        aliased_data.emplace_back(factory.nested_aliased_element(row_idx, col_idx));
+                    } else {
+                        aliased_data.emplace_back(context.simplify_as_moment(unaliased_matrix(row_idx, col_idx)));
+                    }
+                }
+            }
             return std::make_unique<os_matrix_t>(factory.context, factory.Index, factory.dimension,
                                                  std::move(aliased_data));
         }
@@ -8,6 +8,7 @@
 #pragma once
 #include "operator_matrix.h"
 #include "operator_matrix_factory.h"
+#include "operator_matrix_regenerator.h"
 
 #include "matrix/monomial_matrix_factory.h"
 
@@ -38,6 +39,25 @@ namespace Moment {
         {functor_t::get_generators(context, an_osg_index)} -> std::same_as<const OSGPair&>;
     };
 
+    /**
+     * Regenerates operator matrices of type matrix_t, from the context and index that first generated them.
+     */
+    template<typename matrix_t, typename context_t, typename index_t>
+    class IndexedOperatorMatrixRegenerator final : public OperatorMatrixRegenerator {
+    private:
+        const context_t& context;
+        const index_t index;
+
+    public:
+        IndexedOperatorMatrixRegenerator(const context_t& context, index_t index)
+            : context{context}, index{std::move(index)} { }
+
+        [[nodiscard]] PreparedMonomialMatrix
+        operator()(Multithreading::MultiThreadPolicy mt_policy) const final {
+            return matrix_t::prepare_matrix(this->context, this->index, mt_policy);
+        }
+    };
+
     template<typename index_t, typename context_t,
             generates_operator_matrices<index_t, context_t> functor_t,
             typename matrix_t>
@@ -91,6 +111,14 @@ namespace Moment {
             return functor_t::get_generators(this->SpecializedContext, functor_t::get_osg_index(this->Index));
         }
 
+        /**
+         * Regenerates matrix from its index.
+         */
+        [[nodiscard]] std::unique_ptr<OperatorMatrixRegenerator> regenerator() const final {
+            return std::make_unique<IndexedOperatorMatrixRegenerator<matrix_t, context_t, index_t>>(
+                    this->SpecializedContext, this->Index);
+        }
+
         /**
          * Returns underlying operator matrix pointer, or a nullptr if matrix is not of a matching type.
          */
@@ -117,35 +145,39 @@ namespace Moment {
         }
 
         /**
-         * Full creation stack, with generation, symbol-registry and multithreading.
+         * Generation of operator matrices, without symbol registration.
+         * Requires only read access to the context, so can be invoked without a write lock on the matrix system.
          */
-        [[nodiscard]] static std::unique_ptr<MonomialMatrix>
-        create_matrix(const context_t& context, SymbolTable& symbols, IndexT index,
-                      Multithreading::MultiThreadPolicy mt_policy = Multithreading::MultiThreadPolicy::Optional) {
+        [[nodiscard]] static PreparedMonomialMatrix
+        prepare_matrix(const context_t& context, IndexT index,
+                       Multithreading::MultiThreadPolicy mt_policy = Multithreading::MultiThreadPolicy::Optional) {
 
             const bool should_be_hermitian = functor_t::should_be_hermitian(index);
             const std::complex<double> prefactor = functor_t::determine_prefactor(index);
 
-            // First invoke operator matrix generation
             OperatorMatrixFactory<matrix_t, context_t, index_t, functor_t>
-                    creation_factory{context, symbols, index,
+                    creation_factory{context, index,
                                      functor_t{context, index},
                                      should_be_hermitian, prefactor, mt_policy};
 
-            std::unique_ptr<matrix_t> unaliased_op_mat;
-            std::unique_ptr<matrix_t> aliased_op_mat;
             if (context.can_have_aliases()) {
                 auto pair_ptrs = creation_factory.make_aliased();
-                unaliased_op_mat = std::move(pair_ptrs.first);
-                aliased_op_mat = std::move(pair_ptrs.second);
-            } else {
-                unaliased_op_mat = creation_factory.make_unaliased();
+                return PreparedMonomialMatrix{std::move(pair_ptrs.first), std::move(pair_ptrs.second), prefactor};
             }
+            return PreparedMonomialMatrix{creation_factory.make_unaliased(), nullptr, prefactor};
+        }
 
-            // Secondly, invoke monomial matrix factory to transform op matrices into monomial matrix
-            return MonomialMatrix::register_symbols_and_create_matrix(symbols, std::move(unaliased_op_mat),
-                                                                               std::move(aliased_op_mat),
-                                                                               prefactor, mt_policy);
+        /**
+         * Full creation stack, with generation, symbol-registry and multithreading.
+         */
+        [[nodiscard]] static std::unique_ptr<MonomialMatrix>
+        create_matrix(const context_t& context, SymbolTable& symbols, IndexT index,
+                      Multithreading::MultiThreadPolicy mt_policy = Multithreading::MultiThreadPolicy::Optional) {
+            // First invoke operator matrix generation, then transform op matrices into monomial matrix
+            return MonomialMatrix::register_symbols_and_create_matrix(symbols,
+                                                                      prepare_matrix(context, std::move(index),
+                                                                                     mt_policy),
+                                                                      mt_policy);
         }
     };
 }
\ No newline at end of file
@@ -0,0 +1,31 @@
+/**
+ * operator_matrix_regenerator.h
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+#pragma once
+
+#include "matrix/prepared_monomial_matrix.h"
+
+#include "multithreading/multithreading.h"
+
+namespace Moment {
+
+    /**
+     * Recreates the operator matrices of a symbolic matrix, from the index that originally generated them.
+     * Allows operator matrices to be released once symbolized, and regenerated on demand.
+     */
+    class OperatorMatrixRegenerator {
+    public:
+        virtual ~OperatorMatrixRegenerator() noexcept = default;
+
+        /**
+         * Generate the unaliased (and, if the context can have aliases, aliased) operator matrices afresh.
+         * Requires only read access to the context.
+         * @param mt_policy Whether generation can be multithreaded.
+         */
+        [[nodiscard]] virtual PreparedMonomialMatrix
+        operator()(Multithreading::MultiThreadPolicy mt_policy) const = 0;
+    };
+}
@@ -147,6 +147,17 @@ namespace Moment {
     /**
      * Force renumbering of matrix bases keys
      */
+    size_t PolynomialMatrix::symbol_data_bytes() const noexcept {
+        size_t total = SymbolicMatrix::symbol_data_bytes();
+        if (this->sym_exp_matrix) {
+            total += sizeof(MatrixData) + this->sym_exp_matrix->ElementCount * sizeof(Polynomial);
+            for (const auto& poly : *this->sym_exp_matrix) {
+                total += poly.heap_bytes();
+            }
+        }
+        return total;
+    }
+
     void PolynomialMatrix::renumerate_bases(const SymbolTable& symbols, double zero_tolerance) {
         for (auto& polynomial : *this->sym_exp_matrix) {
             polynomial.fix_cc_in_place(symbols, true, zero_tolerance);
@@ -80,6 +80,8 @@ namespace Moment {
             return this->sym_exp_matrix->raw();
         }
 
+        [[nodiscard]] size_t symbol_data_bytes() const noexcept override;
+
         /**
          * Force renumbering of matrix bases keys
          */
@@ -0,0 +1,25 @@
+/**
+ * prepared_monomial_matrix.cpp
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+#include "prepared_monomial_matrix.h"
+
+#include "operator_matrix/operator_matrix.h"
+
+namespace Moment {
+    PreparedMonomialMatrix::PreparedMonomialMatrix() noexcept = default;
+
+    PreparedMonomialMatrix::PreparedMonomialMatrix(std::unique_ptr<OperatorMatrix> unaliased,
+                                                   std::unique_ptr<OperatorMatrix> aliased,
+                                                   const std::complex<double> prefactor) noexcept
+        : unaliased_operator_matrix{std::move(unaliased)}, aliased_operator_matrix{std::move(aliased)},
+          prefactor{prefactor} { }
+
+    PreparedMonomialMatrix::PreparedMonomialMatrix(PreparedMonomialMatrix&& rhs) noexcept = default;
+
+    PreparedMonomialMatrix& PreparedMonomialMatrix::operator=(PreparedMonomialMatrix&& rhs) noexcept = default;
+
+    PreparedMonomialMatrix::~PreparedMonomialMatrix() noexcept = default;
+}
@@ -0,0 +1,60 @@
+/**
+ * prepared_monomial_matrix.h
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+#pragma once
+
+#include <complex>
+#include <cstddef>
+#include <memory>
+
+namespace Moment {
+
+    class MonomialMatrix;
+    class OperatorMatrix;
+
+    /**
+     * Operator matrices that have been generated, but whose sequences have not yet been registered as symbols.
+     * Generation requires only the context, so can take place without exclusive access to the matrix system.
+     */
+    struct PreparedMonomialMatrix {
+        /** Operator matrix, before aliasing. */
+        std::unique_ptr<OperatorMatrix> unaliased_operator_matrix;
+
+        /** Operator matrix, after aliasing (or nullptr if context cannot have aliases). */
+        std::unique_ptr<OperatorMatrix> aliased_operator_matrix;
+
+        /** Global prefactor linking operator matrix to monomial matrix. */
+        std::complex<double> prefactor = 1.0;
+
+        /**
+         * Previously registered matrix, whose elements form the top-left block of the prepared matrix (or nullptr).
+         * If set, symbols in this block are copied rather than looked up again.
+         */
+        const MonomialMatrix* nested_matrix = nullptr;
+
+        /**
+         * Offset of nested_matrix within the matrix system that owns it (or -1 if unknown).
+         * Used to verify that the nested matrix still exists when the prepared matrix is registered.
+         */
+        ptrdiff_t nested_offset = -1;
+
+        PreparedMonomialMatrix() noexcept;
+
+        PreparedMonomialMatrix(std::unique_ptr<OperatorMatrix> unaliased, std::unique_ptr<OperatorMatrix> aliased,
+                               std::complex<double> prefactor = 1.0) noexcept;
+
+        PreparedMonomialMatrix(PreparedMonomialMatrix&& rhs) noexcept;
+
+        PreparedMonomialMatrix& operator=(PreparedMonomialMatrix&& rhs) noexcept;
+
+        ~PreparedMonomialMatrix() noexcept;
+
+        /** True if nothing was prepared (i.e. creation must happen entirely under the write lock). */
+        [[nodiscard]] bool empty() const noexcept {
+            return !this->unaliased_operator_matrix;
+        }
+    };
+}
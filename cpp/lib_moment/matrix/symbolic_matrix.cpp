@@ -9,6 +9,9 @@
 
 #include "matrix_system/matrix_system.h"
 #include "operator_matrix/operator_matrix.h"
+#include "operator_matrix/operator_matrix_regenerator.h"
+
+#include "utilities/memory_footprint.h"
 
 #include <iostream>
 
@@ -25,8 +28,8 @@ namespace Moment {
     SymbolicMatrix::~SymbolicMatrix() noexcept = default;
 
     bool SymbolicMatrix::has_aliased_operator_matrix() const noexcept {
-        // If we have it, simply return yes
-        if (this->aliased_op_mat) {
+        // If we have it (or can regenerate it), simply return yes
+        if (this->op_mat_regenerator || this->aliased_op_mat) {
             return true;
         }
 
@@ -39,6 +42,9 @@ namespace Moment {
     }
 
     const OperatorMatrix& SymbolicMatrix::unaliased_operator_matrix() const {
+        if (this->op_mat_regenerator) {
+            this->regenerate_operator_matrices();
+        }
         if (!this->unaliased_op_mat) {
             throw errors::missing_component{"No operator matrix defined for this matrix."};
         }
@@ -46,6 +52,10 @@ namespace Moment {
     }
 
     const OperatorMatrix& SymbolicMatrix::aliased_operator_matrix() const {
+        if (this->op_mat_regenerator) {
+            this->regenerate_operator_matrices();
+        }
+
         // If we have it, simplify return it
         if (this->aliased_op_mat) {
             return *this->aliased_op_mat;
@@ -60,6 +70,77 @@ namespace Moment {
         return this->unaliased_operator_matrix();
     }
 
+    namespace {
+        [[nodiscard]] size_t operator_matrix_footprint(const OperatorMatrix& op_matrix) noexcept {
+            size_t total = sizeof(OperatorMatrix) + op_matrix.ElementCount * sizeof(OperatorSequence);
+            for (const auto& sequence : op_matrix) {
+                total += sequence.heap_bytes();
+            }
+            return total;
+        }
+    }
+
+    bool SymbolicMatrix::operator_matrices_released() const noexcept {
+        std::lock_guard guard{this->op_mat_mutex};
+        return this->op_mat_regenerator && !this->unaliased_op_mat;
+    }
+
+    size_t SymbolicMatrix::release_operator_matrices() {
+        std::lock_guard guard{this->op_mat_mutex};
+        if (!this->unaliased_op_mat) {
+            return 0;
+        }
+
+        // Matrices can only be released if they can be made again
+        if (!this->op_mat_regenerator) {
+            this->op_mat_regenerator = this->unaliased_op_mat->regenerator();
+            if (!this->op_mat_regenerator) {
+                return 0;
+            }
+        }
+
+        size_t released = operator_matrix_footprint(*this->unaliased_op_mat);
+        if (this->aliased_op_mat) {
+            released += operator_matrix_footprint(*this->aliased_op_mat);
+        }
+        this->unaliased_op_mat.reset();
+        this->aliased_op_mat.reset();
+        return released;
+    }
+
+    void SymbolicMatrix::regenerate_operator_matrices(const Multithreading::MultiThreadPolicy mt_policy) const {
+        std::lock_guard guard{this->op_mat_mutex};
+        if (this->unaliased_op_mat || !this->op_mat_regenerator) {
+            return;
+        }
+
+        auto prepared = (*this->op_mat_regenerator)(mt_policy);
+        assert(prepared.unaliased_operator_matrix);
+        assert(prepared.unaliased_operator_matrix->Dimension() == this->dimension);
+        this->unaliased_op_mat = std::move(prepared.unaliased_operator_matrix);
+        this->aliased_op_mat = std::move(prepared.aliased_operator_matrix);
+    }
+
+    size_t SymbolicMatrix::operator_matrix_bytes() const noexcept {
+        std::lock_guard guard{this->op_mat_mutex};
+        size_t total = 0;
+        if (this->unaliased_op_mat) {
+            total += operator_matrix_footprint(*this->unaliased_op_mat);
+        }
+        if (this->aliased_op_mat) {
+            total += operator_matrix_footprint(*this->aliased_op_mat);
+        }
+        return total;
+    }
+
+    size_t SymbolicMatrix::symbol_data_bytes() const noexcept {
+        return this->description.capacity()
+               + Memory::container_bytes(this->included_symbols)
+               + Memory::container_bytes(this->real_basis_elements)
+               + Memory::container_bytes(this->imaginary_basis_elements)
+               + Memory::container_bytes(this->basis_key);
+    }
+
     void SymbolicMatrix::throw_error_if_cannot_multiply() const {
         // Get operator matrix
         if (!this->has_unaliased_operator_matrix()) {
@@ -19,6 +19,7 @@
 #include <iosfwd>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <vector>
@@ -28,6 +29,7 @@ namespace Moment {
     class Context;
     struct Monomial;
     class OperatorMatrix;
+    class OperatorMatrixRegenerator;
     class OperatorSequence;
     class Polynomial;
     class PolynomialFactory;
@@ -104,11 +106,18 @@ namespace Moment {
         /** Map from included symbols IDs to basis indices. */
         std::map<symbol_name_t, std::pair<ptrdiff_t, ptrdiff_t>> basis_key;
 
-        /** Operator matrix, if set - (may be null) */
-        std::unique_ptr<OperatorMatrix> unaliased_op_mat;
+        /** Operator matrix, if set - (may be null, or released pending regeneration) */
+        mutable std::unique_ptr<OperatorMatrix> unaliased_op_mat;
 
-        /** Aliased operator matrix, if set - (may be null) */
-        std::unique_ptr<OperatorMatrix> aliased_op_mat;
+        /** Aliased operator matrix, if set - (may be null, or released pending regeneration) */
+        mutable std::unique_ptr<OperatorMatrix> aliased_op_mat;
+
+    private:
+        /** Source of operator matrices, if they have been released (otherwise null). */
+        std::unique_ptr<OperatorMatrixRegenerator> op_mat_regenerator;
+
+        /** Guards regeneration of released operator matrices. */
+        mutable std::mutex op_mat_mutex;
 
     public:
         friend class MatrixBasis;
@@ -180,9 +189,9 @@ namespace Moment {
             return this->basis_key;
         }
 
-        /**  True if matrix has operator matrix. */
+        /**  True if matrix has operator matrix (possibly released, but regenerable on demand). */
         [[nodiscard]] bool has_unaliased_operator_matrix() const noexcept {
-            return static_cast<bool>(this->unaliased_op_mat);
+            return this->op_mat_regenerator || this->unaliased_op_mat;
         }
 
         /**  True if matrix has aliased operator matrix (or there is no aliasing). */
@@ -191,6 +200,7 @@ namespace Moment {
          /**
           * Gets unaliased operator matrix.
           * Operator sequences should be interpreted as operators.
+          * If operator matrices were released, they are first regenerated.
           * @throws errors::missing_component if no operator matrix defined for this matrix.
           */
          [[nodiscard]] const OperatorMatrix& unaliased_operator_matrix() const;
@@ -198,10 +208,46 @@ namespace Moment {
          /**
           * Gets operator matrix, with any aliasing (if applicable).
           * Operator sequences should be interpreted as moments.
+          * If operator matrices were released, they are first regenerated.
           * @throws errors::missing_component if no operator matrix defined for this matrix.
           */
          [[nodiscard]] const OperatorMatrix& aliased_operator_matrix() const;
 
+         /**
+          * True if operator matrices have been released, and will be regenerated when next requested.
+          */
+         [[nodiscard]] bool operator_matrices_released() const noexcept;
+
+         /**
+          * Free operator matrices, keeping only the index that generated them, so they can be regenerated on demand.
+          * Matrices whose operator matrices were not generated from an index (e.g. products) are left unchanged.
+          * Invalidates references to operator matrices.
+          * For thread safety, call for a write lock on the matrix system first.
+          * @return Approximate bytes released.
+          */
+         size_t release_operator_matrices();
+
+         /**
+          * Regenerate released operator matrices now, rather than on next request. Does nothing if not released.
+          * For thread safety, call for a read lock on the matrix system first.
+          * @param mt_policy Whether generation can be multithreaded.
+          */
+         void regenerate_operator_matrices(Multithreading::MultiThreadPolicy mt_policy
+                                                = Multithreading::MultiThreadPolicy::Optional) const;
+
+         /**
+          * Approximate bytes used by the operator matrices (unaliased and aliased) owned by this matrix.
+          * For thread safety, call for a read lock on the matrix system first.
+          */
+         [[nodiscard]] size_t operator_matrix_bytes() const noexcept;
+
+         /**
+          * Approximate bytes used by the symbolic representation of this matrix, and its symbol bookkeeping.
+          * Does not include operator matrices or cached bases.
+          * For thread safety, call for a read lock on the matrix system first.
+          */
+         [[nodiscard]] virtual size_t symbol_data_bytes() const noexcept;
+
          /**
           * True if matrix is defined in terms of monomial symbols.
           */
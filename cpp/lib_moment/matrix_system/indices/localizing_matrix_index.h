@@ -24,7 +24,7 @@ namespace Moment {
     public:
         size_t Level;
         OperatorSequence Word;
-        size_t WordHash;
+        hash_t WordHash;
 
     public:
         LocalizingMatrixIndex(size_t level, OperatorSequence word)
@@ -17,11 +17,21 @@
 #include "multithreading/maintains_mutex.h"
 #include "multithreading/multithreading.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <concepts>
+#include <condition_variable>
+#include <exception>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <span>
 #include <string>
+#include <thread>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 namespace Moment {
     class SymbolicMatrix;
@@ -54,6 +64,33 @@ namespace Moment {
             {factory.notify(write_lock, index, offset, matrix_ref)};
         };
 
+    /**
+     * Concept: matrix factory that can split creation into a generation phase (requiring only a read lock), and a
+     * registration phase (requiring a write lock).
+     */
+    template<typename factory_t, typename matrix_t, typename index_t>
+    concept prepares_matrices = makes_matrices<factory_t, matrix_t, index_t> &&
+        std::is_nothrow_move_constructible_v<typename factory_t::Prepared> &&
+        requires (factory_t& factory, const index_t& index, typename factory_t::Prepared& prepared,
+                  const MaintainsMutex::ReadLock& read_lock, const MaintainsMutex::WriteLock& write_lock,
+                  const Multithreading::MultiThreadPolicy& mt_policy) {
+            {factory.prepare(read_lock, index, mt_policy)} -> std::convertible_to<typename factory_t::Prepared>;
+            {factory(write_lock, index, std::move(prepared), mt_policy)}
+                -> std::convertible_to<std::pair<ptrdiff_t, matrix_t&>>;
+        };
+
+    /**
+     * Concept: matrix factory that can prepare matrices, and also register a whole batch of prepared matrices at once.
+     */
+    template<typename factory_t, typename matrix_t, typename index_t>
+    concept prepares_matrix_batches = prepares_matrices<factory_t, matrix_t, index_t> &&
+        requires (factory_t& factory, const std::vector<const index_t*>& indices,
+                  std::vector<typename factory_t::Prepared>& prepared,
+                  const MaintainsMutex::WriteLock& write_lock, const Multithreading::MultiThreadPolicy& mt_policy) {
+            {factory(write_lock, indices, std::move(prepared), mt_policy)}
+                -> std::convertible_to<std::vector<std::pair<ptrdiff_t, matrix_t&>>>;
+        };
+
     /**
      * Generic type, allows for access of a subset of MatrixSystem matrices via a subset-specific index.
      * @tparam matrix_t The matrix type.
@@ -83,6 +120,39 @@ namespace Moment {
         IndexStorage indices;
         FactoryType matrixFactory;
 
+        /** Guards the set of pending indices. */
+        std::mutex pending_mutex;
+
+        /** Signalled whenever a pending index is released. */
+        std::condition_variable pending_cv;
+
+        /** Indices of matrices currently being generated outside of the write lock. */
+        std::set<index_t> pending;
+
+        /** Claim on pending indices; on destruction, releases the indices and wakes waiting requests. */
+        class PendingClaim {
+        private:
+            MatrixIndices& owner;
+            std::vector<const index_t*> claimed;
+        public:
+            PendingClaim(MatrixIndices& owner, const index_t& index) : owner{owner}, claimed{&index} { }
+            PendingClaim(MatrixIndices& owner, std::vector<const index_t*> indices)
+                : owner{owner}, claimed{std::move(indices)} { }
+            PendingClaim(const PendingClaim& rhs) = delete;
+            ~PendingClaim() noexcept {
+                if (this->claimed.empty()) {
+                    return;
+                }
+                {
+                    std::lock_guard pending_lock{owner.pending_mutex};
+                    for (const auto* index_ptr : this->claimed) {
+                        owner.pending.erase(*index_ptr);
+                    }
+                }
+                owner.pending_cv.notify_all();
+            }
+        };
+
     public:
         template<typename... Args>
         explicit MatrixIndices(matrix_system_t& system, IndexStorage&& index, Args&&... args)
@@ -105,10 +175,15 @@ namespace Moment {
          */
         [[nodiscard]] std::pair<size_t, matrix_t&>
         create(const index_t& index, const MTPolicy mt_policy = MTPolicy::Optional) {
-            // Get write lock from factory.
-            auto lock = this->system.get_write_lock();
-            return this->create(lock, index, mt_policy);
-            //~ releases lock
+            // If possible, generate matrix outside of write lock
+            if constexpr (prepares_matrices<factory_t, matrix_t, index_t>) {
+                return this->create_concurrently(index, mt_policy);
+            } else {
+                // Get write lock from factory.
+                auto lock = this->system.get_write_lock();
+                return this->create(lock, index, mt_policy);
+                //~ releases lock
+            }
         }
 
         /**
@@ -126,28 +201,128 @@ namespace Moment {
             //  double-checked locking paradigm, as the matrix might have been created in a race].
             auto existing = this->indices.find(index);
             if (existing >= 0) {
-                try {
-                    if constexpr (std::is_same_v<MatrixType, Moment::SymbolicMatrix>) {
-                        return std::pair<size_t, MatrixType&>{static_cast<size_t>(existing), this->system.get(existing)};
-                    } else {
+                return std::pair<size_t, MatrixType&>{static_cast<size_t>(existing), this->existing_matrix(existing)};
+            }
+
+            // Otherwise, call factory to actually handle insertion into system.
+            auto [matrix_offset, matrix_ref] = matrixFactory(lock, index, mt_policy);
+            return this->register_new_matrix(lock, index, matrix_offset, matrix_ref);
+        }
+
+        /**
+         * Create matrix with requested index, or retrieve if already existing.
+         * The expensive generation of the matrix takes place under a read lock, so that independent matrices can be
+         * generated concurrently; the write lock is only taken to register symbols and the finished matrix.
+         * Concurrent requests for the same index wait for the first request to finish, rather than repeating work.
+         * @param index The description of the matrix.
+         * @param mt_policy The multi-threaded policy for creation.
+         * @return Offset of the matrix within the matrix system, and reference to the matrix.
+         */
+        [[nodiscard]] std::pair<size_t, matrix_t&>
+        create_concurrently(const index_t& index, const MTPolicy mt_policy = MTPolicy::Optional)
+                requires prepares_matrices<factory_t, matrix_t, index_t> {
+            // Claim index, or wait for concurrent generation of the same index to finish
+            while (true) {
+                {
+                    auto read_lock = this->system.get_read_lock();
+                    auto existing = this->indices.find(index);
+                    if (existing >= 0) {
                         return std::pair<size_t, MatrixType&>{static_cast<size_t>(existing),
-                                                              dynamic_cast<MatrixType &>(this->system.get(existing))};
+                                                              this->existing_matrix(existing)};
                     }
-                } catch (const errors::missing_component& mce) {
-                    throw std::runtime_error{"Index for matrix was found, but matrix was invalid."};
-                } catch (const std::bad_cast& bad_cast) {
-                    throw std::runtime_error{"Index for matrix was found, but matrix was of invalid type."};
                 }
+
+                std::unique_lock pending_lock{this->pending_mutex};
+                if (this->pending.insert(index).second) {
+                    break;
+                }
+                this->pending_cv.wait(pending_lock, [this, &index]() { return !this->pending.contains(index); });
             }
+            PendingClaim claim{*this, index};
 
-            // Otherwise, call factory to actually handle insertion into system.
-            auto [matrix_offset, matrix_ref] = matrixFactory(lock, index, mt_policy);
-            const auto [actual_offset, did_insertion] = this->indices.insert(index, matrix_offset);
-            assert(actual_offset == matrix_offset);
-            assert(did_insertion);
-            matrixFactory.notify(lock, index, actual_offset, matrix_ref);
+            // Generate matrix, allowing other readers (and generators)
+            typename factory_t::Prepared prepared;
+            {
+                auto read_lock = this->system.get_read_lock();
+                prepared = matrixFactory.prepare(read_lock, index, mt_policy);
+            }
 
-            return std::pair<size_t, matrix_t&>{static_cast<size_t>(matrix_offset), matrix_ref};
+            // Register matrix [NB: the matrix might have been created in a race, by a call holding the write lock].
+            auto write_lock = this->system.get_write_lock();
+            auto existing = this->indices.find(index);
+            if (existing >= 0) {
+                return std::pair<size_t, MatrixType&>{static_cast<size_t>(existing), this->existing_matrix(existing)};
+            }
+            auto [matrix_offset, matrix_ref] = matrixFactory(write_lock, index, std::move(prepared), mt_policy);
+            return this->register_new_matrix(write_lock, index, matrix_offset, matrix_ref);
+            // ~write_lock, then ~claim
+        }
+
+        /**
+         * Create a batch of matrices, or retrieve those already existing.
+         * Operator matrices for every missing index are generated under one read lock, in parallel (one matrix per
+         * worker at a time) if the policy allows, then all are registered under one write lock. Thus, the system is
+         * notified of new symbols only once for the whole batch.
+         * @param batch The descriptions of the matrices.
+         * @param mt_policy The multi-threaded policy for creation.
+         * @return Offsets and references to the matrices, in the same order as the requested indices.
+         */
+        [[nodiscard]] std::vector<std::pair<size_t, matrix_t&>>
+        create_batch(std::span<const index_t> batch, const MTPolicy mt_policy = MTPolicy::Optional)
+                requires prepares_matrix_batches<factory_t, matrix_t, index_t> {
+
+            // Claim every index not yet created, nor being created by another request (or earlier in batch)
+            std::vector<const index_t*> to_create;
+            {
+                auto read_lock = this->system.get_read_lock();
+                std::lock_guard pending_lock{this->pending_mutex};
+                for (const auto& index : batch) {
+                    if ((this->indices.find(index) < 0) && this->pending.insert(index).second) {
+                        to_create.emplace_back(&index);
+                    }
+                }
+            }
+
+            if (!to_create.empty()) {
+                PendingClaim claim{*this, to_create};
+
+                // Generate operator matrices, allowing other readers (and generators)
+                std::vector<typename factory_t::Prepared> prepared(to_create.size());
+                {
+                    auto read_lock = this->system.get_read_lock();
+                    this->prepare_batch(read_lock, to_create, prepared, mt_policy);
+                }
+
+                // Register matrices [NB: some might have been created in a race, by a call holding the write lock].
+                auto write_lock = this->system.get_write_lock();
+                std::vector<const index_t*> to_register;
+                std::vector<typename factory_t::Prepared> to_register_prepared;
+                to_register.reserve(to_create.size());
+                to_register_prepared.reserve(to_create.size());
+                for (size_t batch_index = 0; batch_index < to_create.size(); ++batch_index) {
+                    if (this->indices.find(*to_create[batch_index]) < 0) {
+                        to_register.emplace_back(to_create[batch_index]);
+                        to_register_prepared.emplace_back(std::move(prepared[batch_index]));
+                    }
+                }
+                auto new_matrices = matrixFactory(write_lock, to_register, std::move(to_register_prepared),
+                                                  mt_policy);
+                assert(new_matrices.size() == to_register.size());
+                for (size_t batch_index = 0; batch_index < to_register.size(); ++batch_index) {
+                    auto& [matrix_offset, matrix_ref] = new_matrices[batch_index];
+                    std::ignore = this->register_new_matrix(write_lock, *to_register[batch_index],
+                                                            matrix_offset, matrix_ref);
+                }
+                // ~write_lock, then ~claim
+            }
+
+            // Gather (waiting on any indices that are being created by other requests)
+            std::vector<std::pair<size_t, matrix_t&>> output;
+            output.reserve(batch.size());
+            for (const auto& index : batch) {
+                output.emplace_back(this->create_concurrently(index, mt_policy));
+            }
+            return output;
         }
 
         /**
@@ -206,24 +381,90 @@ namespace Moment {
             auto read_lock = this->system.get_read_lock();
             auto existing_index = this->indices.find(index);
             if (existing_index >= 0) {
-                try {
-                    if constexpr (std::is_same_v<MatrixType, Moment::SymbolicMatrix>) {
-                        return this->system.get(existing_index);
-                    } else {
-                        return dynamic_cast<MatrixType&>(this->system.get(existing_index));
-                    }
-                } catch (const errors::missing_component& mce) {
-                    throw std::runtime_error{"Index for matrix was found, but matrix was invalid."};
-                } catch (const std::bad_cast& bad_cast) {
-                    throw std::runtime_error{"Index for matrix was found, but matrix was of invalid type."};
-                }
+                return this->existing_matrix(existing_index);
             }
 
             // Did not find with read lock, so move on to creation:
             read_lock.unlock();
-            auto write_lock = this->system.get_write_lock();
-            auto [offset, matrix] = this->create(write_lock, index, mt_policy);
-            return matrix; // ~write_lock
+            auto [offset, matrix] = this->create(index, mt_policy);
+            return matrix;
+        }
+
+    private:
+        /**
+         * Prepare operator matrices for a batch of indices, distributing matrices between workers if policy allows.
+         */
+        template<typename prepared_t>
+        void prepare_batch(const MaintainsMutex::ReadLock& read_lock, const std::vector<const index_t*>& to_create,
+                           std::vector<prepared_t>& prepared, const MTPolicy mt_policy)
+                requires prepares_matrices<factory_t, matrix_t, index_t> {
+            assert(to_create.size() == prepared.size());
+            const size_t worker_count = std::min(Multithreading::get_max_worker_threads(), to_create.size());
+            if ((worker_count <= 1) || !Multithreading::should_multithread_matrix_batch(mt_policy, to_create.size())) {
+                for (size_t batch_index = 0; batch_index < to_create.size(); ++batch_index) {
+                    prepared[batch_index] = matrixFactory.prepare(read_lock, *to_create[batch_index], mt_policy);
+                }
+                return;
+            }
+
+            // Each worker takes the next unprepared matrix, and prepares it single-threaded
+            std::atomic<size_t> next_matrix{0};
+            std::vector<std::exception_ptr> errors(worker_count);
+            std::vector<std::thread> workers;
+            workers.reserve(worker_count);
+            for (size_t worker_id = 0; worker_id < worker_count; ++worker_id) {
+                workers.emplace_back([&, worker_id]() {
+                    try {
+                        for (size_t batch_index = next_matrix++; batch_index < to_create.size();
+                             batch_index = next_matrix++) {
+                            prepared[batch_index] = matrixFactory.prepare(read_lock, *to_create[batch_index],
+                                                                          MTPolicy::Never);
+                        }
+                    } catch (...) {
+                        errors[worker_id] = std::current_exception();
+                        next_matrix = to_create.size();
+                    }
+                });
+            }
+            for (auto& worker : workers) {
+                worker.join();
+            }
+            for (const auto& error : errors) {
+                if (error) {
+                    std::rethrow_exception(error);
+                }
+            }
+        }
+
+        /**
+         * Get matrix at offset, which is known to be indexed.
+         */
+        [[nodiscard]] MatrixType& existing_matrix(const ptrdiff_t offset) {
+            try {
+                if constexpr (std::is_same_v<MatrixType, Moment::SymbolicMatrix>) {
+                    return this->system.get(offset);
+                } else {
+                    return dynamic_cast<MatrixType&>(this->system.get(offset));
+                }
+            } catch (const errors::missing_component& mce) {
+                throw std::runtime_error{"Index for matrix was found, but matrix was invalid."};
+            } catch (const std::bad_cast& bad_cast) {
+                throw std::runtime_error{"Index for matrix was found, but matrix was of invalid type."};
+            }
+        }
+
+        /**
+         * Index newly created matrix, notify system of its creation, then apply operator matrix retention policy.
+         */
+        std::pair<size_t, matrix_t&> register_new_matrix(const MaintainsMutex::WriteLock& lock, const index_t& index,
+                                                         const ptrdiff_t matrix_offset, matrix_t& matrix_ref) {
+            const auto [actual_offset, did_insertion] = this->indices.insert(index, matrix_offset);
+            assert(actual_offset == matrix_offset);
+            assert(did_insertion);
+            matrixFactory.notify(lock, index, actual_offset, matrix_ref);
+            this->system.apply_operator_matrix_retention(lock, matrix_ref);
+
+            return std::pair<size_t, matrix_t&>{static_cast<size_t>(matrix_offset), matrix_ref};
         }
 
     };
@@ -11,6 +11,7 @@
 #include "dictionary/raw_polynomial.h"
 #include "dictionary/dictionary.h"
 
+#include "matrix/monomial_matrix.h"
 #include "matrix/operator_matrix/localizing_matrix.h"
 #include "matrix/operator_matrix/moment_matrix.h"
 #include "matrix/polynomial_localizing_matrix.h"
@@ -47,6 +48,72 @@ namespace Moment {
 
     MatrixSystem::~MatrixSystem() noexcept = default;
 
+    Instrumentation::Recorder& MatrixSystem::instrumentation() const noexcept {
+        return this->context->instrumentation();
+    }
+
+    MemoryReport MatrixSystem::memory_report() const {
+        auto read_lock = this->get_read_lock();
+
+        MemoryReport report;
+        report.matrices.reserve(this->matrices.size());
+        for (size_t index = 0; index < this->matrices.size(); ++index) {
+            const auto& matrix_ptr = this->matrices[index];
+            if (!matrix_ptr) {
+                continue;
+            }
+            auto& usage = report.matrices.emplace_back();
+            usage.index = static_cast<ptrdiff_t>(index);
+            usage.description = matrix_ptr->Description();
+            usage.operator_matrices = matrix_ptr->operator_matrix_bytes();
+            usage.symbol_data = matrix_ptr->symbol_data_bytes();
+            usage.bases = matrix_ptr->Basis.memory_footprint();
+        }
+
+        report.dictionary = this->context->dictionary().memory_footprint();
+        report.symbol_table = this->symbol_table->memory_footprint();
+        report.rulebooks = this->Rulebook.memory_footprint();
+        return report;
+    }
+
+    size_t MatrixSystem::drop_caches(const MemoryComponent component) {
+        auto write_lock = this->get_write_lock();
+
+        size_t released = 0;
+        switch (component) {
+            case MemoryComponent::Bases:
+                for (auto& matrix_ptr : this->matrices) {
+                    if (matrix_ptr) {
+                        released += matrix_ptr->Basis.drop_cache();
+                    }
+                }
+                break;
+            case MemoryComponent::OperatorMatrices:
+                for (auto& matrix_ptr : this->matrices) {
+                    if (matrix_ptr) {
+                        released += matrix_ptr->release_operator_matrices();
+                    }
+                }
+                break;
+            default:
+                break;
+        }
+        return released;
+    }
+
+    void MatrixSystem::set_operator_matrix_retention(const OperatorMatrixRetention retention) {
+        auto write_lock = this->get_write_lock();
+        this->op_matrix_retention = retention;
+    }
+
+    size_t MatrixSystem::apply_operator_matrix_retention(const WriteLock& lock, SymbolicMatrix& matrix) {
+        assert(this->is_locked_write_lock(lock));
+        if (this->op_matrix_retention != OperatorMatrixRetention::Release) {
+            return 0;
+        }
+        return matrix.release_operator_matrices();
+    }
+
     size_t MatrixSystem::osg_size(size_t level) const {
         if (this->context->defines_operators()) [[likely]] {
             return this->context->dictionary().WordCount(level);
@@ -93,7 +160,7 @@ namespace Moment {
     bool MatrixSystem::delete_matrix(const MaintainsMutex::WriteLock& lock, ptrdiff_t index) noexcept {
         assert(this->is_locked_write_lock(lock));
         // No deletion for bad index
-        if ((index < 0) || (index > this->matrices.size())) {
+        if ((index < 0) || (static_cast<size_t>(index) >= this->matrices.size())) {
             return false;
         }
         // No deletion for missing matrix
@@ -101,6 +168,9 @@ namespace Moment {
             return false;
         }
 
+        // Let derived classes discard anything they associate with the matrix
+        this->on_matrix_deleted(lock, index, *this->matrices[index]);
+
         // Call matrix destructor, and flag that deletion occurred
         this->matrices[index].reset();
         return true;
@@ -111,28 +181,126 @@ namespace Moment {
     MatrixSystem::create_moment_matrix(const MaintainsMutex::WriteLock& lock,
                                        const size_t level, const Multithreading::MultiThreadPolicy mt_policy) {
         assert(this->is_locked_write_lock(lock));
-        const size_t prev_symbol_count = this->symbol_table->size();
-        auto ptr = MomentMatrix::create_matrix(*this->context, *this->symbol_table, level, mt_policy);
-        const size_t new_symbol_count = this->symbol_table->size();
-        if (new_symbol_count > prev_symbol_count) {
-            this->on_new_symbols_registered(lock, prev_symbol_count, new_symbol_count);
-        }
-        return ptr;
+        return this->register_prepared_matrix(lock, this->prepare_moment_matrix_over_nested(level, mt_policy),
+                                              mt_policy);
     }
 
-
     std::unique_ptr<class SymbolicMatrix>
     MatrixSystem::create_localizing_matrix(const WriteLock& lock,
                                            const LocalizingMatrixIndex& lmi,
                                            Multithreading::MultiThreadPolicy mt_policy) {
         assert(this->is_locked_write_lock(lock));
+        return this->register_prepared_matrix(lock, LocalizingMatrix::prepare_matrix(*this->context, lmi, mt_policy),
+                                              mt_policy);
+    }
+
+    PreparedMonomialMatrix
+    MatrixSystem::prepare_moment_matrix(const ReadLock& lock, const size_t level,
+                                        const Multithreading::MultiThreadPolicy mt_policy) {
+        assert(this->is_locked_read_lock(lock));
+        return this->prepare_moment_matrix_over_nested(level, mt_policy);
+    }
+
+    PreparedMonomialMatrix
+    MatrixSystem::prepare_localizing_matrix(const ReadLock& lock, const LocalizingMatrixIndex& lmi,
+                                            const Multithreading::MultiThreadPolicy mt_policy) {
+        assert(this->is_locked_read_lock(lock));
+        return LocalizingMatrix::prepare_matrix(*this->context, lmi, mt_policy);
+    }
+
+    std::unique_ptr<MonomialMatrix>
+    MatrixSystem::register_prepared_matrix(const WriteLock& lock, PreparedMonomialMatrix&& prepared,
+                                           const Multithreading::MultiThreadPolicy mt_policy) {
+        assert(this->is_locked_write_lock(lock));
+        this->check_nested_matrix(lock, prepared);
+        const size_t prev_symbol_count = this->symbol_table->size();
+        std::unique_ptr<MonomialMatrix> ptr;
+        try {
+            ptr = MonomialMatrix::register_symbols_and_create_matrix(*this->symbol_table, std::move(prepared),
+                                                                     mt_policy);
+        } catch (...) {
+            // Symbols registered before the failure must still be announced
+            this->notify_new_symbols_since(lock, prev_symbol_count);
+            throw;
+        }
+        this->notify_new_symbols_since(lock, prev_symbol_count);
+        return ptr;
+    }
+
+    std::vector<std::unique_ptr<MonomialMatrix>>
+    MatrixSystem::register_prepared_matrices(const WriteLock& lock, std::vector<PreparedMonomialMatrix>&& prepared,
+                                             const Multithreading::MultiThreadPolicy mt_policy) {
+        assert(this->is_locked_write_lock(lock));
         const size_t prev_symbol_count = this->symbol_table->size();
-        auto ptr = LocalizingMatrix::create_matrix(*this->context, *this->symbol_table, lmi, mt_policy);
+        std::vector<std::unique_ptr<MonomialMatrix>> output;
+        output.reserve(prepared.size());
+        try {
+            for (auto& prepared_matrix : prepared) {
+                this->check_nested_matrix(lock, prepared_matrix);
+                output.emplace_back(MonomialMatrix::register_symbols_and_create_matrix(*this->symbol_table,
+                                                                                       std::move(prepared_matrix),
+                                                                                       mt_policy));
+            }
+        } catch (...) {
+            // Symbols registered by matrices before the failure must still be announced
+            this->notify_new_symbols_since(lock, prev_symbol_count);
+            throw;
+        }
+        this->notify_new_symbols_since(lock, prev_symbol_count);
+        return output;
+    }
+
+    void MatrixSystem::notify_new_symbols_since(const WriteLock& lock, const size_t prev_symbol_count) {
         const size_t new_symbol_count = this->symbol_table->size();
         if (new_symbol_count > prev_symbol_count) {
             this->on_new_symbols_registered(lock, prev_symbol_count, new_symbol_count);
         }
-        return ptr;
+    }
+
+    std::pair<ptrdiff_t, const MonomialMatrix*>
+    MatrixSystem::find_nested_moment_matrix(const size_t level) const noexcept {
+        for (size_t nested_level = level; nested_level > 0; --nested_level) {
+            const ptrdiff_t offset = this->MomentMatrix.find_index(nested_level - 1);
+            if ((offset < 0) || (static_cast<size_t>(offset) >= this->matrices.size()) || !this->matrices[offset]) {
+                continue;
+            }
+            const auto* nested_matrix = dynamic_cast<const MonomialMatrix*>(this->matrices[offset].get());
+            // Released operator matrices would have to be regenerated in full, so offer no saving
+            if ((nested_matrix != nullptr) && nested_matrix->has_unaliased_operator_matrix()
+                && !nested_matrix->operator_matrices_released()) {
+                return {offset, nested_matrix};
+            }
+        }
+        return {-1, nullptr};
+    }
+
+    PreparedMonomialMatrix
+    MatrixSystem::prepare_moment_matrix_over_nested(const size_t level,
+                                                    const Multithreading::MultiThreadPolicy mt_policy) const {
+        const auto [nested_offset, nested_matrix] = this->find_nested_moment_matrix(level);
+        if (nested_matrix == nullptr) {
+            return MomentMatrix::prepare_matrix(*this->context, level, mt_policy);
+        }
+        auto prepared = MomentMatrix::prepare_nested_matrix(*this->context, level, *nested_matrix, mt_policy);
+        if (prepared.nested_matrix != nullptr) {
+            prepared.nested_offset = nested_offset;
+        }
+        return prepared;
+    }
+
+    void MatrixSystem::check_nested_matrix(const WriteLock& lock, PreparedMonomialMatrix& prepared) const noexcept {
+        assert(this->is_locked_write_lock(lock));
+        if (prepared.nested_matrix == nullptr) {
+            return;
+        }
+        // Matrix slots are never reused, so the nested matrix is valid only if it still occupies its original slot
+        const ptrdiff_t offset = prepared.nested_offset;
+        const bool still_present = (offset >= 0) && (static_cast<size_t>(offset) < this->matrices.size())
+                                   && (this->matrices[offset].get() == prepared.nested_matrix);
+        if (!still_present) {
+            prepared.nested_matrix = nullptr;
+            prepared.nested_offset = -1;
+        }
     }
 
     std::unique_ptr<class PolynomialMatrix>
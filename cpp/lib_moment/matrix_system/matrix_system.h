@@ -8,23 +8,28 @@
 #pragma once
 
 #include "matrix_system_errors.h"
+#include "memory_report.h"
 #include "standard_matrix_indices.h"
 #include "rulebook_storage.h"
 
 #include "dictionary/raw_polynomial.h"
 
+#include "matrix/prepared_monomial_matrix.h"
+
 #include "multithreading/maintains_mutex.h"
 #include "multithreading/multithreading.h"
 
 #include <map>
 #include <memory>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 
 namespace Moment {
 
     class Context;
     class Dictionary;
+    class MonomialMatrix;
     class SymbolicMatrix;
     class MomentRulebook;
     class OperatorSequenceGenerator;
@@ -32,6 +37,10 @@ namespace Moment {
     class RawPolynomial;
     class SymbolTable;
 
+    namespace Instrumentation {
+        class Recorder;
+    }
+
     /**
      * Base class for systems of operators, and their associated moment/localizing matrices.
      *
@@ -51,6 +60,9 @@ namespace Moment {
         /** List of matrices in the system. */
         std::vector<std::unique_ptr<SymbolicMatrix>> matrices;
 
+        /** Whether operator matrices of new matrices are kept once symbolized. */
+        OperatorMatrixRetention op_matrix_retention = OperatorMatrixRetention::Keep;
+
     public:
         /** Indexed moment matrices. */
         MomentMatrixIndices MomentMatrix;
@@ -165,6 +177,51 @@ namespace Moment {
          */
         bool generate_dictionary(size_t word_length);
 
+        /**
+         * Phase timings and counters of this system, recorded if compiled with MOMENT_INSTRUMENTATION.
+         * Thread-safe.
+         */
+        [[nodiscard]] Instrumentation::Recorder& instrumentation() const noexcept;
+
+        /**
+         * Approximate memory used by this system, per component and per matrix.
+         * Will lock until all write locks have expired - so do NOT first call for a write lock...!
+         */
+        [[nodiscard]] MemoryReport memory_report() const;
+
+        /**
+         * Release data of a component that can be regenerated on demand (cached matrix bases, and operator matrices
+         * that were generated from an index). Components that hold no regenerable data release nothing.
+         * Invalidates references to released data.
+         * Will lock until all read locks have expired - so do NOT first call for a read lock...!
+         * @return Approximate bytes released.
+         */
+        size_t drop_caches(MemoryComponent component);
+
+        /**
+         * Whether operator matrices of newly created matrices are kept, or released once symbolized.
+         * For thread safety, call for a read lock first.
+         */
+        [[nodiscard]] OperatorMatrixRetention operator_matrix_retention() const noexcept {
+            return this->op_matrix_retention;
+        }
+
+        /**
+         * Set whether operator matrices of newly created matrices are kept, or released once symbolized.
+         * Existing matrices are unaffected; to release their operator matrices, call drop_caches.
+         * Will lock until all read locks have expired - so do NOT first call for a read lock...!
+         */
+        void set_operator_matrix_retention(OperatorMatrixRetention retention);
+
+        /**
+         * Release operator matrices of newly registered matrix, if required by the retention policy.
+         * Changes should not be made without a write lock.
+         * @param lock The write lock to the matrix system.
+         * @param matrix The newly registered matrix.
+         * @return Approximate bytes released.
+         */
+        size_t apply_operator_matrix_retention(const WriteLock& lock, SymbolicMatrix& matrix);
+
         /**
          * Gets the polynomial factory for this system.
          */
@@ -217,6 +274,97 @@ namespace Moment {
         create_localizing_matrix(const WriteLock& lock, const LocalizingMatrixIndex& lmi,
                                  Multithreading::MultiThreadPolicy mt_policy);
 
+        /**
+         * Overrideable method, called with a read lock to generate the operator matrices of a moment matrix, ahead of
+         * symbol registration under the write lock. This allows independent matrices to be generated concurrently.
+         * Systems that override create_moment_matrix should also override this, returning an empty object if their
+         * matrices cannot be generated without exclusive access to the system.
+         * @param level The moment matrix level.
+         * @param mt_policy Is multithreaded creation used?
+         * @return Operator matrices of the moment matrix, or empty object to defer to create_moment_matrix.
+         */
+        virtual PreparedMonomialMatrix
+        prepare_moment_matrix(const ReadLock& lock, size_t level, Multithreading::MultiThreadPolicy mt_policy);
+
+        /**
+         * Overrideable method, called with a read lock to generate the operator matrices of a localizing matrix, ahead
+         * of symbol registration under the write lock. This allows independent matrices to be generated concurrently.
+         * Systems that override create_localizing_matrix should also override this, returning an empty object if their
+         * matrices cannot be generated without exclusive access to the system.
+         * @param lmi The hierarchy Level and word that describes the localizing matrix.
+         * @param mt_policy Is multithreaded creation used?
+         * @return Operator matrices of the localizing matrix, or empty object to defer to create_localizing_matrix.
+         */
+        virtual PreparedMonomialMatrix
+        prepare_localizing_matrix(const ReadLock& lock, const LocalizingMatrixIndex& lmi,
+                                  Multithreading::MultiThreadPolicy mt_policy);
+
+        /**
+         * Register the symbols of prepared operator matrices, and create the monomial matrix.
+         * @param lock The write lock to the matrix system.
+         * @param prepared The generated (non-empty) operator matrices.
+         * @param mt_policy Is multithreaded creation used?
+         * @return Owning pointer of new monomial matrix.
+         */
+        std::unique_ptr<MonomialMatrix> register_prepared_matrix(const WriteLock& lock,
+                                                                 PreparedMonomialMatrix&& prepared,
+                                                                 Multithreading::MultiThreadPolicy mt_policy);
+
+        /**
+         * Register the symbols of a batch of prepared operator matrices, and create their monomial matrices.
+         * The system is notified of new symbols once, after the whole batch has been registered (or, if registration
+         * fails partway, before the exception is rethrown).
+         * @param lock The write lock to the matrix system.
+         * @param prepared The generated (non-empty) operator matrices.
+         * @param mt_policy Is multithreaded creation used?
+         * @return Owning pointers of new monomial matrices, in the same order as the prepared matrices.
+         */
+        std::vector<std::unique_ptr<MonomialMatrix>>
+        register_prepared_matrices(const WriteLock& lock, std::vector<PreparedMonomialMatrix>&& prepared,
+                                   Multithreading::MultiThreadPolicy mt_policy);
+
+        /**
+         * Find the moment matrix of highest level below that requested, whose elements could be reused as the top-left
+         * block of a new moment matrix. The matrix system should be at least read-locked.
+         * @param level The level of the new moment matrix.
+         * @return Offset and pointer of existing monomial moment matrix, or {-1, nullptr} if none exists.
+         */
+        [[nodiscard]] std::pair<ptrdiff_t, const MonomialMatrix*>
+        find_nested_moment_matrix(size_t level) const noexcept;
+
+    private:
+        /**
+         * Call on_new_symbols_registered, if the symbol table has grown.
+         * @param lock The write lock to the matrix system.
+         * @param prev_symbol_count The number of symbols before registration began.
+         */
+        void notify_new_symbols_since(const WriteLock& lock, size_t prev_symbol_count);
+
+        /**
+         * Register a batch of prepared monomial matrices and append them to the system.
+         * If any matrix could not be prepared, each matrix is instead created individually through the factory.
+         * Defined alongside the standard matrix factories that use it.
+         */
+        template<typename factory_t, typename index_t>
+        std::vector<std::pair<ptrdiff_t, SymbolicMatrix&>>
+        append_prepared_batch(const WriteLock& lock, factory_t& factory, const std::vector<const index_t*>& indices,
+                              std::vector<PreparedMonomialMatrix>&& prepared,
+                              Multithreading::MultiThreadPolicy mt_policy);
+
+        /**
+         * Generate operator matrices of a moment matrix, reusing a nested lower-level matrix where possible.
+         * The matrix system should be at least read-locked.
+         */
+        [[nodiscard]] PreparedMonomialMatrix
+        prepare_moment_matrix_over_nested(size_t level, Multithreading::MultiThreadPolicy mt_policy) const;
+
+        /**
+         * Forget prepared matrix's nested matrix if it has been erased from the system since preparation.
+         */
+        void check_nested_matrix(const WriteLock& lock, PreparedMonomialMatrix& prepared) const noexcept;
+
+    protected:
+
         /**
          * Virtual method, called to generate a polynomial localizing matrix matrix.
          * @param lmi The hierarchy Level and word that describes the localizing matrix.
@@ -316,6 +464,14 @@ namespace Moment {
         virtual void on_new_symbols_registered(const MaintainsMutex::WriteLock& write_lock,
                                                size_t old_symbol_count, size_t new_symbol_count) { }
 
+        /**
+         * Virtual method, called before a matrix is deleted.
+         * @param matrix_offset The index of the matrix in the system.
+         * @param matrix The matrix about to be deleted.
+         */
+        virtual void on_matrix_deleted(const MaintainsMutex::WriteLock& write_lock,
+                                       ptrdiff_t matrix_offset, const class SymbolicMatrix& matrix) noexcept { }
+
 
     public:
         friend RulebookStorage;
@@ -0,0 +1,89 @@
+/**
+ * memory_report.cpp
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+
+#include "memory_report.h"
+
+#include <iomanip>
+#include <ostream>
+
+namespace Moment {
+
+    std::string_view memory_component_name(const MemoryComponent component) noexcept {
+        switch (component) {
+            case MemoryComponent::OperatorMatrices:
+                return "Operator matrices";
+            case MemoryComponent::SymbolData:
+                return "Symbol data";
+            case MemoryComponent::Bases:
+                return "Bases";
+            case MemoryComponent::Dictionary:
+                return "Dictionary";
+            case MemoryComponent::SymbolTable:
+                return "Symbol table";
+            case MemoryComponent::Rulebooks:
+                return "Rulebooks";
+        }
+        return "Unknown component";
+    }
+
+    size_t MemoryReport::component(const MemoryComponent component) const noexcept {
+        size_t total = 0;
+        switch (component) {
+            case MemoryComponent::OperatorMatrices:
+                for (const auto& matrix : this->matrices) {
+                    total += matrix.operator_matrices;
+                }
+                break;
+            case MemoryComponent::SymbolData:
+                for (const auto& matrix : this->matrices) {
+                    total += matrix.symbol_data;
+                }
+                break;
+            case MemoryComponent::Bases:
+                for (const auto& matrix : this->matrices) {
+                    total += matrix.bases;
+                }
+                break;
+            case MemoryComponent::Dictionary:
+                total = this->dictionary;
+                break;
+            case MemoryComponent::SymbolTable:
+                total = this->symbol_table;
+                break;
+            case MemoryComponent::Rulebooks:
+                total = this->rulebooks;
+                break;
+        }
+        return total;
+    }
+
+    size_t MemoryReport::total() const noexcept {
+        size_t total = 0;
+        for (size_t component_index = 0; component_index < memory_component_count; ++component_index) {
+            total += this->component(static_cast<MemoryComponent>(component_index));
+        }
+        return total;
+    }
+
+    std::ostream& operator<<(std::ostream& os, const MemoryReport& report) {
+        for (size_t component_index = 0; component_index < memory_component_count; ++component_index) {
+            const auto component = static_cast<MemoryComponent>(component_index);
+            os << std::left << std::setw(20) << memory_component_name(component) << std::right
+               << std::setw(16) << report.component(component) << " bytes\n";
+        }
+        os << std::left << std::setw(20) << "Total" << std::right
+           << std::setw(16) << report.total() << " bytes\n";
+
+        for (const auto& matrix : report.matrices) {
+            os << "#" << matrix.index << " " << matrix.description << ": "
+               << matrix.operator_matrices << " (operators) + "
+               << matrix.symbol_data << " (symbols) + "
+               << matrix.bases << " (bases) = " << matrix.total() << " bytes\n";
+        }
+        return os;
+    }
+}
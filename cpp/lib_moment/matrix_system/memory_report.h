@@ -0,0 +1,98 @@
+/**
+ * memory_report.h
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Moment {
+
+    /**
+     * Components of a matrix system, for memory accounting.
+     */
+    enum class MemoryComponent : uint8_t {
+        /** Operator matrices (unaliased and aliased) owned by symbolic matrices. */
+        OperatorMatrices,
+        /** Symbolic representations of matrices, and their symbol bookkeeping. */
+        SymbolData,
+        /** Cached numeric bases of matrices. */
+        Bases,
+        /** Operator sequence generators of the context's dictionary. */
+        Dictionary,
+        /** The symbol table. */
+        SymbolTable,
+        /** Moment substitution rulebooks. */
+        Rulebooks
+    };
+
+    /** Number of distinct memory components. */
+    constexpr const size_t memory_component_count = 6;
+
+    /** Human-readable name of memory component. */
+    [[nodiscard]] std::string_view memory_component_name(MemoryComponent component) noexcept;
+
+    /**
+     * Whether a matrix system keeps the operator matrices of its matrices, once they have been symbolized.
+     */
+    enum class OperatorMatrixRetention : uint8_t {
+        /** Operator matrices remain resident. */
+        Keep,
+        /** Operator matrices generated from an index are released, and regenerated on demand. */
+        Release
+    };
+
+    /**
+     * Approximate memory used by one matrix in a system, in bytes.
+     */
+    struct MatrixMemoryUsage {
+        /** Index of matrix within system. */
+        ptrdiff_t index = -1;
+
+        /** Description of matrix. */
+        std::string description;
+
+        size_t operator_matrices = 0;
+
+        size_t symbol_data = 0;
+
+        size_t bases = 0;
+
+        [[nodiscard]] size_t total() const noexcept {
+            return this->operator_matrices + this->symbol_data + this->bases;
+        }
+    };
+
+    /**
+     * Approximate memory used by a matrix system, per component and per matrix, in bytes.
+     * Estimates count element storage and container bookkeeping, but not allocator overhead.
+     */
+    struct MemoryReport {
+        /** Usage of each matrix in system, in order of index (deleted matrices omitted). */
+        std::vector<MatrixMemoryUsage> matrices;
+
+        size_t dictionary = 0;
+
+        size_t symbol_table = 0;
+
+        size_t rulebooks = 0;
+
+        /** Total bytes attributed to component. */
+        [[nodiscard]] size_t component(MemoryComponent component) const noexcept;
+
+        /** Total bytes over all components. */
+        [[nodiscard]] size_t total() const noexcept;
+
+        /** Write table of bytes per component, then per matrix. */
+        friend std::ostream& operator<<(std::ostream& os, const MemoryReport& report);
+    };
+
+}
@@ -111,4 +111,14 @@ namespace Moment {
         }
         return *this->rulebooks[index];
     }
+
+    size_t RulebookStorage::memory_footprint() const noexcept {
+        size_t total = this->rulebooks.capacity() * sizeof(std::unique_ptr<MomentRulebook>);
+        for (const auto& rulebook : this->rulebooks) {
+            if (rulebook) {
+                total += sizeof(MomentRulebook) + rulebook->memory_footprint();
+            }
+        }
+        return total;
+    }
 }
\ No newline at end of file
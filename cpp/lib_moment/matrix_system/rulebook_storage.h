@@ -94,6 +94,12 @@ namespace Moment {
          */
         [[nodiscard]] size_t empty() const noexcept { return this->rulebooks.empty(); }
 
+        /**
+         * Approximate bytes used by all rulebooks in system.
+         * For thread safety, call for a read lock first.
+         */
+        [[nodiscard]] size_t memory_footprint() const noexcept;
+
         [[nodiscard]] inline MomentRulebook& operator()(const size_t index) {
             return this->find(index);
         }
@@ -9,15 +9,45 @@
 #include "matrix_system.h"
 #include "standard_matrix_indices.h"
 
+#include "matrix/monomial_matrix.h"
 #include "matrix/symbolic_matrix.h"
 #include "matrix/polynomial_matrix.h"
 #include "scenarios/context.h"
 #include "symbolic/rules/moment_rulebook.h"
 
+#include <algorithm>
 #include <memory>
 
 namespace Moment {
 
+    template<typename factory_t, typename index_t>
+    std::vector<std::pair<ptrdiff_t, SymbolicMatrix&>>
+    MatrixSystem::append_prepared_batch(const MaintainsMutex::WriteLock& lock, factory_t& factory,
+                                        const std::vector<const index_t*>& indices,
+                                        std::vector<PreparedMonomialMatrix>&& prepared,
+                                        const Multithreading::MultiThreadPolicy mt_policy) {
+        assert(indices.size() == prepared.size());
+        std::vector<std::pair<ptrdiff_t, SymbolicMatrix&>> output;
+        output.reserve(indices.size());
+
+        // If any matrix could not be prepared, create one by one
+        if (std::any_of(prepared.cbegin(), prepared.cend(),
+                        [](const PreparedMonomialMatrix& p) { return p.empty(); })) {
+            for (size_t index = 0; index < indices.size(); ++index) {
+                output.emplace_back(factory(lock, *indices[index], std::move(prepared[index]), mt_policy));
+            }
+            return output;
+        }
+
+        auto new_matrices = this->register_prepared_matrices(lock, std::move(prepared), mt_policy);
+        for (auto& matrix : new_matrices) {
+            const auto matrixIndex = static_cast<ptrdiff_t>(this->matrices.size());
+            this->matrices.emplace_back(std::move(matrix));
+            output.emplace_back(matrixIndex, *this->matrices.back());
+        }
+        return output;
+    }
+
     std::pair<ptrdiff_t, SymbolicMatrix &>
     MomentMatrixFactory::operator()(const MaintainsMutex::WriteLock& lock, const Index level,
                                     const Multithreading::MultiThreadPolicy mt_policy) {
@@ -26,6 +56,30 @@ namespace Moment {
         return std::pair<ptrdiff_t, SymbolicMatrix&>(matrixIndex, *system.matrices.back());
     }
 
+    MomentMatrixFactory::Prepared
+    MomentMatrixFactory::prepare(const MaintainsMutex::ReadLock& lock, const Index level,
+                                 const Multithreading::MultiThreadPolicy mt_policy) {
+        return system.prepare_moment_matrix(lock, level, mt_policy);
+    }
+
+    std::pair<ptrdiff_t, SymbolicMatrix &>
+    MomentMatrixFactory::operator()(const MaintainsMutex::WriteLock& lock, const Index level, Prepared&& prepared,
+                                    const Multithreading::MultiThreadPolicy mt_policy) {
+        if (prepared.empty()) {
+            return (*this)(lock, level, mt_policy);
+        }
+        const auto matrixIndex = static_cast<ptrdiff_t>(system.matrices.size());
+        system.matrices.emplace_back(system.register_prepared_matrix(lock, std::move(prepared), mt_policy));
+        return std::pair<ptrdiff_t, SymbolicMatrix&>(matrixIndex, *system.matrices.back());
+    }
+
+    std::vector<std::pair<ptrdiff_t, SymbolicMatrix&>>
+    MomentMatrixFactory::operator()(const MaintainsMutex::WriteLock& lock, const std::vector<const Index*>& levels,
+                                    std::vector<Prepared>&& prepared,
+                                    const Multithreading::MultiThreadPolicy mt_policy) {
+        return system.append_prepared_batch(lock, *this, levels, std::move(prepared), mt_policy);
+    }
+
     void MomentMatrixFactory::notify(const MaintainsMutex::WriteLock& lock, const Index level,
                                      ptrdiff_t offset,
                                      SymbolicMatrix &matrix) {
@@ -41,6 +95,31 @@ namespace Moment {
     }
 
 
+    LocalizingMatrixFactory::Prepared
+    LocalizingMatrixFactory::prepare(const MaintainsMutex::ReadLock& lock, const LocalizingMatrixIndex& lmi,
+                                     const Multithreading::MultiThreadPolicy mt_policy) {
+        return system.prepare_localizing_matrix(lock, lmi, mt_policy);
+    }
+
+    std::pair<ptrdiff_t, SymbolicMatrix &>
+    LocalizingMatrixFactory::operator()(const MaintainsMutex::WriteLock& lock, const LocalizingMatrixIndex& lmi,
+                                        Prepared&& prepared, const Multithreading::MultiThreadPolicy mt_policy) {
+        if (prepared.empty()) {
+            return (*this)(lock, lmi, mt_policy);
+        }
+        const auto matrixIndex = static_cast<ptrdiff_t>(system.matrices.size());
+        system.matrices.emplace_back(system.register_prepared_matrix(lock, std::move(prepared), mt_policy));
+        return std::pair<ptrdiff_t, SymbolicMatrix&>(matrixIndex, *system.matrices.back());
+    }
+
+    std::vector<std::pair<ptrdiff_t, SymbolicMatrix&>>
+    LocalizingMatrixFactory::operator()(const MaintainsMutex::WriteLock& lock,
+                                        const std::vector<const LocalizingMatrixIndex*>& indices,
+                                        std::vector<Prepared>&& prepared,
+                                        const Multithreading::MultiThreadPolicy mt_policy) {
+        return system.append_prepared_batch(lock, *this, indices, std::move(prepared), mt_policy);
+    }
+
     void LocalizingMatrixFactory::notify(const MaintainsMutex::WriteLock& lock,
                                          const LocalizingMatrixIndex &lmi,
                                          ptrdiff_t offset, SymbolicMatrix &matrix) {
@@ -93,9 +172,15 @@ namespace Moment {
     /** Ensure MomentMatrixFactory meets concept. */
     static_assert(makes_matrices<MomentMatrixFactory, SymbolicMatrix, MomentMatrixIndex>);
 
-    /** Ensure PolynomialLocalizingMatrixFactory meets concept. */
+    /** Ensure MomentMatrixFactory can prepare matrices outside of write lock. */
+    static_assert(prepares_matrix_batches<MomentMatrixFactory, SymbolicMatrix, MomentMatrixIndex>);
+
+    /** Ensure LocalizingMatrixFactory meets concept. */
     static_assert(makes_matrices<LocalizingMatrixFactory, SymbolicMatrix, LocalizingMatrixIndex>);
 
+    /** Ensure LocalizingMatrixFactory can prepare matrices outside of write lock. */
+    static_assert(prepares_matrix_batches<LocalizingMatrixFactory, SymbolicMatrix, LocalizingMatrixIndex>);
+
     /** Ensure PolynomialLocalizingMatrixFactory meets concept. */
     static_assert(makes_matrices<PolynomialLocalizingMatrixFactory, PolynomialMatrix, PolynomialLocalizingMatrixIndex>);
 
@@ -20,12 +20,15 @@
 #include "index_storage/polynomial_index_storage.h"
 #include "index_storage/vector_index_storage.h"
 
+#include "matrix/prepared_monomial_matrix.h"
+
 #include "multithreading/multithreading.h"
 #include "multithreading/maintains_mutex.h"
 
 #include <shared_mutex>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace Moment {
 
@@ -39,6 +42,7 @@ namespace Moment {
     class MomentMatrixFactory {
     public:
         using Index = MomentMatrixIndex;
+        using Prepared = PreparedMonomialMatrix;
 
     private:
         MatrixSystem& system;
@@ -49,6 +53,17 @@ namespace Moment {
         [[nodiscard]] std::pair<ptrdiff_t, SymbolicMatrix&>
         operator()(const MaintainsMutex::WriteLock& lock, Index level, Multithreading::MultiThreadPolicy mt_policy);
 
+        [[nodiscard]] Prepared
+        prepare(const MaintainsMutex::ReadLock& lock, Index level, Multithreading::MultiThreadPolicy mt_policy);
+
+        [[nodiscard]] std::pair<ptrdiff_t, SymbolicMatrix&>
+        operator()(const MaintainsMutex::WriteLock& lock, Index level, Prepared&& prepared,
+                   Multithreading::MultiThreadPolicy mt_policy);
+
+        [[nodiscard]] std::vector<std::pair<ptrdiff_t, SymbolicMatrix&>>
+        operator()(const MaintainsMutex::WriteLock& lock, const std::vector<const Index*>& levels,
+                   std::vector<Prepared>&& prepared, Multithreading::MultiThreadPolicy mt_policy);
+
         void notify(const MaintainsMutex::WriteLock& lock, Index index, ptrdiff_t offset, SymbolicMatrix& matrix);
     };
 
@@ -65,6 +80,7 @@ namespace Moment {
     class LocalizingMatrixFactory {
     public:
         using Index = LocalizingMatrixIndex;
+        using Prepared = PreparedMonomialMatrix;
 
     private:
         MatrixSystem& system;
@@ -75,6 +91,17 @@ namespace Moment {
         [[nodiscard]] std::pair<ptrdiff_t, SymbolicMatrix&>
         operator()(const MaintainsMutex::WriteLock& lock, const Index& index, Multithreading::MultiThreadPolicy mt_policy);
 
+        [[nodiscard]] Prepared
+        prepare(const MaintainsMutex::ReadLock& lock, const Index& index, Multithreading::MultiThreadPolicy mt_policy);
+
+        [[nodiscard]] std::pair<ptrdiff_t, SymbolicMatrix&>
+        operator()(const MaintainsMutex::WriteLock& lock, const Index& index, Prepared&& prepared,
+                   Multithreading::MultiThreadPolicy mt_policy);
+
+        [[nodiscard]] std::vector<std::pair<ptrdiff_t, SymbolicMatrix&>>
+        operator()(const MaintainsMutex::WriteLock& lock, const std::vector<const Index*>& indices,
+                   std::vector<Prepared>&& prepared, Multithreading::MultiThreadPolicy mt_policy);
+
         void notify(const MaintainsMutex::WriteLock& lock, const Index& lmi, ptrdiff_t offset, SymbolicMatrix& matrix);
     };
 
@@ -0,0 +1,57 @@
+/**
+ * fan_out.h
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+
+#pragma once
+
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace Moment::Multithreading {
+
+    /**
+     * Call functor(worker_id) for each worker_id in [0, worker_count) on its own thread, and wait for all to finish.
+     * An exception thrown by a worker, or by launching a worker, is rethrown once every started worker has joined.
+     * If several are thrown, the launch failure takes precedence, then the worker with the lowest ID.
+     * @param worker_count The number of threads to launch.
+     * @param functor Work to do; must be safe to call concurrently with different worker IDs.
+     */
+    template<typename functor_t>
+    void fan_out(const size_t worker_count, const functor_t& functor) {
+        std::vector<std::exception_ptr> errors(worker_count);
+        std::exception_ptr launch_error;
+        std::vector<std::thread> workers;
+        workers.reserve(worker_count);
+        try {
+            for (size_t worker_id = 0; worker_id < worker_count; ++worker_id) {
+                workers.emplace_back([&functor, &errors, worker_id]() {
+                    try {
+                        functor(worker_id);
+                    } catch (...) {
+                        errors[worker_id] = std::current_exception();
+                    }
+                });
+            }
+        } catch (...) {
+            // Could not launch every worker: wait for those that did start, before propagating
+            launch_error = std::current_exception();
+        }
+
+        for (auto& worker : workers) {
+            worker.join();
+        }
+
+        if (launch_error) {
+            std::rethrow_exception(launch_error);
+        }
+        for (const auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+}
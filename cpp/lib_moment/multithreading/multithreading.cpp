@@ -76,6 +76,13 @@ namespace Moment::Multithreading {
         return should_multithread(policy, minimum_matrix_element_count, elements);
     }
 
+    bool should_multithread_matrix_batch(MultiThreadPolicy policy, const size_t matrices) noexcept {
+        if (matrices <= 1) {
+            return false;
+        }
+        return should_multithread(policy, minimum_matrix_batch_count, matrices);
+    }
+
     bool should_multithread_rule_application(MultiThreadPolicy policy, size_t elements, size_t rules) noexcept {
         const size_t difficulty = (rules <= 0) ? std::numeric_limits<size_t>::max()
                                                : elements * std::ceil(std::log2(static_cast<double>(rules)));
@@ -89,6 +96,28 @@ namespace Moment::Multithreading {
         return should_multithread(policy, minimum_group_rep_difficulty, difficulty);
     }
 
+    bool should_multithread_extension_suggestion(MultiThreadPolicy policy,
+                                                 const size_t prefixes, const size_t max_trials) noexcept {
+        return should_multithread(policy, minimum_extension_suggestion_difficulty, prefixes * max_trials);
+    }
+
+    bool should_multithread_map_core(MultiThreadPolicy policy, const size_t elements) noexcept {
+        return should_multithread(policy, minimum_map_core_element_count, elements);
+    }
+
+    bool should_multithread_tensor_conversion(MultiThreadPolicy policy, const size_t elements) noexcept {
+        return should_multithread(policy, minimum_tensor_conversion_element_count, elements);
+    }
+
+    bool should_multithread_tensor_block(MultiThreadPolicy policy,
+                                         const size_t elements, const size_t element_cost_ns) noexcept {
+        return should_multithread(policy, minimum_tensor_block_cost_ns, elements * element_cost_ns);
+    }
+
+    bool should_multithread_export(MultiThreadPolicy policy, const size_t elements) noexcept {
+        return should_multithread(policy, minimum_export_element_count, elements);
+    }
+
     bool should_multithread_osg(MultiThreadPolicy policy, size_t potential_elements) noexcept {
         return should_multithread(policy, minimum_osg_element_count, potential_elements);
     }
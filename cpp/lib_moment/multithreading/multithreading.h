@@ -34,6 +34,9 @@ namespace Moment::Multithreading {
     /** The minimum number of elements in a requested matrix to trigger multi-threaded creation in optional mode. */
     constexpr const size_t minimum_matrix_element_count = 6400; // = 80 x 80 matrix, or larger.
 
+    /** The minimum number of matrices in a batch request to trigger creation of matrices in parallel in optional mode. */
+    constexpr const size_t minimum_matrix_batch_count = 4;
+
     /** The minimum number of elements in a requested matrix to trigger multi-threaded multiplication in optional mode.*/
     constexpr const size_t minimum_matrix_multiply_element_count = 6400; // = 80 x 80 matrix, or larger.
 
@@ -44,6 +47,21 @@ namespace Moment::Multithreading {
     /** The minimum number of possible elements in an OSG to trigger multi-threaded creation in optional mode. */
     constexpr const size_t minimum_osg_element_count = 1000;
 
+    /** The minimum number of prefixes x trial extensions to trigger multithreaded extension suggestion. */
+    constexpr const size_t minimum_extension_suggestion_difficulty = 6400;
+
+    /** The minimum number of (potentially non-zero) elements in a map to trigger multithreaded map core extraction. */
+    constexpr const size_t minimum_map_core_element_count = 65536; // e.g. 256 x 256 dense matrix.
+
+    /** The minimum total number of elements in a batch of tensors to trigger multithreaded tensor conversion. */
+    constexpr const size_t minimum_tensor_conversion_element_count = 1048576; // e.g. 16384 tables of 8 x 8.
+
+    /** The minimum estimated time (in ns) to generate a block of a lazily materialised tensor, to multithread it. */
+    constexpr const size_t minimum_tensor_block_cost_ns = 1000000; // i.e. 1 ms.
+
+    /** The minimum total number of (real-embedded) elements in a set of blocks to trigger multithreaded export. */
+    constexpr const size_t minimum_export_element_count = 65536; // e.g. 256 x 256 dense matrix.
+
     /** Threshold, for multi-threaded group  representation creation: raw dimension * raw dimension * group elems. */
     constexpr const size_t minimum_group_rep_difficulty = 5000; // e.g. one ~25*25 matrix with 8 group elements.
 
@@ -77,6 +95,11 @@ namespace Moment::Multithreading {
      */
     [[nodiscard]] bool should_multithread_matrix_creation(MultiThreadPolicy policy, size_t elements) noexcept;
 
+    /**
+     * Should a batch of matrices be created in parallel (one matrix per worker at a time)?
+     */
+    [[nodiscard]] bool should_multithread_matrix_batch(MultiThreadPolicy policy, size_t matrices) noexcept;
+
     /**
      * Should the rule application be multithreaded?
      */
@@ -89,6 +112,33 @@ namespace Moment::Multithreading {
     [[nodiscard]] bool should_multithread_group_rep_generation(MultiThreadPolicy policy,
                                                                size_t raw_dim, size_t group_elements) noexcept;
 
+    /**
+     * Should the extension suggestion be multithreaded?
+     */
+    [[nodiscard]] bool should_multithread_extension_suggestion(MultiThreadPolicy policy,
+                                                               size_t prefixes, size_t max_trials) noexcept;
+
+    /**
+     * Should the extraction of non-trivial parts of a map core be multithreaded?
+     */
+    [[nodiscard]] bool should_multithread_map_core(MultiThreadPolicy policy, size_t elements) noexcept;
+
+    /**
+     * Should a batch of tensor conversions be multithreaded?
+     */
+    [[nodiscard]] bool should_multithread_tensor_conversion(MultiThreadPolicy policy, size_t elements) noexcept;
+
+    /**
+     * Should a block of lazily-generated tensor elements be generated in parallel?
+     */
+    [[nodiscard]] bool should_multithread_tensor_block(MultiThreadPolicy policy,
+                                                       size_t elements, size_t element_cost_ns) noexcept;
+
+    /**
+     * Should the blocks of a solver export be formatted in parallel?
+     */
+    [[nodiscard]] bool should_multithread_export(MultiThreadPolicy policy, size_t elements) noexcept;
+
     /**
      * Should the operator sequence generation be multithreaded?
      * (NB: Currently not implemented!)
@@ -80,8 +80,8 @@ namespace Moment {
     CollinsGisinEntry::CollinsGisinEntry(const CollinsGisin& cgt, const CollinsGisinIndexView index)
         : sequence{cgi_to_op_seq(cgt.context, cgt.dimensionInfo, index)} {
 
-        // In virtual mode, attempt also to resolve symbols
-        if (cgt.StorageType == TensorStorageType::Virtual) {
+        // In virtual or lazy mode, attempt also to resolve symbols
+        if (cgt.StorageType != TensorStorageType::Explicit) {
             const auto symInfo = cgt.try_find_symbol(sequence);
             if (symInfo.found()) {
                 this->symbol_id = symInfo->Id();
@@ -100,8 +100,8 @@ namespace Moment {
     }
 
     void CollinsGisin::do_initial_symbol_search() {
-        // Do nothing if in virtual-storage mode.
-        if (this->StorageType == TensorStorageType::Virtual) {
+        // Do nothing if in virtual- or lazy-storage mode.
+        if (this->StorageType != TensorStorageType::Explicit) {
             return;
         }
 
@@ -124,8 +124,8 @@ namespace Moment {
 
 
     bool CollinsGisin::fill_missing_symbols() noexcept {
-        // Do nothing if in virtual-storage mode.
-        if (this->StorageType == TensorStorageType::Virtual) {
+        // Do nothing if in virtual- or lazy-storage mode.
+        if (this->StorageType != TensorStorageType::Explicit) {
             return true;
         }
 
@@ -179,6 +179,11 @@ namespace Moment {
     protected:
         [[nodiscard]] CollinsGisinEntry make_element_no_checks(IndexView index) const override;
 
+        /** Entries can be cached once their symbol has been found. */
+        [[nodiscard]] bool can_cache_element(const CollinsGisinEntry& element) const noexcept override {
+            return element.symbol_id >= 0;
+        }
+
         [[nodiscard]] std::string get_name(bool capital) const override {
             return "Collins-Gisin tensor";
         }
@@ -0,0 +1,124 @@
+/**
+ * explicit_value_rules.cpp
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+
+#include "explicit_value_rules.h"
+
+#include "probability_tensor.h"
+
+#include "symbolic/polynomial_factory.h"
+#include "symbolic/rules/moment_rulebook.h"
+
+#include <sstream>
+
+namespace Moment {
+
+    CompiledExplicitValueRules::CompiledExplicitValueRules(const PolynomialFactory& factory,
+                                                           std::span<const Polynomial> element_polynomials,
+                                                           const Polynomial& condition)
+            : factory{factory} {
+        assert(condition.real_factors());
+
+        std::vector<double> constants;
+        std::vector<Eigen::Triplet<double>> value_entries;
+        this->rule_offsets.reserve(element_polynomials.size() + 1);
+        this->rule_offsets.emplace_back(0);
+
+        for (size_t rule_index = 0; rule_index < element_polynomials.size(); ++rule_index) {
+            const auto& element = element_polynomials[rule_index];
+            assert(element.real_factors());
+
+            // Merge terms of element and condition, in factory order.
+            auto elem_iter = element.begin();
+            auto cond_iter = condition.begin();
+            while ((elem_iter != element.end()) || (cond_iter != condition.end())) {
+                const bool take_element = (cond_iter == condition.end())
+                        || ((elem_iter != element.end()) && !factory.less(*cond_iter, *elem_iter));
+                const bool take_condition = (elem_iter == element.end())
+                        || ((cond_iter != condition.end()) && !factory.less(*elem_iter, *cond_iter));
+
+                const auto& mono = take_element ? *elem_iter : *cond_iter;
+                this->terms.emplace_back(mono.id, 1.0, mono.conjugated);
+                constants.emplace_back(take_element ? elem_iter->factor.real() : 0.0);
+                if (take_condition) {
+                    value_entries.emplace_back(static_cast<Eigen::Index>(this->terms.size() - 1),
+                                               static_cast<Eigen::Index>(rule_index),
+                                               -cond_iter->factor.real());
+                    ++cond_iter;
+                }
+                if (take_element) {
+                    ++elem_iter;
+                }
+            }
+            this->rule_offsets.emplace_back(this->terms.size());
+        }
+
+        this->constant_coefficients = Eigen::Map<const Eigen::VectorXd>(constants.data(),
+                                                                        static_cast<Eigen::Index>(constants.size()));
+        this->value_map.resize(static_cast<Eigen::Index>(this->terms.size()),
+                               static_cast<Eigen::Index>(element_polynomials.size()));
+        this->value_map.setFromTriplets(value_entries.cbegin(), value_entries.cend());
+    }
+
+    CompiledExplicitValueRules::coefficient_matrix_t
+    CompiledExplicitValueRules::evaluate(const std::span<const double> values) const {
+        const size_t rule_total = this->rule_count();
+        if (values.empty() || (rule_total == 0) || ((values.size() % rule_total) != 0)) {
+            std::stringstream errSS;
+            errSS << "Expected a positive multiple of " << rule_total << " values, but " << values.size()
+                  << " were provided.";
+            throw errors::BadPTError{errSS.str()};
+        }
+
+        const Eigen::Map<const Eigen::MatrixXd> value_matrix{values.data(),
+                                                             static_cast<Eigen::Index>(rule_total),
+                                                             static_cast<Eigen::Index>(values.size() / rule_total)};
+        coefficient_matrix_t output = this->value_map * value_matrix;
+        output.colwise() += this->constant_coefficients;
+        return output;
+    }
+
+    std::vector<Polynomial> CompiledExplicitValueRules::rules(const coefficient_matrix_t& coefficients,
+                                                              const size_t distribution) const {
+        if ((coefficients.rows() != static_cast<Eigen::Index>(this->term_count()))
+            || (distribution >= static_cast<size_t>(coefficients.cols()))) {
+            std::stringstream errSS;
+            errSS << "Distribution " << distribution << " is not in the supplied coefficient matrix.";
+            throw errors::BadPTError{errSS.str()};
+        }
+
+        std::vector<Polynomial> output;
+        output.reserve(this->rule_count());
+        const auto column = coefficients.col(static_cast<Eigen::Index>(distribution));
+        for (size_t rule_index = 0; rule_index < this->rule_count(); ++rule_index) {
+            const size_t first = this->rule_offsets[rule_index];
+            const size_t last = this->rule_offsets[rule_index + 1];
+            Polynomial::storage_t data;
+            data.reserve(last - first);
+            for (size_t term = first; term < last; ++term) {
+                data.emplace_back(this->terms[term].id, column(static_cast<Eigen::Index>(term)),
+                                  this->terms[term].conjugated);
+            }
+            output.emplace_back(this->factory.presorted(std::move(data)));
+        }
+        return output;
+    }
+
+    std::vector<Polynomial> CompiledExplicitValueRules::operator()(const std::span<const double> values) const {
+        if (values.size() != this->rule_count()) {
+            std::stringstream errSS;
+            errSS << "Expected " << this->rule_count() << " values, but " << values.size() << " were provided.";
+            throw errors::BadPTError{errSS.str()};
+        }
+        return this->rules(this->evaluate(values), 0);
+    }
+
+    void CompiledExplicitValueRules::add_to_rulebook(MomentRulebook& rulebook,
+                                                     const coefficient_matrix_t& coefficients,
+                                                     const size_t distribution) const {
+        rulebook.add_raw_rules(this->rules(coefficients, distribution));
+    }
+}
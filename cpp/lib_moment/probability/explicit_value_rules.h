@@ -0,0 +1,108 @@
+/**
+ * explicit_value_rules.h
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+
+#pragma once
+
+#include "integer_types.h"
+
+#include "symbolic/monomial.h"
+#include "symbolic/polynomial.h"
+
+#include <Eigen/SparseCore>
+
+#include <span>
+#include <vector>
+
+namespace Moment {
+
+    class MomentRulebook;
+    class PolynomialFactory;
+
+    /**
+     * Explicit-value rules for a fixed range of a probability tensor, compiled for repeated evaluation.
+     *
+     * The i-th rule reads P_i - v_i C = 0, where P_i is the i-th element of the range, v_i the supplied value, and C
+     * the conditioning polynomial (or the identity, for unconditional distributions). The terms appearing in each rule
+     * are fixed on construction, so that the rule coefficients are an affine function c = c0 + M v of the values,
+     * with M a sparse (terms x rules) matrix. A batch of distributions is then evaluated in one sparse x dense product.
+     */
+    class CompiledExplicitValueRules {
+    public:
+        /** Rule coefficients: one row per term, one column per distribution. */
+        using coefficient_matrix_t = Eigen::MatrixXd;
+
+        /** Factory, used to construct rule polynomials. */
+        const PolynomialFactory& factory;
+
+    private:
+        /** Monomials appearing in the rules (factors unused), in factory order within each rule. */
+        std::vector<Monomial> terms;
+
+        /** Offset of each rule's first term in terms, with a final entry equal to the total number of terms. */
+        std::vector<size_t> rule_offsets;
+
+        /** Value-independent part of each term's coefficient. */
+        Eigen::VectorXd constant_coefficients;
+
+        /** Linear map from values to the value-dependent part of each term's coefficient. */
+        Eigen::SparseMatrix<double> value_map;
+
+    public:
+        /**
+         * Compile explicit-value rules.
+         * @param factory The polynomial factory, defining term order.
+         * @param element_polynomials Symbolic polynomial of each element in the range, with real coefficients.
+         * @param condition Symbolic polynomial of the conditioning event, or Polynomial::Scalar(1.0) if none.
+         */
+        CompiledExplicitValueRules(const PolynomialFactory& factory,
+                                   std::span<const Polynomial> element_polynomials,
+                                   const Polynomial& condition);
+
+        /** Number of rules, i.e. the number of values per distribution. */
+        [[nodiscard]] size_t rule_count() const noexcept { return this->rule_offsets.size() - 1; }
+
+        /** Total number of terms over all rules. */
+        [[nodiscard]] size_t term_count() const noexcept { return this->terms.size(); }
+
+        /** Value-independent part of the coefficients. */
+        [[nodiscard]] const Eigen::VectorXd& constant_terms() const noexcept { return this->constant_coefficients; }
+
+        /** Sparse (terms x rules) map from values to coefficients. */
+        [[nodiscard]] const Eigen::SparseMatrix<double>& linear_map() const noexcept { return this->value_map; }
+
+        /**
+         * Evaluate rule coefficients for a batch of distributions.
+         * @param values Values of one or more distributions, each of length rule_count(), stored consecutively.
+         * @return Coefficient matrix, with one column per distribution.
+         * @throws errors::BadPTError if the number of values is not a positive multiple of rule_count().
+         */
+        [[nodiscard]] coefficient_matrix_t evaluate(std::span<const double> values) const;
+
+        /**
+         * Construct rule polynomials for one distribution from evaluated coefficients.
+         * @param coefficients Output of evaluate().
+         * @param distribution Column of coefficients to use.
+         */
+        [[nodiscard]] std::vector<Polynomial> rules(const coefficient_matrix_t& coefficients,
+                                                    size_t distribution) const;
+
+        /**
+         * Construct rule polynomials for a single distribution.
+         * Equivalent to ProbabilityTensor::explicit_value_rules, for the compiled range.
+         */
+        [[nodiscard]] std::vector<Polynomial> operator()(std::span<const double> values) const;
+
+        /**
+         * Add the rules for one distribution to a rulebook, as raw rules.
+         * @param rulebook The rulebook to add to. Completion is left to the caller.
+         * @param coefficients Output of evaluate().
+         * @param distribution Column of coefficients to use.
+         */
+        void add_to_rulebook(MomentRulebook& rulebook, const coefficient_matrix_t& coefficients,
+                             size_t distribution) const;
+    };
+}
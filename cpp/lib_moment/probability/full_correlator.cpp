@@ -163,21 +163,42 @@ namespace Moment {
     }
 
     void FullCorrelator::calculate_correlators() {
-        // Derive data
-        this->data.reserve(this->ElementCount);
-        MultiDimensionalIndexIterator<true> elementIndexIter(this->Dimensions);
+        // Expand every correlator at once, one party at a time: as <A> = 2P(a0) - 1 for each party, the pass over
+        // party d sets T[.., i_d, ..] = 2 T[.., i_d, ..] - T[.., 0, ..] for each i_d > 0, starting from T = CG tensor.
+        std::vector<Polynomial::storage_t> cg_terms(this->ElementCount);
+        for (size_t offset = 0; offset < this->ElementCount; ++offset) {
+            cg_terms[offset].reserve(static_cast<size_t>(1) << this->DimensionCount);
+            cg_terms[offset].emplace_back(static_cast<symbol_name_t>(offset + 1), 1.0);
+        }
+        for (size_t party = 0; party < this->DimensionCount; ++party) {
+            const size_t stride = this->Strides[party];
+            const size_t dimension = this->Dimensions[party];
+            for (size_t offset = 0; offset < this->ElementCount; ++offset) {
+                const size_t party_index = (offset / stride) % dimension;
+                if (party_index == 0) {
+                    continue;
+                }
+                auto& target = cg_terms[offset];
+                const auto& marginal = cg_terms[offset - (party_index * stride)];
+                for (auto& mono : target) {
+                    mono.factor *= 2.0;
+                }
+                for (const auto& mono : marginal) {
+                    target.emplace_back(mono.id, -mono.factor);
+                }
+            }
+        }
 
         // Loop over elements
+        this->data.reserve(this->ElementCount);
         this->hasAllSymbols = true;
         assert(this->missingSymbols.has_value());
-        while (elementIndexIter) {
-            const auto& elementIndex = *elementIndexIter;
-            this->data.emplace_back(this->make_element_no_checks(elementIndex));
-            if (!this->data.back().hasSymbolPoly) {
-                this->missingSymbols->set(elementIndexIter.global());
+        for (size_t offset = 0; offset < this->ElementCount; ++offset) {
+            this->data.emplace_back(Polynomial{std::move(cg_terms[offset])});
+            if (!this->attempt_symbol_resolution(this->data.back())) {
+                this->missingSymbols->set(offset);
                 this->hasAllSymbols = false;
             }
-            ++elementIndexIter;
         }
     }
 }
\ No newline at end of file
@@ -84,6 +84,11 @@ namespace Moment {
         /** Try to get actual polynomial values for element, if they exist. */
         bool attempt_symbol_resolution(PolynomialElement& element) const;
 
+        /** Elements can be cached once their symbolic polynomial has been resolved. */
+        [[nodiscard]] bool can_cache_element(const PolynomialElement& element) const noexcept override {
+            return element.hasSymbolPoly;
+        }
+
     };
 
 }
\ No newline at end of file
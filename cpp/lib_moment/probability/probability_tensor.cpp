@@ -8,6 +8,7 @@
 #include "probability_tensor.h"
 
 #include "collins_gisin.h"
+#include "explicit_value_rules.h"
 
 #include "scenarios/context.h"
 #include "symbolic/polynomial_factory.h"
@@ -169,6 +170,43 @@ namespace Moment {
         return output;
     }
 
+    std::vector<Polynomial>
+    ProbabilityTensor::range_polynomials(const ProbabilityTensorRange& measurement) const {
+        std::vector<Polynomial> output;
+        output.reserve(measurement.size());
+        for (const ProbabilityTensorElement& elem : measurement) {
+            if (!elem.hasSymbolPoly) {
+                std::stringstream errSS;
+                errSS << "Can not find symbols for polynomial \"";
+                this->elem_as_string(errSS, elem);
+                errSS << "\".";
+                throw Moment::errors::BadPTError{errSS.str()};
+            }
+            output.emplace_back(elem.symbolPolynomial);
+        }
+        return output;
+    }
+
+    CompiledExplicitValueRules
+    ProbabilityTensor::compile_explicit_value_rules(const ProbabilityTensorRange& measurement) const {
+        const auto polynomials = this->range_polynomials(measurement);
+        return CompiledExplicitValueRules{this->symbolPolynomialFactory, polynomials, Polynomial::Scalar(1.0)};
+    }
+
+    CompiledExplicitValueRules
+    ProbabilityTensor::compile_explicit_value_rules(const ProbabilityTensorRange& measurement,
+                                                    const ProbabilityTensorElement& condition) const {
+        if (!condition.hasSymbolPoly) {
+            std::stringstream errSS;
+            errSS << "Can not find symbols for polynomial \"";
+            this->elem_as_string(errSS, condition);
+            errSS << "\".";
+            throw Moment::errors::BadPTError{errSS.str()};
+        }
+        const auto polynomials = this->range_polynomials(measurement);
+        return CompiledExplicitValueRules{this->symbolPolynomialFactory, polynomials, condition.symbolPolynomial};
+    }
+
     ProbabilityTensor::ElementConstructInfo
     ProbabilityTensor::element_info(const ProbabilityTensorIndexView indices) const {
         this->validate_index(indices);
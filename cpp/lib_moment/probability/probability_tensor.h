@@ -32,6 +32,7 @@ namespace Moment {
 
     };
 
+    class CompiledExplicitValueRules;
     class ProbabilityTensor;
 
     using ProbabilityTensorElement = PolynomialElement;
@@ -125,6 +126,23 @@ namespace Moment {
                                                                    const ProbabilityTensorElement& condition,
                                                                    std::span<const double> values) const;
 
+        /**
+         * Compile implicit probability rules for a (joint) probability distribution, for repeated evaluation.
+         * @param measurement
+         */
+        [[nodiscard]] CompiledExplicitValueRules
+        compile_explicit_value_rules(const ProbabilityTensorRange& measurement) const;
+
+        /**
+         * Compile implicit probability rules for a (joint) conditional probability distribution,
+         * for repeated evaluation.
+         * @param measurement
+         * @param conditional
+         */
+        [[nodiscard]] CompiledExplicitValueRules
+        compile_explicit_value_rules(const ProbabilityTensorRange& measurement,
+                                     const ProbabilityTensorElement& condition) const;
+
 
     protected:
         [[nodiscard]] ProbabilityTensorElement make_element_no_checks(IndexView index) const override;
@@ -143,6 +161,9 @@ namespace Moment {
 
         void make_dimension_info(const TensorConstructInfo& info);
 
+        /** Collect symbolic polynomials of every element in range, or throw if any are missing. */
+        [[nodiscard]] std::vector<Polynomial> range_polynomials(const ProbabilityTensorRange& measurement) const;
+
         void calculate_implicit_symbols();
 
         /** Deduce information about element, and write it to output. */
@@ -6,6 +6,7 @@
  */
 #include "algebraic_context.h"
 
+#include "commutative_osg.h"
 #include "name_table.h"
 
 #include "dictionary/operator_sequence.h"
@@ -24,12 +25,16 @@ namespace Moment::Algebraic {
         : Context{static_cast<size_t>(input_apc.num_operators)},
           precontext{input_apc},
           self_adjoint{input_apc.self_adjoint()},
-          commutative{commute}, rules{precontext, initial_rules}, op_names{std::move(names)} {
+          commutative{commute}, rules{precontext, initial_rules}, op_names{std::move(names)},
+          commutation{static_cast<size_t>(input_apc.num_operators)} {
 
         // Make rules
         if (this->commutative) {
             auto extra_rules = OperatorRulebook::commutator_rules(this->precontext);
             this->rules.add_rules(extra_rules);
+
+            // Normal rules are implied by commutation, so only user-supplied rules break sorted canonical form.
+            this->pure_commutative = initial_rules.empty();
         }
         if (!this->self_adjoint && normal) {
             auto extra_rules = OperatorRulebook::normal_rules(this->precontext);
@@ -40,6 +45,19 @@ namespace Moment::Algebraic {
         if (this->rules.size() == 0) {
             this->rules_completed.emplace(true);
         }
+
+        this->extract_commutation();
+    }
+
+    void AlgebraicContext::extract_commutation() {
+        this->commutation = PartialCommutation{static_cast<size_t>(this->precontext.num_operators)};
+        std::vector<OperatorRule> other_rules;
+        for (const auto& [hash, rule] : this->rules.rules()) {
+            if (!this->commutation.absorb(rule)) {
+                other_rules.emplace_back(rule);
+            }
+        }
+        this->non_commuting_rules = std::make_unique<OperatorRulebook>(this->precontext, other_rules);
     }
 
 
@@ -61,7 +79,15 @@ namespace Moment::Algebraic {
 
 
     std::optional<OperatorSequence> AlgebraicContext::get_if_canonical(const sequence_storage_t &sequence) const {
-        if (this->rules.can_reduce(sequence)) {
+        if (this->pure_commutative) {
+            if (!std::is_sorted(sequence.begin(), sequence.end())) {
+                return std::nullopt;
+            }
+        } else if (this->uses_trace_normal_form()) {
+            if (!this->commutation.is_normal(sequence) || this->non_commuting_rules->can_reduce(sequence)) {
+                return std::nullopt;
+            }
+        } else if (this->rules.can_reduce(sequence)) {
             return std::nullopt;
         }
         return std::make_optional<OperatorSequence>(OperatorSequence::ConstructRawFlag{},
@@ -71,6 +97,7 @@ namespace Moment::Algebraic {
 
     bool AlgebraicContext::attempt_completion(size_t max_attempts, RuleLogger * logger) {
         this->rules_completed.emplace(this->rules.complete(max_attempts, logger));
+        this->extract_commutation();
         return this->rules_completed.value();
     }
 
@@ -91,6 +118,27 @@ namespace Moment::Algebraic {
     bool AlgebraicContext::additional_simplification(sequence_storage_t& op_sequence, SequenceSignType& sign_type) const {
         if (this->commutative) {
             std::sort(op_sequence.begin(), op_sequence.end());
+
+            // Sorted sequence is canonical, if there are no further rules.
+            if (this->pure_commutative) {
+                return false;
+            }
+        }
+
+        // Alternate between trace monoid normal form, and the other rules, until neither change the sequence.
+        if (this->uses_trace_normal_form()) {
+            this->commutation.normalize(op_sequence);
+            while (true) {
+                const auto result = this->non_commuting_rules->reduce_in_place(op_sequence, sign_type);
+                if (result == OperatorRulebook::RawReductionResult::SetToZero) {
+                    op_sequence.clear();
+                    return true;
+                }
+                if ((result == OperatorRulebook::RawReductionResult::NoMatch)
+                    || !this->commutation.normalize(op_sequence)) {
+                    return false;
+                }
+            }
         }
 
         const auto result = this->rules.reduce_in_place(op_sequence, sign_type);
@@ -105,6 +153,35 @@ namespace Moment::Algebraic {
         return false;
     }
 
+    bool AlgebraicContext::is_canonical_concatenation(const OperatorSequence& /* lhs */,
+                                                      const OperatorSequence& /* rhs */) const noexcept {
+        return !this->commutative && this->rules.rules().empty();
+    }
+
+    OperatorSequence AlgebraicContext::multiply(const OperatorSequence& lhs, const OperatorSequence& rhs) const {
+        if (!this->pure_commutative) {
+            return Context::multiply(lhs, rhs);
+        }
+
+        if (lhs.zero() || rhs.zero()) [[unlikely]] {
+            return OperatorSequence::Zero(*this);
+        }
+
+        // Adding exponent vectors is equivalent to merging sorted sequences.
+        sequence_storage_t data;
+        data.reserve(lhs.size() + rhs.size());
+        std::merge(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::back_inserter(data));
+        return OperatorSequence{OperatorSequence::ConstructPresortedFlag{}, std::move(data), *this,
+                                lhs.get_sign() * rhs.get_sign()};
+    }
+
+    std::unique_ptr<OperatorSequenceGenerator> AlgebraicContext::new_osg(const size_t word_length) const {
+        if (this->pure_commutative) {
+            return std::make_unique<CommutativeOperatorSequenceGenerator>(*this, word_length);
+        }
+        return Context::new_osg(word_length);
+    }
+
     std::string AlgebraicContext::to_string() const {
         const size_t rule_count = this->rules.size();
 
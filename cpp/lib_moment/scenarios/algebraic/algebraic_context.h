@@ -13,6 +13,7 @@
 #include "algebraic_precontext.h"
 #include "operator_rule.h"
 #include "operator_rulebook.h"
+#include "partial_commutation.h"
 
 #include "symbolic/monomial.h"
 
@@ -52,6 +53,15 @@ namespace Moment::Algebraic {
         /** True if rules have been completed. */
         std::optional<bool> rules_completed = std::nullopt;
 
+        /** True if commutative, with no further rules; hence canonical sequences are exactly sorted sequences. */
+        bool pure_commutative = false;
+
+        /** Commutation relations (ba -> ab) found in rulebook, applied as trace monoid normal form. */
+        PartialCommutation commutation;
+
+        /** Rules in rulebook that are not commutation relations. */
+        std::unique_ptr<OperatorRulebook> non_commuting_rules;
+
     public:
         /**
          * Construct context from pre-context and names.
@@ -113,11 +123,44 @@ namespace Moment::Algebraic {
          */
         [[nodiscard]] bool is_complete() const;
 
+        /**
+         * True if context is commutative with no further rules, such that sequences are canonical if sorted.
+         * In this case, sequences are simplified by sorting, without invoking the rulebook.
+         */
+        [[nodiscard]] bool is_pure_commutative() const noexcept { return this->pure_commutative; }
+
+        /**
+         * True if commutation relations in the rulebook are applied directly as a trace monoid normal form, with only
+         * the remaining rules applied by rewriting.
+         */
+        [[nodiscard]] bool uses_trace_normal_form() const noexcept {
+            return !this->pure_commutative && !this->commutation.empty();
+        }
+
+        /**
+         * Commutation relations found in rulebook.
+         */
+        [[nodiscard]] const PartialCommutation& commutation_relations() const noexcept { return this->commutation; }
+
         /**
          * Simplify operator sequence using rules
          */
         bool additional_simplification(sequence_storage_t& op_sequence, SequenceSignType& negated) const final;
 
+        /**
+         * Concatenation is only known to be canonical in the free (non-commutative, rule-less) algebra.
+         */
+        [[nodiscard]] bool is_canonical_concatenation(const OperatorSequence& lhs,
+                                                      const OperatorSequence& rhs) const noexcept final;
+
+        /**
+         * Multiply operator sequences.
+         * In pure commutative mode, this is addition of exponent vectors (i.e. a merge of the sorted sequences).
+         */
+        [[nodiscard]] OperatorSequence multiply(const OperatorSequence& lhs, const OperatorSequence& rhs) const final;
+
+        using Context::multiply;
+
         /**
          * Summarize the context as a string.
          */
@@ -141,6 +184,11 @@ namespace Moment::Algebraic {
 
         std::optional<OperatorSequence> get_if_canonical(const sequence_storage_t &sequence) const override;
 
+        /**
+         * Generate operator sequences; in pure commutative mode, this enumerates exponent vectors directly.
+         */
+        [[nodiscard]] std::unique_ptr<OperatorSequenceGenerator> new_osg(size_t word_length) const override;
+
         /**
          * Access rule information.
          */
@@ -151,6 +199,10 @@ namespace Moment::Algebraic {
          */
         [[nodiscard]] const NameTable& names() const noexcept { return *this->op_names; }
 
+    private:
+        /** Split rulebook into commutation relations and other rules. */
+        void extract_commutation();
+
     public:
         /** Named c'tor. */
         static std::unique_ptr<AlgebraicContext> FromNameList(std::initializer_list<std::string> names);
@@ -53,7 +53,7 @@ namespace Moment::Algebraic {
 
         [[nodiscard]] HashedSequence conjugate(const HashedSequence& seq) const;
 
-        [[nodiscard]] inline size_t hash(const sequence_storage_t& rawSeq) const {
+        [[nodiscard]] inline hash_t hash(const sequence_storage_t& rawSeq) const {
             return this->hasher(rawSeq);
         }
     };
@@ -0,0 +1,90 @@
+/**
+ * commutative_osg.cpp
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+#include "commutative_osg.h"
+
+#include "algebraic_context.h"
+
+#include <cassert>
+
+namespace Moment::Algebraic {
+
+    CommutativeOperatorSequenceGenerator::CommutativeOperatorSequenceGenerator(const AlgebraicContext& context,
+                                                                               const size_t max_word_length)
+        : OperatorSequenceGenerator{context, max_word_length,
+                                    build_sorted_sequences(context, max_word_length)} {
+        assert(context.is_pure_commutative());
+    }
+
+    size_t CommutativeOperatorSequenceGenerator::count_of_length(const size_t operators, const size_t length) noexcept {
+        if (operators == 0) {
+            return (length == 0) ? 1 : 0;
+        }
+        // Binomial (operators + length - 1) choose length, multiplied out so that each step is exact.
+        size_t output = 1;
+        for (size_t k = 1; k <= length; ++k) {
+            output = (output * (operators - 1 + k)) / k;
+        }
+        return output;
+    }
+
+    std::vector<OperatorSequence>
+    CommutativeOperatorSequenceGenerator::build_sorted_sequences(const Context& context, const size_t max_len) {
+        const size_t op_count = context.size();
+
+        std::vector<OperatorSequence> output;
+        size_t expected_size = 1;
+        for (size_t length = 1; length <= max_len; ++length) {
+            expected_size += count_of_length(op_count, length);
+        }
+        output.reserve(expected_size);
+
+        // Always include identity
+        output.emplace_back(OperatorSequence::Identity(context));
+        if (op_count == 0) {
+            return output;
+        }
+
+        std::vector<size_t> exponents(op_count, 0);
+        sequence_storage_t word;
+        for (size_t length = 1; length <= max_len; ++length) {
+            // First exponent vector of length, in lexicographic order of words, is (length, 0, ..., 0).
+            std::fill(exponents.begin(), exponents.end(), 0);
+            exponents[0] = length;
+
+            while (true) {
+                // Write word from exponent vector
+                word.clear();
+                for (size_t op = 0; op < op_count; ++op) {
+                    for (size_t power = 0; power < exponents[op]; ++power) {
+                        word.emplace_back(static_cast<oper_name_t>(op));
+                    }
+                }
+                output.emplace_back(OperatorSequence::ConstructRawFlag{}, word, context.hash(word), context);
+
+                // Next exponent vector: move one power from the last non-zero entry (excluding the final operator)
+                // to its successor, and collect all later powers there too.
+                ptrdiff_t pivot = static_cast<ptrdiff_t>(op_count) - 2;
+                while ((pivot >= 0) && (exponents[pivot] == 0)) {
+                    --pivot;
+                }
+                if (pivot < 0) {
+                    break;
+                }
+                size_t tail = 1;
+                for (size_t op = pivot + 1; op < op_count; ++op) {
+                    tail += exponents[op];
+                    exponents[op] = 0;
+                }
+                --exponents[pivot];
+                exponents[pivot + 1] = tail;
+            }
+        }
+
+        assert(output.size() == expected_size);
+        return output;
+    }
+}
@@ -0,0 +1,42 @@
+/**
+ * commutative_osg.h
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+#pragma once
+
+#include "dictionary/operator_sequence_generator.h"
+
+#include <vector>
+
+namespace Moment::Algebraic {
+
+    class AlgebraicContext;
+
+    /**
+     * Operator sequence generator for algebraic contexts where all operators commute, with no further rules.
+     *
+     * In this case, canonical sequences are exactly the sorted sequences (i.e. multisets of operators), and are
+     * identified with exponent vectors. Rather than enumerating every word and testing it against the rulebook, the
+     * exponent vectors of each degree are enumerated directly. Sequences are emitted in the same order as the generic
+     * generator: by length, then lexicographically.
+     */
+    class CommutativeOperatorSequenceGenerator : public OperatorSequenceGenerator {
+    public:
+        CommutativeOperatorSequenceGenerator(const AlgebraicContext& context, size_t max_word_length);
+
+        /**
+         * Create all sorted sequences, up to max_len.
+         * @param context The context (hashing operator sequences).
+         * @param max_len The longest sequence to generate.
+         */
+        static std::vector<OperatorSequence> build_sorted_sequences(const Context& context, size_t max_len);
+
+        /**
+         * Number of sorted sequences of exactly the supplied length, on supplied number of operators.
+         * That is, the binomial coefficient (operators + length - 1, length).
+         */
+        [[nodiscard]] static size_t count_of_length(size_t operators, size_t length) noexcept;
+    };
+}
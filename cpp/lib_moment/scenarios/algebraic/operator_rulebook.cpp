@@ -417,7 +417,7 @@ namespace Moment::Algebraic {
 
             SubstringHashRange range{input, this->precontext.hasher.radix};
             return std::any_of(range.begin(), range.end(),
-                               [this](const uint64_t hash) { return this->monomialRules.contains(hash); });
+                               [this](const hash_t hash) { return this->monomialRules.contains(hash); });
 
         }
     }
@@ -437,7 +437,7 @@ namespace Moment::Algebraic {
             OperatorRule reduced_rule = this->reduce(isolated_rule);
 
             // By definition, reduction is non-increasing of hash, so we can reinsert "before" iterator
-            size_t reduced_hash = reduced_rule.LHS().hash();
+            hash_t reduced_hash = reduced_rule.LHS().hash();
             assert(isolated_rule.LHS().hash() >= reduced_hash);
 
             // If reduction makes rule trivial, it is redundant and can be removed from set...
@@ -536,7 +536,7 @@ namespace Moment::Algebraic {
                 if (logger) {
                     logger->rule_introduced(ruleA, ruleB, combined_reduced_rule);
                 }
-                size_t rule_hash = combined_reduced_rule.LHS().hash();
+                hash_t rule_hash = combined_reduced_rule.LHS().hash();
                 this->monomialRules.insert(std::make_pair(rule_hash, std::move(combined_reduced_rule)));
 
                 // Reduce ruleset
@@ -603,7 +603,7 @@ namespace Moment::Algebraic {
             logger->rule_introduced_conjugate(rule, conj_reduced_rule);
         }
 
-        size_t rule_hash = conj_reduced_rule.LHS().hash();
+        hash_t rule_hash = conj_reduced_rule.LHS().hash();
         this->monomialRules.insert(std::make_pair(rule_hash, std::move(conj_reduced_rule)));
 
         // Reduce ruleset
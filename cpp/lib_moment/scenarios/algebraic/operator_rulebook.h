@@ -78,7 +78,7 @@ namespace Moment::Algebraic {
         friend std::ostream& operator<<(std::ostream& os, RawReductionResult rrr);
 
     public:
-        using rule_map_t = std::map<size_t, OperatorRule>;
+        using rule_map_t = std::map<hash_t, OperatorRule>;
 
     private:
         AlgebraicPrecontext precontext;
@@ -0,0 +1,87 @@
+/**
+ * partial_commutation.cpp
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+#include "partial_commutation.h"
+
+#include "operator_rule.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace Moment::Algebraic {
+
+    PartialCommutation::PartialCommutation(const size_t operator_count) : operator_count{operator_count} {
+        this->commutes.reserve(operator_count);
+        for (size_t index = 0; index < operator_count; ++index) {
+            this->commutes.emplace_back(operator_count, false);
+        }
+    }
+
+    void PartialCommutation::set_commute(const oper_name_t a, const oper_name_t b) {
+        if ((a < 0) || (b < 0)
+            || (static_cast<size_t>(a) >= this->operator_count) || (static_cast<size_t>(b) >= this->operator_count)) {
+            throw std::range_error{"Operator out of range."};
+        }
+        if ((a == b) || this->commute(a, b)) {
+            return;
+        }
+        this->commutes[static_cast<size_t>(a)].set(static_cast<size_t>(b));
+        this->commutes[static_cast<size_t>(b)].set(static_cast<size_t>(a));
+        ++this->pair_count;
+    }
+
+    bool PartialCommutation::absorb(const OperatorRule& rule) {
+        const auto& lhs = rule.LHS();
+        const auto& rhs = rule.RHS();
+        if ((lhs.size() != 2) || (rhs.size() != 2) || rhs.zero()
+            || (rule.rule_sign() != SequenceSignType::Positive)) {
+            return false;
+        }
+        if ((lhs[0] == lhs[1]) || (lhs[0] != rhs[1]) || (lhs[1] != rhs[0])) {
+            return false;
+        }
+        this->set_commute(lhs[0], lhs[1]);
+        return true;
+    }
+
+    size_t PartialCommutation::insertion_point(const sequence_storage_t& sequence, const size_t index) const noexcept {
+        const oper_name_t op = sequence[index];
+        const auto& op_commutes = this->commutes[static_cast<size_t>(op)];
+
+        // Cannot move before last non-commuting operator (including copies of itself)
+        size_t first = index;
+        while ((first > 0) && op_commutes.test(static_cast<size_t>(sequence[first - 1]))) {
+            --first;
+        }
+
+        // Insert before first greater operator
+        while ((first < index) && (sequence[first] < op)) {
+            ++first;
+        }
+        return first;
+    }
+
+    bool PartialCommutation::normalize(sequence_storage_t& sequence) const {
+        bool changed = false;
+        for (size_t index = 1; index < sequence.size(); ++index) {
+            const size_t target = this->insertion_point(sequence, index);
+            if (target != index) {
+                std::rotate(sequence.begin() + target, sequence.begin() + index, sequence.begin() + index + 1);
+                changed = true;
+            }
+        }
+        return changed;
+    }
+
+    bool PartialCommutation::is_normal(const sequence_storage_t& sequence) const {
+        for (size_t index = 1; index < sequence.size(); ++index) {
+            if (this->insertion_point(sequence, index) != index) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
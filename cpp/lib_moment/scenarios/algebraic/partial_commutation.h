@@ -0,0 +1,79 @@
+/**
+ * partial_commutation.h
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+#pragma once
+
+#include "hashed_sequence.h"
+#include "integer_types.h"
+
+#include "utilities/dynamic_bitset.h"
+
+#include <vector>
+
+namespace Moment::Algebraic {
+
+    class OperatorRule;
+
+    /**
+     * Partial commutation relations between operators (i.e. a trace monoid).
+     *
+     * Sequences are brought into lexicographic normal form (the lexicographically smallest sequence obtainable by
+     * swapping adjacent commuting operators) in one pass, rather than by repeated application of rules ba -> ab.
+     */
+    class PartialCommutation {
+    private:
+        /** Number of operators. */
+        size_t operator_count;
+
+        /** Commutation bit-matrix: commutes[a].test(b) if ab = ba. */
+        std::vector<DynamicBitset<uint64_t>> commutes;
+
+        /** Number of (unordered) commuting pairs of distinct operators. */
+        size_t pair_count = 0;
+
+    public:
+        explicit PartialCommutation(size_t operator_count);
+
+        /** Declare that operators a and b commute. */
+        void set_commute(oper_name_t a, oper_name_t b);
+
+        /**
+         * If rule is of the form ba -> ab (for distinct a < b), record the commutation relation.
+         * @return True if rule was a commutation rule.
+         */
+        bool absorb(const OperatorRule& rule);
+
+        /** True if a and b commute. */
+        [[nodiscard]] inline bool commute(const oper_name_t a, const oper_name_t b) const noexcept {
+            return this->commutes[static_cast<size_t>(a)].test(static_cast<size_t>(b));
+        }
+
+        /** True if no distinct operators commute. */
+        [[nodiscard]] inline bool empty() const noexcept { return this->pair_count == 0; }
+
+        /** Number of (unordered) commuting pairs of distinct operators. */
+        [[nodiscard]] inline size_t pairs() const noexcept { return this->pair_count; }
+
+        /**
+         * Bring sequence into lexicographic normal form, in place.
+         *
+         * Each operator, in turn, is inserted into the normal form of the preceding prefix: at the first position after
+         * the last operator it does not commute with, and before the first greater operator.
+         * @complexity O(NK), for string length N, and K the typical distance to a non-commuting operator.
+         * @return True if sequence was changed.
+         */
+        bool normalize(sequence_storage_t& sequence) const;
+
+        /**
+         * True if sequence is in lexicographic normal form.
+         */
+        [[nodiscard]] bool is_normal(const sequence_storage_t& sequence) const;
+
+    private:
+        /** Position at which element at index should be inserted into normal form of sequence[0...index). */
+        [[nodiscard]] size_t insertion_point(const sequence_storage_t& sequence, size_t index) const noexcept;
+    };
+}
@@ -0,0 +1,44 @@
+/**
+ * canonical_moment_cache.h
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+#pragma once
+
+#include "integer_types.h"
+#include "hashed_sequence.h"
+
+#include "utilities/sharded_hash_map.h"
+
+namespace Moment {
+
+    /** Cached canonical moment: operators and their hash (sign is taken from the query). */
+    struct CanonicalMomentCacheEntry {
+        sequence_storage_t operators;
+        hash_t hash;
+    };
+
+    /**
+     * Memoizes the result of a context's simplify_as_moment, keyed by the hash of the raw (unaliased) sequence.
+     * Shared between threads; see ShardedHashMap.
+     */
+    class CanonicalMomentCache : public ShardedHashMap<CanonicalMomentCacheEntry> {
+    public:
+        using Entry = CanonicalMomentCacheEntry;
+
+        using ShardedHashMap<CanonicalMomentCacheEntry>::ShardedHashMap;
+        using ShardedHashMap<CanonicalMomentCacheEntry>::insert;
+
+        /**
+         * Register canonical moment of sequence with supplied hash.
+         * If the appropriate shard is full, or the sequence is already cached, no insertion is made.
+         * @param raw_hash The hash of the unaliased sequence.
+         * @param canonical The canonical form of the sequence.
+         */
+        inline void insert(const hash_t raw_hash, const HashedSequence& canonical) {
+            this->insert(raw_hash, Entry{canonical.raw(), canonical.hash()});
+        }
+    };
+
+}
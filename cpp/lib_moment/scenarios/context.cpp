@@ -19,7 +19,8 @@
 namespace Moment {
 
     Context::Context(const size_t count)
-        : operator_count{static_cast<oper_name_t>(count)}, hasher{count} {
+        : operator_count{static_cast<oper_name_t>(count)}, hasher{count},
+          recorder{std::make_unique<Instrumentation::Recorder>()} {
         this->word_list = std::make_unique<Dictionary>(*this);
     }
 
@@ -36,6 +37,13 @@ namespace Moment {
             return OperatorSequence::Zero(*this);
         }
 
+        // If no rewriting is required, compose hash from those of LHS and RHS
+        if (lhs.empty() || rhs.empty() || this->is_canonical_concatenation(lhs, rhs)) {
+            auto joined = HashedSequence::concatenate(lhs, rhs, this->hasher);
+            return OperatorSequence{OperatorSequence::ConstructRawFlag{}, std::move(joined.raw()), joined.hash(),
+                                    *this, joined.get_sign()};
+        }
+
         // Append RHS to LHS
         auto make_data = [&lhs, &rhs]() -> sequence_storage_t {
             sequence_storage_t data;
@@ -94,7 +102,7 @@ namespace Moment {
         return compare.hash() != seq.hash();
     }
 
-    size_t Context::hash(const OperatorSequence &sequence) const noexcept {
+    hash_t Context::hash(const OperatorSequence &sequence) const noexcept {
         if (sequence.zero()) {
             return 0;
         }
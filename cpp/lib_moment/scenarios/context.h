@@ -12,6 +12,8 @@
 
 #include "contextual_os.h"
 
+#include "instrumentation/instrumentation.h"
+
 #include <iosfwd>
 #include <optional>
 #include <string>
@@ -32,6 +34,9 @@ namespace Moment {
         ShortlexHasher hasher;
 
     private:
+        /** Phase timings and counters, for matrix systems using this context. */
+        std::unique_ptr<Instrumentation::Recorder> recorder;
+
         /** List of operator-sequence-generators */
         std::unique_ptr<Dictionary> word_list;
 
@@ -67,6 +72,18 @@ namespace Moment {
          */
          virtual bool additional_simplification(sequence_storage_t& op_sequence, SequenceSignType& sign) const;
 
+         /**
+          * True if the concatenation of two canonical operator strings is already canonical (i.e. would not be
+          * changed by additional_simplification), such that products can compose hashes instead of rehashing.
+          * Defaults to false; contexts opt in to hash composition by overriding this where it is known to be safe.
+          * @param lhs The (canonical, non-empty) left-hand-side of the concatenation.
+          * @param rhs The (canonical, non-empty) right-hand-side of the concatenation.
+          */
+         [[nodiscard]] virtual bool is_canonical_concatenation(const OperatorSequence& /* lhs */,
+                                                               const OperatorSequence& /* rhs */) const noexcept {
+             return false;
+         }
+
          /**
           * Use context to multiply together two operator strings.
           * @param lhs The left-hand-side of the multiplication.
@@ -146,7 +163,7 @@ namespace Moment {
           * @param seq The operator sequence to calculate the hash of.
           * @return An integer hash.
           */
-         [[nodiscard]] size_t hash(const OperatorSequence& seq) const noexcept;
+         [[nodiscard]] hash_t hash(const OperatorSequence& seq) const noexcept;
 
          /**
           * Calculates a non-colliding hash (i.e. unique number) for a particular operator sequence.
@@ -156,7 +173,7 @@ namespace Moment {
           * @param seq The raw operator sequence to calculate the hash of.
           * @return An integer hash.
           */
-         [[nodiscard]] size_t hash(const sequence_storage_t& rawSeq) const noexcept {
+         [[nodiscard]] hash_t hash(const sequence_storage_t& rawSeq) const noexcept {
              return this->hasher(rawSeq);
          }
 
@@ -211,6 +228,11 @@ namespace Moment {
           */
          [[nodiscard]] Dictionary& dictionary() noexcept { return *this->word_list; }
 
+         /**
+          * Phase timings and counters, recorded if compiled with MOMENT_INSTRUMENTATION. Thread-safe.
+          */
+         [[nodiscard]] Instrumentation::Recorder& instrumentation() const noexcept { return *this->recorder; }
+
          /**
           * Gets an operator sequence, but only if it is 'canonical' (i.e. no simplifications performed on it)
           */
@@ -124,6 +124,24 @@ namespace Moment::Derived {
         create_localizing_matrix(const WriteLock& lock, const LocalizingMatrixIndex &lmi,
                                  Multithreading::MultiThreadPolicy mt_policy) override;
 
+        /**
+         * Derived matrices are transformed from source matrices, so are not prepared from operator matrices.
+         */
+        [[nodiscard]] PreparedMonomialMatrix
+        prepare_moment_matrix(const ReadLock& /* lock */, size_t /* level */,
+                              Multithreading::MultiThreadPolicy /* mt_policy */) override {
+            return {};
+        }
+
+        /**
+         * Derived matrices are transformed from source matrices, so are not prepared from operator matrices.
+         */
+        [[nodiscard]] PreparedMonomialMatrix
+        prepare_localizing_matrix(const ReadLock& /* lock */, const LocalizingMatrixIndex& /* lmi */,
+                                  Multithreading::MultiThreadPolicy /* mt_policy */) override {
+            return {};
+        }
+
         [[nodiscard]] std::unique_ptr<class PolynomialMatrix>
         create_polynomial_localizing_matrix(const MaintainsMutex::WriteLock &lock,
                                             const PolynomialLocalizingMatrixIndex &index,
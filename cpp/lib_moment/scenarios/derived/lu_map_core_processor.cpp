@@ -11,8 +11,145 @@
 #include <Eigen/SparseLU>
 
 #include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <vector>
 
 namespace Moment::Derived {
+
+    namespace {
+        /**
+         * Incrementally built basis of sparse rows in echelon form, with threshold (largest-entry) pivoting.
+         *
+         * Each added row is reduced against the existing basis, in order of basis creation; any remainder above the
+         * tolerance becomes a new basis row. This gives a sparse L (coefficients of basis rows, unit entry where a
+         * row generates a new basis element) and sparse U (the basis), as in a rank-revealing LU decomposition, but
+         * touches only the non-zero structure of the matrix.
+         */
+        class SparseRowEchelon {
+        private:
+            using sparse_row_t = std::vector<std::pair<Eigen::Index, double>>;
+
+            const Eigen::Index width;
+            const double zero_tolerance;
+
+            /** Basis rows, each with exactly one entry in a pivot column not present in preceding rows. */
+            std::vector<sparse_row_t> basis;
+            /** Pivot column of each basis row. */
+            std::vector<Eigen::Index> pivot_col;
+            /** Value of pivot entry of each basis row. */
+            std::vector<double> pivot_value;
+            /** Basis row pivoting on column, or -1. */
+            std::vector<Eigen::Index> basis_of_col;
+
+            // Dense work-space for current row:
+            std::vector<double> values;
+            std::vector<bool> occupied;
+            std::vector<Eigen::Index> touched;
+            std::vector<bool> queued;
+            std::priority_queue<Eigen::Index, std::vector<Eigen::Index>, std::greater<>> to_eliminate;
+
+        public:
+            SparseRowEchelon(const Eigen::Index width, const double zero_tolerance)
+                : width{width}, zero_tolerance{zero_tolerance}, basis_of_col(width, -1),
+                  values(width, 0.0), occupied(width, false) { }
+
+            [[nodiscard]] size_t rank() const noexcept { return this->basis.size(); }
+
+            /**
+             * Reduce row of matrix against basis, writing its coefficients into the map triplets.
+             */
+            void add_row(const Eigen::SparseMatrix<double, Eigen::RowMajor>& matrix, const Eigen::Index row,
+                         std::vector<Eigen::Triplet<double>>& map_triplets) {
+                // Scatter row into work-space
+                for (Eigen::SparseMatrix<double, Eigen::RowMajor>::InnerIterator iter{matrix, row}; iter; ++iter) {
+                    this->scatter(iter.col(), iter.value());
+                }
+
+                // Eliminate pivot columns, in order of basis row creation
+                while (!this->to_eliminate.empty()) {
+                    const Eigen::Index basis_index = this->to_eliminate.top();
+                    this->to_eliminate.pop();
+
+                    const Eigen::Index col = this->pivot_col[basis_index];
+                    if (std::abs(this->values[col]) > this->zero_tolerance) {
+                        const double factor = this->values[col] / this->pivot_value[basis_index];
+                        map_triplets.emplace_back(row, basis_index, factor);
+                        for (const auto& [basis_col, basis_value] : this->basis[basis_index]) {
+                            this->scatter(basis_col, -factor * basis_value);
+                        }
+                    }
+                    this->values[col] = 0.0;
+                    this->queued[basis_index] = false; // NB: after scatter, which also hits own pivot.
+                }
+
+                // Gather remainder
+                sparse_row_t remainder;
+                Eigen::Index best_col = -1;
+                double best_abs = this->zero_tolerance;
+                std::sort(this->touched.begin(), this->touched.end());
+                for (const auto col : this->touched) {
+                    const double value = this->values[col];
+                    const double abs_value = std::abs(value);
+                    if (abs_value > this->zero_tolerance) {
+                        remainder.emplace_back(col, value);
+                        if (abs_value > best_abs) {
+                            best_abs = abs_value;
+                            best_col = col;
+                        }
+                    }
+                    this->values[col] = 0.0;
+                    this->occupied[col] = false;
+                }
+                this->touched.clear();
+
+                // Remainder becomes new basis row
+                if (best_col >= 0) {
+                    const auto new_index = static_cast<Eigen::Index>(this->basis.size());
+                    map_triplets.emplace_back(row, new_index, 1.0);
+                    this->basis_of_col[best_col] = new_index;
+                    this->pivot_col.emplace_back(best_col);
+                    this->pivot_value.emplace_back(std::find_if(remainder.cbegin(), remainder.cend(),
+                                                                [best_col](const auto& entry) {
+                                                                    return entry.first == best_col;
+                                                                })->second);
+                    this->basis.emplace_back(std::move(remainder));
+                    this->queued.emplace_back(false);
+                }
+            }
+
+            /** Basis as (rank x width) sparse matrix. */
+            [[nodiscard]] Eigen::SparseMatrix<double> basis_matrix() const {
+                std::vector<Eigen::Triplet<double>> triplets;
+                for (Eigen::Index basis_index = 0; basis_index < static_cast<Eigen::Index>(this->basis.size());
+                     ++basis_index) {
+                    for (const auto& [col, value] : this->basis[basis_index]) {
+                        triplets.emplace_back(basis_index, col, value);
+                    }
+                }
+                Eigen::SparseMatrix<double> output(static_cast<Eigen::Index>(this->basis.size()), this->width);
+                output.setFromTriplets(triplets.begin(), triplets.end());
+                return output;
+            }
+
+        private:
+            void scatter(const Eigen::Index col, const double value) {
+                if (!this->occupied[col]) {
+                    this->occupied[col] = true;
+                    this->touched.emplace_back(col);
+                }
+                this->values[col] += value;
+                const Eigen::Index basis_index = this->basis_of_col[col];
+                if ((basis_index >= 0) && !this->queued[basis_index]) {
+                    this->queued[basis_index] = true;
+                    this->to_eliminate.push(basis_index);
+                }
+            }
+        };
+    }
+
     LUMapCoreProcessor::~LUMapCoreProcessor() noexcept = default;
 
     std::unique_ptr<SolvedMapCore> LUMapCoreProcessor::operator()(const DenseMapCore &core) const {
@@ -62,9 +199,30 @@ namespace Moment::Derived {
             return solutionPtr;
         }
 
-       // Rational: Still looking for suitable rank-revealing LU decomposition for sparse matrices.
-       //           Eigen's built-in solvers are only for full-rank (i.e. useless here!) decompositions.
-       throw std::logic_error{"LUMapCoreProcessor::operator()(const SparseMapCore &core) is currently not supported."};
+        // Rank-revealing sparse elimination: rows of core are inputs, written as combinations of basis rows.
+        const Eigen::SparseMatrix<double, Eigen::RowMajor> rows_of_core{core.core};
+        double max_abs = 0.0;
+        for (Eigen::Index index = 0; index < rows_of_core.nonZeros(); ++index) {
+            max_abs = std::max(max_abs, std::abs(rows_of_core.valuePtr()[index]));
+        }
+        const double zero_tolerance = max_abs * std::numeric_limits<double>::epsilon()
+                                      * static_cast<double>(std::max(input_rows, input_cols));
+
+        SparseRowEchelon echelon{input_cols, zero_tolerance};
+        std::vector<Eigen::Triplet<double>> map_triplets;
+        for (Eigen::Index row = 0; row < input_rows; ++row) {
+            echelon.add_row(rows_of_core, row, map_triplets);
+        }
 
+        const auto rank = static_cast<Eigen::Index>(echelon.rank());
+        solution.output_symbols = static_cast<size_t>(rank);
+        solution.trivial_solution = false;
+        solution.sparse_solution = true;
+
+        solution.sparse_map.resize(input_rows, rank);
+        solution.sparse_map.setFromTriplets(map_triplets.begin(), map_triplets.end());
+        solution.sparse_inv_map = echelon.basis_matrix();
+
+        return solutionPtr;
     }
 }
\ No newline at end of file
@@ -21,6 +21,9 @@ namespace Moment::Derived {
      * In particular, let [L, U] = lu(X') be the lower and upper triangular decomposition (up to some permutation).
      * Then, U is a matrix whose rows defines the new symbols in terms of the old ones; and L is a matrix whose rows
      * tells us which elements of y we should replace the original (pre-transformation) symbols in x with.
+     *
+     * Dense cores are decomposed with Eigen's full-pivoting LU. Sparse cores are decomposed by sparse row elimination
+     * with threshold pivoting, such that only the non-zero structure of the core (and its fill-in) is touched.
      */
     class LUMapCoreProcessor : public MapCoreProcessor {
     public:
@@ -9,12 +9,14 @@
 
 #include "derived_errors.h"
 
+#include "multithreading/fan_out.h"
 #include "symbolic/symbol_table.h"
 
 #include "utilities/float_utils.h"
 
 #include <cmath>
 
+#include <algorithm>
 #include <limits>
 #include <sstream>
 
@@ -35,8 +37,72 @@ namespace Moment::Derived {
 
     }
 
+    namespace {
+        /** Results of scanning a contiguous range of columns of the raw map. */
+        struct ColumnScan {
+            /** Rows in which non-trivial columns have entries. */
+            DynamicBitset<size_t> nontrivial_rows;
+
+            /** Columns found to be trivial (skipped, zero or constant). */
+            std::vector<size_t> trivial_cols;
+
+            /** Constant values of columns found to be constant (or zero). */
+            std::vector<std::pair<size_t, double>> constants;
+
+            explicit ColumnScan(const size_t row_count) : nontrivial_rows{row_count, false} { }
+        };
+
+        /**
+         * Apply scan_column to every column after the first, either in serial or split into contiguous chunks across
+         * worker threads. Each chunk has its own ColumnScan, so the scanning functor requires no synchronization.
+         */
+        template<typename functor_t>
+        std::vector<ColumnScan> scan_columns(const size_t col_count, const size_t row_count,
+                                             const bool multithread, const functor_t& scan_column) {
+            const size_t chunk_count = multithread ? std::max<size_t>(1, std::min(Multithreading::get_max_worker_threads(),
+                                                                                  col_count / 64))
+                                                   : 1;
+            std::vector<ColumnScan> output;
+            output.reserve(chunk_count);
+            for (size_t chunk = 0; chunk < chunk_count; ++chunk) {
+                output.emplace_back(row_count);
+            }
+
+            const size_t chunk_size = (col_count + chunk_count - 2) / chunk_count;
+            auto do_chunk = [&](const size_t chunk) {
+                const size_t first = 1 + (chunk * chunk_size);
+                const size_t last = std::min(col_count, first + chunk_size);
+                for (size_t col_index = first; col_index < last; ++col_index) {
+                    scan_column(col_index, output[chunk]);
+                }
+            };
+
+            if (chunk_count == 1) {
+                do_chunk(0);
+                return output;
+            }
+
+            Multithreading::fan_out(chunk_count, do_chunk);
+            return output;
+        }
+
+        /** Combine results of column scans into map core. */
+        void merge_scans(MapCore& core, const std::vector<ColumnScan>& scans) {
+            for (const auto& scan : scans) {
+                core.nontrivial_rows |= scan.nontrivial_rows;
+                for (const auto col : scan.trivial_cols) {
+                    core.nontrivial_cols.unset(col);
+                }
+                for (const auto& [col, value] : scan.constants) {
+                    core.constants.emplace(col, value);
+                }
+            }
+        }
+    }
+
     std::pair<Eigen::Index, Eigen::Index>
-    MapCore::identify_nontrivial(const Eigen::MatrixXd& input_dense, double eps_mult) {
+    MapCore::identify_nontrivial(const Eigen::MatrixXd& input_dense, const double eps_mult,
+                                 const Multithreading::MultiThreadPolicy mt_policy) {
 
         this->nontrivial_cols[0] = false;
         this->nontrivial_rows[0] = true;
@@ -60,38 +126,36 @@ namespace Moment::Derived {
             throw errors::bad_map{"First column of transformation must map identity to the identity."};
         }
 
-        for (int col_index = 1; col_index < input_dense.cols(); ++col_index) {
+        auto scan_column = [&](const size_t col, ColumnScan& scan) {
+            const auto col_index = static_cast<Eigen::Index>(col);
+
             // Skip columns (and mark as trivial)
-            if (this->skipped_cols.test(col_index)) {
-                this->nontrivial_cols[col_index] = false;
-                continue;
+            if (this->skipped_cols.test(col)) {
+                scan.trivial_cols.emplace_back(col);
+                return;
             }
 
-
             // Identify rows with no values, or only a constant value:
             const bool hasConstant = !approximately_zero(input_dense(0, col_index), eps_mult);
             const bool hasAnythingElse = col_has_any_non_constant(col_index);
             if (!hasAnythingElse) {
-                if (!hasConstant) {
-                    this->constants.emplace(std::make_pair(col_index, 0));
-                    this->nontrivial_cols[col_index] = false;
-                    continue;
-                } else {
-                    const double offset_term = input_dense.coeff(0, col_index);
-                    this->constants.emplace(std::make_pair(col_index, offset_term));
-                    this->nontrivial_cols[col_index] = false;
-                    continue;
-                }
+                scan.constants.emplace_back(col, hasConstant ? input_dense.coeff(0, col_index) : 0.0);
+                scan.trivial_cols.emplace_back(col);
+                return;
             }
 
             // Otherwise, column is nontrivial - identify rows that are nontrivial
-            for (auto row_iter = Eigen::MatrixXd::InnerIterator{input_dense, col_index};
-                 row_iter; ++row_iter) {
+            for (auto row_iter = Eigen::MatrixXd::InnerIterator{input_dense, col_index}; row_iter; ++row_iter) {
                 if (!approximately_zero(row_iter.value(), eps_mult)) {
-                    this->nontrivial_rows[row_iter.row()] = true;
+                    scan.nontrivial_rows.set(static_cast<size_t>(row_iter.row()));
                 }
             }
-        }
+        };
+
+        const bool multithread = Multithreading::should_multithread_map_core(mt_policy,
+                                                                             input_dense.rows() * input_dense.cols());
+        merge_scans(*this, scan_columns(static_cast<size_t>(input_dense.cols()), static_cast<size_t>(input_dense.rows()),
+                                       multithread, scan_column));
 
         // Constant offset handled separately...
         this->nontrivial_rows[0] = false;
@@ -101,7 +165,8 @@ namespace Moment::Derived {
     }
 
     std::pair<Eigen::Index, Eigen::Index>
-    MapCore::identify_nontrivial(const Eigen::SparseMatrix<double>& input_sparse) {
+    MapCore::identify_nontrivial(const Eigen::SparseMatrix<double>& input_sparse,
+                                 const Multithreading::MultiThreadPolicy mt_policy) {
 
         this->nontrivial_cols[0] = false;
         this->nontrivial_rows[0] = true;
@@ -111,35 +176,42 @@ namespace Moment::Derived {
             throw errors::bad_map{"First column of transformation must map identity to the identity."};
         }
 
-        for (int col_index = 1; col_index < input_sparse.cols(); ++col_index) {
+        auto scan_column = [&](const size_t col, ColumnScan& scan) {
+            const auto col_index = static_cast<Eigen::Index>(col);
 
             // Skip columns (and mark as trivial)
-            if (this->skipped_cols.test(col_index)) {
-                this->nontrivial_cols[col_index] = false;
-                continue;
+            if (this->skipped_cols.test(col)) {
+                scan.trivial_cols.emplace_back(col);
+                return;
             }
 
             // Identify rows with no values, or only a constant value:
             Eigen::Index nnz = input_sparse.col(col_index).nonZeros();
             if (0 == nnz) {
-                this->constants.emplace(std::make_pair(static_cast<size_t>(col_index), 0));
-                this->nontrivial_cols[col_index] = false;
-                continue;
+                scan.constants.emplace_back(col, 0.0);
+                scan.trivial_cols.emplace_back(col);
+                return;
             } else if (1 == nnz) {
                 const double offset_term = input_sparse.coeff(0, col_index);
                 if (offset_term > 0) {
-                    this->constants.emplace(std::make_pair(static_cast<size_t>(col_index), offset_term));
-                    this->nontrivial_cols[col_index] = false;
-                    continue;
+                    scan.constants.emplace_back(col, offset_term);
+                    scan.trivial_cols.emplace_back(col);
+                    return;
                 }
             }
 
             // Otherwise, column is nontrivial - identify rows that are nontrivial
             for (auto row_iter = Eigen::SparseMatrix<double>::InnerIterator{input_sparse, col_index};
                  row_iter; ++row_iter) {
-                this->nontrivial_rows[row_iter.row()] = true;
+                scan.nontrivial_rows.set(static_cast<size_t>(row_iter.row()));
             }
-        }
+        };
+
+        const bool multithread = Multithreading::should_multithread_map_core(mt_policy,
+                                                                             input_sparse.nonZeros());
+        merge_scans(*this, scan_columns(static_cast<size_t>(input_sparse.cols()),
+                                       static_cast<size_t>(input_sparse.rows()),
+                                       multithread, scan_column));
 
         // Constant offset handled separately...
         this->nontrivial_rows[0] = false;
@@ -148,6 +220,16 @@ namespace Moment::Derived {
                 static_cast<Eigen::Index>(this->nontrivial_rows.count())};
     }
 
+    bool MapCore::prefer_sparse(const Eigen::SparseMatrix<double>& raw_map) noexcept {
+        // Small maps: dense decomposition is cheap, and gives the canonical FullPivLU form.
+        if (raw_map.cols() < minimum_sparse_core_dimension) {
+            return false;
+        }
+        const double fill = static_cast<double>(raw_map.nonZeros())
+                            / (static_cast<double>(raw_map.rows()) * static_cast<double>(raw_map.cols()));
+        return fill <= maximum_sparse_core_fill;
+    }
+
 
     // Make map from 'old' index to new
     std::vector<Eigen::Index> MapCore::remap_vector(DynamicBitset<size_t> nontrivial)  {
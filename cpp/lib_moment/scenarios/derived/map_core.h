@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "multithreading/multithreading.h"
 #include "utilities/dynamic_bitset.h"
 
 #include <Eigen/Core>
@@ -115,6 +116,12 @@ namespace Moment {
             /** Constant offset to add to the non-trivial parts of the map. */
             Eigen::RowVectorXd core_offset;
 
+            /** Number of source symbols below which a dense core is always preferred. */
+            constexpr static const Eigen::Index minimum_sparse_core_dimension = 512;
+
+            /** Maximum proportion of non-zero elements in raw map, for a sparse core to be preferred. */
+            constexpr static const double maximum_sparse_core_fill = 0.05;
+
         public:
 
             MapCore(size_t initial_src_size, size_t initial_target_size, DynamicBitset<size_t> skipped);
@@ -133,12 +140,30 @@ namespace Moment {
              */
             virtual void check_solution(const SolvedMapCore& solution) const = 0;
 
+            /**
+             * True if the core of the supplied raw map is better handled as a sparse matrix than a dense one.
+             * This is the case for large maps with few non-zero entries per column.
+             */
+            [[nodiscard]] static bool prefer_sparse(const Eigen::SparseMatrix<double>& raw_map) noexcept;
+
         protected:
-            /** Peel off constant/zero columns, and empty rows. */
-            std::pair<Eigen::Index, Eigen::Index> identify_nontrivial(const Eigen::MatrixXd& input_dense, double eps_mult=1.0);
+            /**
+             * Peel off constant/zero columns, and empty rows.
+             * For large matrices, columns are scanned in parallel (according to mt_policy).
+             */
+            std::pair<Eigen::Index, Eigen::Index>
+            identify_nontrivial(const Eigen::MatrixXd& input_dense, double eps_mult = 1.0,
+                                Multithreading::MultiThreadPolicy mt_policy
+                                    = Multithreading::MultiThreadPolicy::Optional);
 
-            /** Peel off constant/zero columns, and empty rows. */
-            std::pair<Eigen::Index, Eigen::Index> identify_nontrivial(const Eigen::SparseMatrix<double>& input_dense);
+            /**
+             * Peel off constant/zero columns, and empty rows.
+             * For large matrices, columns are scanned in parallel (according to mt_policy).
+             */
+            std::pair<Eigen::Index, Eigen::Index>
+            identify_nontrivial(const Eigen::SparseMatrix<double>& input_dense,
+                                Multithreading::MultiThreadPolicy mt_policy
+                                    = Multithreading::MultiThreadPolicy::Optional);
 
             static std::vector<Eigen::Index> remap_vector(DynamicBitset<size_t> nontrivial);
 
@@ -85,7 +85,12 @@ namespace Moment::Derived {
 
         auto [osg_to_sym, conjugates] = unzip_indices(this->origin_symbols, src.cols());
 
-        this->core = std::make_unique<DenseMapCore>(conjugates, src);
+        // Large maps with low fill are decomposed sparsely; otherwise, use dense decomposition.
+        if (MapCore::prefer_sparse(src)) {
+            this->core = std::make_unique<SparseMapCore>(conjugates, src);
+        } else {
+            this->core = std::make_unique<DenseMapCore>(conjugates, src);
+        }
         this->core_solution = core->accept(processor);
         this->construct_map(osg_to_sym, conjugates);
         this->populate_target_symbols();
@@ -112,8 +117,16 @@ namespace Moment::Derived {
             this->map[symbol_id] = Polynomial::Scalar(scalar);
         }
 
+        // Prefer dense solution if supplied, otherwise use sparse solution.
+        const bool use_sparse = this->core_solution->sparse_solution && !this->core_solution->dense_solution;
         const auto& raw_map = this->core_solution->dense_map;
         const auto& raw_inv_map = this->core_solution->dense_inv_map;
+        Eigen::SparseMatrix<double, Eigen::RowMajor> sparse_map_rows;
+        Eigen::SparseMatrix<double, Eigen::RowMajor> sparse_inv_map_rows;
+        if (use_sparse) {
+            sparse_map_rows = this->core_solution->sparse_map;
+            sparse_inv_map_rows = this->core_solution->sparse_inv_map;
+        }
 
         // Create non-trivial map:
         Eigen::Index core_col_id = 0;
@@ -130,12 +143,21 @@ namespace Moment::Derived {
             }
 
             // Non-trivial parts
-            for (Eigen::Index map_col_id = 0, map_col_max = raw_map.cols();
-                map_col_id < map_col_max; ++map_col_id) {
-                const auto as_symbol = static_cast<symbol_name_t>(map_col_id + 2);
-                const double value = raw_map(core_col_id, map_col_id);
-                if (!approximately_zero(value)) {
-                    from_x_to_y.emplace_back(as_symbol, value);
+            if (use_sparse) {
+                for (Eigen::SparseMatrix<double, Eigen::RowMajor>::InnerIterator iter{sparse_map_rows, core_col_id};
+                     iter; ++iter) {
+                    if (!approximately_zero(iter.value())) {
+                        from_x_to_y.emplace_back(static_cast<symbol_name_t>(iter.col() + 2), iter.value());
+                    }
+                }
+            } else {
+                for (Eigen::Index map_col_id = 0, map_col_max = raw_map.cols();
+                     map_col_id < map_col_max; ++map_col_id) {
+                    const auto as_symbol = static_cast<symbol_name_t>(map_col_id + 2);
+                    const double value = raw_map(core_col_id, map_col_id);
+                    if (!approximately_zero(value)) {
+                        from_x_to_y.emplace_back(as_symbol, value);
+                    }
                 }
             }
 
@@ -153,18 +175,39 @@ namespace Moment::Derived {
         this->inverse_map.emplace_back(Polynomial{});      // 0 -> 0 always.
         this->inverse_map.emplace_back(Polynomial::Scalar(1.0)); // 1 -> 1 always.
 
+        std::vector<size_t> nontrivial_row_indices;
+        if (use_sparse) {
+            nontrivial_row_indices.reserve(this->core->nontrivial_rows.count());
+            for (auto non_trivial_idx : this->core->nontrivial_rows) {
+                nontrivial_row_indices.emplace_back(non_trivial_idx);
+            }
+        }
+
         for (Eigen::Index im_row_id = 0; im_row_id < this->core_solution->output_symbols; ++im_row_id) {
             Polynomial::storage_t from_y_to_x;
-            assert(this->core->nontrivial_rows.count() == this->core_solution->dense_inv_map.cols());
 
-            Eigen::Index im_col_id = 0;
-            for (auto non_trivial_idx : this->core->nontrivial_rows) {
-                const double value = raw_inv_map(im_row_id, im_col_id);
-                if (abs(value) != 0.0) {
-                    // Map: Core index -> osg index -> symbol table ID
-                    from_y_to_x.emplace_back(osg_to_symbols[non_trivial_idx], value, osg_conjugate[non_trivial_idx]);
+            if (use_sparse) {
+                assert(static_cast<Eigen::Index>(nontrivial_row_indices.size()) == sparse_inv_map_rows.cols());
+                for (Eigen::SparseMatrix<double, Eigen::RowMajor>::InnerIterator iter{sparse_inv_map_rows, im_row_id};
+                     iter; ++iter) {
+                    if (abs(iter.value()) != 0.0) {
+                        const size_t non_trivial_idx = nontrivial_row_indices[iter.col()];
+                        from_y_to_x.emplace_back(osg_to_symbols[non_trivial_idx], iter.value(),
+                                                 osg_conjugate[non_trivial_idx]);
+                    }
+                }
+            } else {
+                assert(this->core->nontrivial_rows.count() == this->core_solution->dense_inv_map.cols());
+                Eigen::Index im_col_id = 0;
+                for (auto non_trivial_idx : this->core->nontrivial_rows) {
+                    const double value = raw_inv_map(im_row_id, im_col_id);
+                    if (abs(value) != 0.0) {
+                        // Map: Core index -> osg index -> symbol table ID
+                        from_y_to_x.emplace_back(osg_to_symbols[non_trivial_idx], value,
+                                                 osg_conjugate[non_trivial_idx]);
+                    }
+                    ++im_col_id;
                 }
-                ++ im_col_id;
             }
             this->inverse_map.emplace_back(std::move(from_y_to_x));
         }
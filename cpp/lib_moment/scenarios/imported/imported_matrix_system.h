@@ -63,6 +63,18 @@ namespace Moment::Imported {
         create_localizing_matrix(const WriteLock& lock, const LocalizingMatrixIndex &lmi,
                                  Multithreading::MultiThreadPolicy mt_policy) override;
 
+        PreparedMonomialMatrix
+        prepare_moment_matrix(const ReadLock& /* lock */, size_t /* level */,
+                              Multithreading::MultiThreadPolicy /* mt_policy */) override {
+            return {};
+        }
+
+        PreparedMonomialMatrix
+        prepare_localizing_matrix(const ReadLock& /* lock */, const LocalizingMatrixIndex& /* lmi */,
+                                  Multithreading::MultiThreadPolicy /* mt_policy */) override {
+            return {};
+        }
+
         std::unique_ptr<class PolynomialMatrix>
         create_polynomial_localizing_matrix(const WriteLock &lock, const PolynomialLocalizingMatrixIndex &index,
                                             Multithreading::MultiThreadPolicy mt_policy) override;
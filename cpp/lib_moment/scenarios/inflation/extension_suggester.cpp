@@ -1,6 +1,6 @@
 /**
  * extension_suggester.cpp
- * 
+ *
  * @copyright Copyright (c) 2023 Austrian Academy of Sciences
  * @author Andrew J. P. Garner
  */
@@ -14,11 +14,140 @@
 #include "dictionary/operator_sequence_generator.h"
 #include "symbolic/symbol_table.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <utility>
+
 namespace Moment::Inflation {
+
+    /**
+     * Worker threads, each responsible for a fixed chunk of prefixes, that persist between tasks.
+     * Exceptions thrown by a worker are captured, and rethrown by run() once every worker has finished the task.
+     */
+    class ExtensionSuggester::PrefixWorkers {
+    public:
+        using task_t = std::function<void(size_t first, size_t last, size_t chunk)>;
+
+    private:
+        const size_t prefix_count;
+        size_t chunk_size;
+
+        std::vector<std::thread> workers;
+        std::vector<std::exception_ptr> errors;
+
+        std::mutex mutex;
+        std::condition_variable task_ready;
+        std::condition_variable task_done;
+        task_t const * task = nullptr;
+        size_t generation = 0;
+        size_t pending = 0;
+        bool stopping = false;
+
+    public:
+        PrefixWorkers(const size_t prefix_count, size_t worker_count) : prefix_count{prefix_count} {
+            worker_count = std::max<size_t>(1, std::min(worker_count, prefix_count));
+            this->chunk_size = (prefix_count + worker_count - 1) / worker_count;
+            this->errors.resize(worker_count);
+            this->workers.reserve(worker_count);
+            try {
+                for (size_t worker_id = 0; worker_id < worker_count; ++worker_id) {
+                    this->workers.emplace_back(&PrefixWorkers::work, this, worker_id);
+                }
+            } catch (...) {
+                this->stop();
+                throw;
+            }
+        }
+
+        ~PrefixWorkers() noexcept {
+            this->stop();
+        }
+
+        [[nodiscard]] size_t chunk_count() const noexcept { return this->errors.size(); }
+
+        /**
+         * Call task(first, last, chunk) for each chunk of prefixes, and wait for every chunk to finish.
+         */
+        void run(const task_t& the_task) {
+            {
+                std::lock_guard lock{this->mutex};
+                this->task = &the_task;
+                this->pending = this->workers.size();
+                ++this->generation;
+            }
+            this->task_ready.notify_all();
+            {
+                std::unique_lock lock{this->mutex};
+                this->task_done.wait(lock, [this]() { return this->pending == 0; });
+                this->task = nullptr;
+            }
+
+            for (auto& error : this->errors) {
+                if (error) {
+                    std::rethrow_exception(std::exchange(error, nullptr));
+                }
+            }
+        }
+
+    private:
+        void work(const size_t worker_id) {
+            const size_t first = worker_id * this->chunk_size;
+            const size_t last = std::min(this->prefix_count, first + this->chunk_size);
+            size_t seen_generation = 0;
+            while (true) {
+                task_t const * current_task = nullptr;
+                {
+                    std::unique_lock lock{this->mutex};
+                    this->task_ready.wait(lock, [&]() {
+                        return this->stopping || (this->generation != seen_generation);
+                    });
+                    if (this->stopping) {
+                        return;
+                    }
+                    seen_generation = this->generation;
+                    current_task = this->task;
+                }
+
+                try {
+                    if (first < last) {
+                        (*current_task)(first, last, worker_id);
+                    }
+                } catch (...) {
+                    this->errors[worker_id] = std::current_exception();
+                }
+
+                {
+                    std::lock_guard lock{this->mutex};
+                    if (--this->pending == 0) {
+                        this->task_done.notify_one();
+                    }
+                }
+            }
+        }
+
+        void stop() noexcept {
+            {
+                std::lock_guard lock{this->mutex};
+                this->stopping = true;
+            }
+            this->task_ready.notify_all();
+            for (auto& worker : this->workers) {
+                worker.join();
+            }
+            this->workers.clear();
+        }
+    };
+
     ExtensionSuggester::ExtensionSuggester(const InflationContext& context,
                                            const SymbolTable& symbols,
-                                           const FactorTable& factors)
-        : context{context}, symbols{symbols}, factors{factors} { }
+                                           const FactorTable& factors,
+                                           const Multithreading::MultiThreadPolicy mt_policy)
+        : context{context}, symbols{symbols}, factors{factors}, mt_policy{mt_policy} { }
+
+    ExtensionSuggester::~ExtensionSuggester() noexcept = default;
 
     std::set<symbol_name_t> ExtensionSuggester::operator()(const SymbolicMatrix &matrix) const {
         if (const auto* mmPtr = dynamic_cast<const MonomialMatrix*>(&matrix); mmPtr != nullptr) {
@@ -31,26 +160,34 @@ namespace Moment::Inflation {
     std::set<symbol_name_t> ExtensionSuggester::operator()(const MonomialMatrix& matrix) const {
         assert(&matrix.symbols == &this->symbols);
 
-        MomentMatrix const * mm_ptr = MomentMatrix::to_operator_matrix_ptr(matrix);
-        if (nullptr == mm_ptr) {
+        // Prefixes and non-fundamental symbols are only calculated on first request for this matrix
+        const auto data_ptr = this->get_matrix_data(matrix);
+        const auto& data = *data_ptr;
+        if (!data.moment_matrix) {
             throw std::invalid_argument{"Can only suggest extensions for monomial moment matrices."};
         }
-        const auto& moment_matrix = *mm_ptr;
 
+        // Return if nothing needs factorizing
+        if (data.nonfundamental.empty()) {
+            return {};
+        }
 
         DynamicBitset<uint64_t> tested_factors{this->symbols.size()};
         DynamicBitset<uint64_t> chosen_factors{this->symbols.size()};
+        DynamicBitset<uint64_t> necessary_factors{this->symbols.size()};
+        for (const auto symbol_id : data.nonfundamental) {
+            necessary_factors.set(symbol_id);
+        }
 
-        auto necessary_factors = nonfundamental_symbols(matrix);
-
-        size_t extension_count = 0;
-
-
-        // Return if nothing needs factorizing
-        if (necessary_factors.empty()) {
-            return {};
+        // Workers are created once, and re-used for every trial factor
+        std::unique_ptr<PrefixWorkers> workers;
+        if (Multithreading::should_multithread_extension_suggestion(this->mt_policy, data.prefix_factors.size(),
+                                                                    this->max_extensions)) {
+            workers = std::make_unique<PrefixWorkers>(data.prefix_factors.size(),
+                                                      Multithreading::get_max_worker_threads());
         }
 
+        size_t extension_count = 0;
         while ((extension_count < max_extensions) && !(necessary_factors.empty())) {
             // 1. choose factor of some non-fundamental string
             const auto trial_factor_symbol = get_symbol_to_test(necessary_factors, tested_factors);
@@ -60,24 +197,11 @@ namespace Moment::Inflation {
 
             // 2. see what constraints introducing this extension could impose
             bool any_use = false;
-            for (const auto &rawPrefix: moment_matrix.generators()()) {
-                // Find prefix as factored object
-                auto prefix = context.canonical_moment(rawPrefix);
-
-                auto [source_sym_index, source_conj] = symbols.hash_to_index(prefix.hash());
-                assert(source_sym_index != std::numeric_limits<ptrdiff_t>::max());
-                const auto &source_factors = factors[source_sym_index].canonical.symbols;
-
-                // See if multiplying prefix by chosen factor yields a known symbol
-                auto joint_factors = FactorTable::combine_symbolic_factors(source_factors, {trial_factor_symbol});
-                auto maybe_symbol_index = factors.find_index_by_factors(joint_factors);
-                if (!maybe_symbol_index.has_value()) {
-                    continue;
-                }
-                // Do we need this one?
-                if (necessary_factors.test(maybe_symbol_index.value())) {
-                    // If it does, then we check the symbol off as generated, and register suggested symbol as useful
-                    necessary_factors.unset(maybe_symbol_index.value());
+            for (const auto product_symbol : this->products_with_prefixes(data, trial_factor_symbol,
+                                                                          necessary_factors, workers.get())) {
+                // If needed, we check the symbol off as generated, and register suggested symbol as useful
+                if (necessary_factors.test(product_symbol)) {
+                    necessary_factors.unset(product_symbol);
                     any_use = true;
                 }
             }
@@ -94,16 +218,125 @@ namespace Moment::Inflation {
     }
 
     DynamicBitset<uint64_t> ExtensionSuggester::nonfundamental_symbols(const MonomialMatrix &matrix) const {
+        const auto data_ptr = this->get_matrix_data(matrix);
         DynamicBitset<uint64_t> expressions(this->symbols.size());
-        for (auto symbol_id : matrix.IncludedSymbols()) { 
-            const auto& factor_info = factors[symbol_id];
-            if (!factor_info.fundamental()) {
-                expressions.set(symbol_id);
-            }
+        for (const auto symbol_id : data_ptr->nonfundamental) {
+            expressions.set(symbol_id);
         }
         return expressions;
     }
 
+    void ExtensionSuggester::forget(const MonomialMatrix& matrix) const {
+        std::lock_guard lock{this->cache_mutex};
+        this->matrix_cache.erase(&matrix);
+    }
+
+    size_t ExtensionSuggester::cached_matrix_count() const {
+        std::lock_guard lock{this->cache_mutex};
+        return this->matrix_cache.size();
+    }
+
+    std::shared_ptr<const ExtensionSuggester::MatrixData>
+    ExtensionSuggester::get_matrix_data(const MonomialMatrix& matrix) const {
+        {
+            std::lock_guard lock{this->cache_mutex};
+            auto iter = this->matrix_cache.find(&matrix);
+            if ((iter != this->matrix_cache.end()) && (iter->second->dimension == matrix.Dimension())) {
+                return iter->second;
+            }
+        }
+
+        // Calculate without holding lock; if racing thread also calculates, the results are identical.
+        auto data = this->calculate_matrix_data(matrix);
+
+        std::lock_guard lock{this->cache_mutex};
+        this->matrix_cache.insert_or_assign(&matrix, data);
+        return data;
+    }
+
+    std::shared_ptr<const ExtensionSuggester::MatrixData>
+    ExtensionSuggester::calculate_matrix_data(const MonomialMatrix& matrix) const {
+        auto data = std::make_shared<MatrixData>();
+        data->dimension = matrix.Dimension();
+
+        // Non-fundamental symbols (included symbols are already ordered and de-duplicated)
+        for (const auto symbol_id : matrix.IncludedSymbols()) {
+            if (!this->factors[symbol_id].fundamental()) {
+                data->nonfundamental.emplace_back(symbol_id);
+            }
+        }
+
+        // Prefixes are only defined for moment matrices
+        MomentMatrix const * mm_ptr = MomentMatrix::to_operator_matrix_ptr(matrix);
+        if (nullptr == mm_ptr) {
+            data->moment_matrix = false;
+            return data;
+        }
+        data->moment_matrix = true;
+        const auto& generators = mm_ptr->generators()();
+
+        // Find each prefix as factored object
+        const size_t prefix_count = generators.size();
+        data->prefix_factors.resize(prefix_count);
+        const PrefixWorkers::task_t factorize_prefixes = [&](const size_t first, const size_t last,
+                                                             size_t /* chunk */) {
+            for (size_t index = first; index < last; ++index) {
+                auto prefix = this->context.canonical_moment(generators[index]);
+                auto [source_sym_index, source_conj] = this->symbols.hash_to_index(prefix.hash());
+                assert(source_sym_index != std::numeric_limits<ptrdiff_t>::max());
+                data->prefix_factors[index] = this->factors[source_sym_index].canonical.symbols;
+            }
+        };
+
+        if (Multithreading::should_multithread_extension_suggestion(this->mt_policy, prefix_count,
+                                                                    this->max_extensions)) {
+            PrefixWorkers workers{prefix_count, Multithreading::get_max_worker_threads()};
+            workers.run(factorize_prefixes);
+        } else {
+            factorize_prefixes(0, prefix_count, 0);
+        }
+
+        return data;
+    }
+
+    std::vector<symbol_name_t>
+    ExtensionSuggester::products_with_prefixes(const MatrixData& data, const symbol_name_t trial_factor,
+                                               const DynamicBitset<uint64_t>& necessary_factors,
+                                               PrefixWorkers* const workers) const {
+        const std::vector<symbol_name_t> trial_factor_list{trial_factor};
+
+        auto find_products = [&](const size_t first, const size_t last, std::vector<symbol_name_t>& output) {
+            std::vector<symbol_name_t> joint_factors;
+            for (size_t index = first; index < last; ++index) {
+                // See if multiplying prefix by chosen factor yields a known symbol
+                joint_factors.clear();
+                FactorTable::combine_symbolic_factors(joint_factors, data.prefix_factors[index], trial_factor_list);
+                auto maybe_symbol_index = this->factors.find_index_by_factors(joint_factors);
+                if (maybe_symbol_index.has_value() && necessary_factors.test(maybe_symbol_index.value())) {
+                    output.emplace_back(maybe_symbol_index.value());
+                }
+            }
+        };
+
+        const size_t prefix_count = data.prefix_factors.size();
+        if (nullptr == workers) {
+            std::vector<symbol_name_t> output;
+            find_products(0, prefix_count, output);
+            return output;
+        }
+
+        std::vector<std::vector<symbol_name_t>> partial_outputs(workers->chunk_count());
+        workers->run([&](const size_t first, const size_t last, const size_t chunk) {
+            find_products(first, last, partial_outputs[chunk]);
+        });
+
+        std::vector<symbol_name_t> output;
+        for (const auto& partial : partial_outputs) {
+            output.insert(output.end(), partial.cbegin(), partial.cend());
+        }
+        return output;
+    }
+
     symbol_name_t ExtensionSuggester::get_symbol_to_test(const DynamicBitset<uint64_t> &necessary_factors,
                                                          const DynamicBitset<uint64_t> &tested_factors) const {
 
@@ -123,4 +356,4 @@ namespace Moment::Inflation {
         return -1;
     }
 
-}
\ No newline at end of file
+}
@@ -1,15 +1,20 @@
 /**
  * extension_suggester.h
- * 
+ *
  * @copyright Copyright (c) 2023 Austrian Academy of Sciences
  * @author Andrew J. P. Garner
  */
 #pragma once
 
 #include "integer_types.h"
+#include "multithreading/multithreading.h"
 #include "utilities/dynamic_bitset.h"
 
+#include <map>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <vector>
 
 namespace Moment {
     class SymbolTable;
@@ -25,15 +30,43 @@ namespace Moment::Inflation {
 
     class ExtensionSuggester {
     private:
+        class PrefixWorkers;
+
+        /**
+         * Information about a moment matrix that does not change as further symbols are registered.
+         */
+        struct MatrixData {
+            /** Matrix dimension (sanity check against re-use of address). */
+            size_t dimension;
+
+            /** True if matrix is a moment matrix (and hence prefixes are defined). */
+            bool moment_matrix;
+
+            /** Non-fundamental symbols in matrix, in ascending order. */
+            std::vector<symbol_name_t> nonfundamental;
+
+            /** Canonical factors of each generating word (prefix) of the moment matrix. */
+            std::vector<std::vector<symbol_name_t>> prefix_factors;
+        };
+
         const InflationContext& context;
         const SymbolTable& symbols;
         const FactorTable& factors;
 
         const size_t max_extensions = 100;
 
+        Multithreading::MultiThreadPolicy mt_policy;
+
+        mutable std::mutex cache_mutex;
+        mutable std::map<const MonomialMatrix*, std::shared_ptr<const MatrixData>> matrix_cache;
+
     public:
         explicit ExtensionSuggester(const InflationContext& context,
-                                    const SymbolTable& symbols, const FactorTable& factors);
+                                    const SymbolTable& symbols, const FactorTable& factors,
+                                    Multithreading::MultiThreadPolicy mt_policy
+                                        = Multithreading::MultiThreadPolicy::Optional);
+
+        ~ExtensionSuggester() noexcept;
 
         [[nodiscard]] std::set<symbol_name_t> operator()(const SymbolicMatrix& matrix) const;
 
@@ -44,9 +77,33 @@ namespace Moment::Inflation {
          */
         [[nodiscard]] DynamicBitset<uint64_t> nonfundamental_symbols(const MonomialMatrix &matrix) const;
 
+        /**
+         * Discard cached information about matrix (e.g. before it is deleted).
+         */
+        void forget(const MonomialMatrix& matrix) const;
+
+        /**
+         * Number of matrices with cached information.
+         */
+        [[nodiscard]] size_t cached_matrix_count() const;
+
     private:
+        /** Get cached information about matrix, or calculate it. */
+        [[nodiscard]] std::shared_ptr<const MatrixData> get_matrix_data(const MonomialMatrix& matrix) const;
+
+        [[nodiscard]] std::shared_ptr<const MatrixData> calculate_matrix_data(const MonomialMatrix& matrix) const;
+
+        /**
+         * Find symbols in necessary_factors that can be generated by multiplying a prefix by trial factor.
+         * Might contain duplicates.
+         * @param workers Worker threads to split prefixes between, or nullptr to run on the calling thread.
+         */
+        [[nodiscard]] std::vector<symbol_name_t>
+        products_with_prefixes(const MatrixData& data, symbol_name_t trial_factor,
+                               const DynamicBitset<uint64_t>& necessary_factors, PrefixWorkers* workers) const;
+
         symbol_name_t get_symbol_to_test(const DynamicBitset <uint64_t> &necessary_factors,
                                          const DynamicBitset <uint64_t> &tested_factors) const;
     };
 
-}
\ No newline at end of file
+}
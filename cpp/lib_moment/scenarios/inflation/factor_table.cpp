@@ -111,8 +111,8 @@ namespace Moment::Inflation {
 
             // Canonical symbols should be sorted in factor entry
             std::sort(entry.canonical.symbols.begin(), entry.canonical.symbols.end());
-            // Add to index tree
-            this->index_tree.add(entry.canonical.symbols, entry.id);
+            // Add to index
+            this->index.add(entry.canonical.symbols, entry.id);
         }
 
         // Newly added symbols automatically should not factorize, and will be canonical
@@ -125,7 +125,7 @@ namespace Moment::Inflation {
             entry.raw.sequences = std::vector<OperatorSequence>{symbol.sequence()};
             entry.canonical.sequences = std::vector<OperatorSequence>{symbol.sequence()};
             entry.canonical.symbols = std::vector<symbol_name_t>{entry.id};
-            this->index_tree.add(entry.canonical.symbols, entry.id);
+            this->index.add(entry.canonical.symbols, entry.id);
         }
 
         // Count factors
@@ -156,12 +156,12 @@ namespace Moment::Inflation {
         }
 
         // Create index
-        index_tree.add(new_entry.canonical.symbols, new_entry.id);
+        this->index.add(new_entry.canonical.symbols, new_entry.id);
     }
 
     void FactorTable::register_new(std::vector<std::unique_ptr<std::vector<symbol_name_t>>>&& definitions,
                                    std::vector<std::unique_ptr<std::vector<OperatorSequence>>>&& op_seqs,
-                                   IndexTree<symbol_name_t, symbol_name_t>&& indices) {
+                                   HashedIndex<symbol_name_t, symbol_name_t>&& indices) {
         assert(definitions.size() == op_seqs.size());
 
         symbol_name_t next_symbol_id = this->entries.size();
@@ -178,9 +178,7 @@ namespace Moment::Inflation {
             ++next_symbol_id;
         }
 
-        index_tree.merge_in(std::move(indices));
-
-
+        this->index.merge_in(std::move(indices));
     }
 
 
@@ -12,7 +12,7 @@
 
 #include "symbolic/polynomial.h"
 
-#include "utilities/index_tree.h"
+#include "utilities/hashed_index.h"
 
 #include <set>
 #include <stdexcept>
@@ -74,7 +74,7 @@ namespace Moment {
 
             std::vector<FactorEntry> entries;
 
-            IndexTree<symbol_name_t, symbol_name_t> index_tree;
+            HashedIndex<symbol_name_t, symbol_name_t> index;
 
         public:
             /** Create additional factor information, synchronized with symbol table. */
@@ -101,14 +101,13 @@ namespace Moment {
             /** Attempt to find entry by factors */
             [[nodiscard]] std::optional<symbol_name_t>
             find_index_by_factors(std::span<const symbol_name_t> factors) const {
-                return this->index_tree.find(factors);
+                return this->index.find(factors);
             }
 
             /** Attempt to find entry by factors (initializer list) */
             [[nodiscard]] std::optional<symbol_name_t>
             find_index_by_factors(std::initializer_list<symbol_name_t> factors) const {
-                std::vector<symbol_name_t> factor_vec(factors);
-                return this->index_tree.find(factor_vec);
+                return this->index.find(std::span<const symbol_name_t>(factors.begin(), factors.size()));
             }
 
             /**
@@ -121,7 +120,7 @@ namespace Moment {
              */
             void register_new(std::vector<std::unique_ptr<std::vector<symbol_name_t>>>&& definitions,
                               std::vector<std::unique_ptr<std::vector<OperatorSequence>>>&& op_seqs,
-                              IndexTree<symbol_name_t, symbol_name_t>&& indices);
+                              HashedIndex<symbol_name_t, symbol_name_t>&& indices);
 
             /**
              * Attempt to multiply symbolic expressions
@@ -174,9 +173,9 @@ namespace Moment {
                 return output;
             }
 
-            /** Raw access to index tree. */
-            [[nodiscard]] const IndexTree<symbol_name_t, symbol_name_t>& Indices() const noexcept {
-                return this->index_tree;
+            /** Raw access to factor index. */
+            [[nodiscard]] const HashedIndex<symbol_name_t, symbol_name_t>& Indices() const noexcept {
+                return this->index;
             }
 
         private:
@@ -16,22 +16,342 @@
 
 #include <algorithm>
 #include <bit>
+#include <numeric>
 #include <sstream>
 
 namespace Moment::Inflation {
 
     namespace {
-        using OpStringBitset = DynamicBitset<uint64_t, size_t, SmallVector<uint64_t, 1>>;
+        /** Operator, with the copy of each of its sources replaced by a slot, for relabelling. */
+        struct SlottedOperator {
+            const InflationContext::ICObservable* observable;
+            oper_name_t outcome;
+            /** Slot of each of the observable's sources; distinct copies of a source in the moment have distinct slots. */
+            SmallVector<oper_name_t, 4> slots;
+        };
 
+        /** Moment as slotted operators; a relabelling maps each slot of each source back to a copy of that source. */
+        struct SlottedMoment {
+            std::vector<SlottedOperator> operators;
+            /** Number of slots (i.e. distinct copies in use) of each source. */
+            SmallVector<oper_name_t, 4> slot_counts;
+            oper_name_t inflation;
+
+            /** Write sorted sequence obtained by mapping each slot of source src_id to copy image(src_id, slot). */
+            template<typename image_fn_t>
+            void relabel(sequence_storage_t& output, const image_fn_t& image) const {
+                output.clear();
+                for (const auto& op : this->operators) {
+                    if (op.observable->singleton) {
+                        output.push_back(op.observable->operator_offset + op.outcome);
+                        continue;
+                    }
+                    oper_name_t flat_index = 0;
+                    oper_name_t stride = 1;
+                    for (size_t s_index = 0, s_max = op.slots.size(); s_index < s_max; ++s_index) {
+                        flat_index += image(op.observable->sources[s_index], op.slots[s_index]) * stride;
+                        stride *= this->inflation;
+                    }
+                    assert(static_cast<size_t>(flat_index) < op.observable->variants.size());
+                    output.push_back(op.observable->variants[flat_index].operator_offset + op.outcome);
+                }
+                std::sort(output.begin(), output.end());
+            }
+        };
+
+        /** Lexicographically smallest relabelling of moment, found by trying every permutation of each source's slots. */
+        sequence_storage_t exhaustive_relabelling(const SlottedMoment& moment) {
+            std::vector<SmallVector<oper_name_t, 4>> images;
+            images.reserve(moment.slot_counts.size());
+            for (const auto count : moment.slot_counts) {
+                auto& image = images.emplace_back(static_cast<size_t>(count), 0);
+                std::iota(image.begin(), image.end(), 0);
+            }
+            const auto image_of = [&images](const size_t src_id, const oper_name_t slot) {
+                return images[src_id][slot];
+            };
+
+            sequence_storage_t best;
+            sequence_storage_t candidate;
+            bool first = true;
+            while (true) {
+                // Keep lexicographically smallest (equivalently, lowest shortlex hash, as all have same length)
+                moment.relabel(candidate, image_of);
+                if (first || std::lexicographical_compare(candidate.begin(), candidate.end(),
+                                                          best.begin(), best.end())) {
+                    std::swap(best, candidate);
+                    first = false;
+                }
 
-        /** 'Scratch' permutation paper, per thread. */
-        inline std::vector<oper_name_t>& get_permutation_scratch(size_t size) {
-            thread_local std::vector<oper_name_t> permutation_scratch;
-            if (permutation_scratch.size() != size) {
-                permutation_scratch.resize(size);
+                // Advance to next relabelling
+                size_t src_id = 0;
+                for (; src_id < images.size(); ++src_id) {
+                    if (std::next_permutation(images[src_id].begin(), images[src_id].end())) {
+                        break;
+                    }
+                }
+                if (src_id == images.size()) {
+                    return best;
+                }
             }
-            return permutation_scratch;
         }
+
+        /**
+         * Canonical relabelling of moment by individualisation-refinement, after the manner of nauty.
+         * The slots of each source are coloured by an ordered partition, refined until slots sharing a colour cannot be
+         * told apart by the operators they appear in. Ties are broken by individualising each slot of the first
+         * non-trivial cell in turn, and refining again, until every slot has its own colour (a leaf).
+         * Refinement never refers to the labels of the input, so equivalent moments have the same set of leaves; the
+         * lowest leaf is therefore canonical. Subtrees mapped onto already explored subtrees by automorphisms of the
+         * moment (found as pairs of leaves with identical sequences) are pruned.
+         */
+        class RefinedRelabelling {
+        private:
+            const SlottedMoment& moment;
+            size_t slot_total = 0;
+            /** Index of each source's first slot, in global slot indexing. */
+            std::vector<size_t> slot_offset;
+            /** Source of each global slot. */
+            std::vector<size_t> slot_source;
+            /** Occurrences of each global slot, as (operator index, index of source within operator). */
+            std::vector<std::vector<std::pair<size_t, size_t>>> occurrences;
+
+            /** Slots individualised on the way to the current node. */
+            std::vector<size_t> path;
+            /** Automorphisms found so far, as permutations of global slots. */
+            std::vector<std::vector<size_t>> automorphisms;
+
+            bool found_leaf = false;
+            std::vector<oper_name_t> first_leaf;
+            sequence_storage_t first_sequence;
+            sequence_storage_t best;
+            sequence_storage_t candidate;
+
+        public:
+            explicit RefinedRelabelling(const SlottedMoment& moment) : moment{moment} {
+                this->slot_offset.reserve(moment.slot_counts.size());
+                for (size_t src_id = 0; src_id < moment.slot_counts.size(); ++src_id) {
+                    this->slot_offset.push_back(this->slot_total);
+                    this->slot_total += static_cast<size_t>(moment.slot_counts[src_id]);
+                    this->slot_source.insert(this->slot_source.end(),
+                                             static_cast<size_t>(moment.slot_counts[src_id]), src_id);
+                }
+
+                this->occurrences.resize(this->slot_total);
+                for (size_t op_index = 0; op_index < moment.operators.size(); ++op_index) {
+                    const auto& op = moment.operators[op_index];
+                    for (size_t s_index = 0; s_index < op.slots.size(); ++s_index) {
+                        this->occurrences[this->global_slot(op, s_index)].emplace_back(op_index, s_index);
+                    }
+                }
+            }
+
+            /** Find canonical relabelling. */
+            [[nodiscard]] sequence_storage_t operator()() {
+                this->explore(std::vector<oper_name_t>(this->slot_total, 0), true);
+                return std::move(this->best);
+            }
+
+        private:
+            [[nodiscard]] size_t global_slot(const SlottedOperator& op, const size_t s_index) const noexcept {
+                return this->slot_offset[op.observable->sources[s_index]] + static_cast<size_t>(op.slots[s_index]);
+            }
+
+            /**
+             * Explore the search tree below the supplied colouring.
+             * Colours of each source's slots give the ordered partition: a slot's colour is the number of slots of the
+             * same source in lower cells.
+             * @return True if an automorphism was found, and the search should return to the first path.
+             */
+            bool explore(std::vector<oper_name_t> colours, const bool on_first_path) {
+                this->refine(colours);
+
+                const auto cell = this->target_cell(colours);
+                if (cell.empty()) {
+                    return this->leaf(colours);
+                }
+
+                const oper_name_t cell_colour = colours[cell.front()];
+                std::vector<size_t> tried;
+                for (const auto slot : cell) {
+                    // Skip slots in the same orbit as one already tried, under automorphisms that fix our path
+                    if (!tried.empty()) {
+                        const auto orbit = this->orbits();
+                        if (std::any_of(tried.cbegin(), tried.cend(),
+                                        [&](const size_t other) { return orbit[other] == orbit[slot]; })) {
+                            continue;
+                        }
+                    }
+                    tried.push_back(slot);
+
+                    auto child_colours = colours;
+                    for (const auto other : cell) {
+                        child_colours[other] = cell_colour + 1;
+                    }
+                    child_colours[slot] = cell_colour;
+
+                    this->path.push_back(slot);
+                    const bool automorphic = this->explore(std::move(child_colours),
+                                                           on_first_path && (tried.size() == 1));
+                    this->path.pop_back();
+
+                    if (automorphic && !on_first_path) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            /** Split cells until slots of the same colour have the same description. */
+            void refine(std::vector<oper_name_t>& colours) const {
+                std::vector<std::vector<std::vector<oper_name_t>>> descriptions(this->slot_total);
+                std::vector<size_t> order;
+                bool changed = true;
+                while (changed) {
+                    changed = false;
+
+                    // Describe each slot by the operators it is in, and the colours of every slot of those operators
+                    for (size_t slot = 0; slot < this->slot_total; ++slot) {
+                        auto& description = descriptions[slot];
+                        description.clear();
+                        for (const auto& [op_index, s_index] : this->occurrences[slot]) {
+                            const auto& op = this->moment.operators[op_index];
+                            auto& entry = description.emplace_back();
+                            entry.reserve(op.slots.size() + 3);
+                            entry.push_back(op.observable->operator_offset);
+                            entry.push_back(op.outcome);
+                            entry.push_back(static_cast<oper_name_t>(s_index));
+                            for (size_t other = 0; other < op.slots.size(); ++other) {
+                                entry.push_back(colours[this->global_slot(op, other)]);
+                            }
+                        }
+                        std::sort(description.begin(), description.end());
+                    }
+
+                    // Split cells of each source by description, ordering new cells by description
+                    for (size_t src_id = 0; src_id < this->slot_offset.size(); ++src_id) {
+                        const auto slot_count = static_cast<size_t>(this->moment.slot_counts[src_id]);
+                        order.resize(slot_count);
+                        std::iota(order.begin(), order.end(), this->slot_offset[src_id]);
+                        std::sort(order.begin(), order.end(), [&](const size_t lhs, const size_t rhs) {
+                            if (colours[lhs] != colours[rhs]) {
+                                return colours[lhs] < colours[rhs];
+                            }
+                            return descriptions[lhs] < descriptions[rhs];
+                        });
+
+                        std::vector<oper_name_t> new_colours(slot_count);
+                        for (size_t index = 0; index < slot_count; ++index) {
+                            const auto slot = order[index];
+                            const bool same_as_previous = (index > 0)
+                                    && (colours[order[index - 1]] == colours[slot])
+                                    && (descriptions[order[index - 1]] == descriptions[slot]);
+                            new_colours[index] = same_as_previous ? new_colours[index - 1]
+                                                                  : static_cast<oper_name_t>(index);
+                        }
+                        for (size_t index = 0; index < slot_count; ++index) {
+                            if (colours[order[index]] != new_colours[index]) {
+                                colours[order[index]] = new_colours[index];
+                                changed = true;
+                            }
+                        }
+                    }
+                }
+            }
+
+            /** Slots of the first cell with more than one slot, or empty if every slot has its own colour. */
+            [[nodiscard]] std::vector<size_t> target_cell(const std::vector<oper_name_t>& colours) const {
+                std::vector<size_t> cell;
+                for (size_t src_id = 0; src_id < this->slot_offset.size(); ++src_id) {
+                    const auto first = this->slot_offset[src_id];
+                    const auto last = first + static_cast<size_t>(this->moment.slot_counts[src_id]);
+                    std::vector<size_t> cell_sizes(last - first, 0);
+                    for (size_t slot = first; slot < last; ++slot) {
+                        ++cell_sizes[colours[slot]];
+                    }
+                    const auto target = std::find_if(cell_sizes.cbegin(), cell_sizes.cend(),
+                                                     [](const size_t size) { return size > 1; });
+                    if (target == cell_sizes.cend()) {
+                        continue;
+                    }
+                    const auto target_colour = static_cast<oper_name_t>(target - cell_sizes.cbegin());
+                    for (size_t slot = first; slot < last; ++slot) {
+                        if (colours[slot] == target_colour) {
+                            cell.push_back(slot);
+                        }
+                    }
+                    return cell;
+                }
+                return cell;
+            }
+
+            /** Relabel by discrete colouring; keep if lowest. @return True if leaf reveals an automorphism. */
+            bool leaf(const std::vector<oper_name_t>& colours) {
+                this->moment.relabel(this->candidate, [&](const size_t src_id, const oper_name_t slot) {
+                    return colours[this->slot_offset[src_id] + static_cast<size_t>(slot)];
+                });
+
+                if (!this->found_leaf) {
+                    this->found_leaf = true;
+                    this->first_leaf = colours;
+                    this->first_sequence = this->candidate;
+                    this->best = this->candidate;
+                    return false;
+                }
+
+                if (this->candidate == this->first_sequence) {
+                    // Slot labelled c in the first leaf maps to the slot labelled c in this leaf
+                    std::vector<size_t> labelled(this->slot_total);
+                    for (size_t slot = 0; slot < this->slot_total; ++slot) {
+                        labelled[this->slot_offset[this->slot_source[slot]] + static_cast<size_t>(colours[slot])] = slot;
+                    }
+                    auto& automorphism = this->automorphisms.emplace_back(this->slot_total);
+                    for (size_t slot = 0; slot < this->slot_total; ++slot) {
+                        automorphism[slot] = labelled[this->slot_offset[this->slot_source[slot]]
+                                                      + static_cast<size_t>(this->first_leaf[slot])];
+                    }
+                    return true;
+                }
+
+                if (std::lexicographical_compare(this->candidate.begin(), this->candidate.end(),
+                                                 this->best.begin(), this->best.end())) {
+                    this->best = this->candidate;
+                }
+                return false;
+            }
+
+            /** Representative of each slot's orbit, under automorphisms found so far that fix the current path. */
+            [[nodiscard]] std::vector<size_t> orbits() const {
+                std::vector<size_t> parent(this->slot_total);
+                std::iota(parent.begin(), parent.end(), 0);
+                const auto find = [&parent](size_t slot) {
+                    while (parent[slot] != slot) {
+                        parent[slot] = parent[parent[slot]];
+                        slot = parent[slot];
+                    }
+                    return slot;
+                };
+
+                for (const auto& automorphism : this->automorphisms) {
+                    if (!std::all_of(this->path.cbegin(), this->path.cend(),
+                                     [&](const size_t slot) { return automorphism[slot] == slot; })) {
+                        continue;
+                    }
+                    for (size_t slot = 0; slot < this->slot_total; ++slot) {
+                        const auto lhs = find(slot);
+                        const auto rhs = find(automorphism[slot]);
+                        if (lhs != rhs) {
+                            parent[std::max(lhs, rhs)] = std::min(lhs, rhs);
+                        }
+                    }
+                }
+
+                for (size_t slot = 0; slot < this->slot_total; ++slot) {
+                    parent[slot] = find(slot);
+                }
+                return parent;
+            }
+        };
     }
 
     std::vector<InflationContext::ICObservable::Variant>
@@ -108,7 +428,9 @@ namespace Moment::Inflation {
     InflationContext::InflationContext(CausalNetwork network, size_t inflation_level)
         : Context{network.total_operator_count(inflation_level)},
           base_network{std::move(network)},
-          inflation{inflation_level} {
+          inflation{inflation_level},
+          moment_cache{std::make_unique<CanonicalMomentCache>()},
+          factor_cache{std::make_unique<ShardedHashMap<std::vector<OperatorSequence>>>()} {
 
         // Query for source count
         this->total_inflated_sources = this->base_network.total_source_count(inflation);
@@ -139,6 +461,16 @@ namespace Moment::Inflation {
         assert(this->operator_info.size() == this->size());
         assert(this->inflated_observables.size() == this->base_network.Observables().size());
 
+        // Create operator to global source lookup
+        this->operator_sources.reserve(this->size());
+        for (const auto& opInfo : this->operator_info) {
+            const auto& variant = this->inflated_observables[opInfo.observable].variants[opInfo.variant];
+            auto& source_list = this->operator_sources.emplace_back();
+            for (const auto global_source : variant.connected_sources) {
+                source_list.push_back(static_cast<oper_name_t>(global_source));
+            }
+        }
+
         // Create independence maps
         this->dependent_operators.reserve(this->size());
         for (const auto& opInfo : this->operator_info) {
@@ -165,76 +497,72 @@ namespace Moment::Inflation {
     }
 
     std::vector<OperatorSequence> InflationContext::factorize(const OperatorSequence& seq) const {
-        std::vector<OperatorSequence> output;
-
         // If string of length 0 or 1, no further factorization is possible, just echo input sequence
         if (seq.size() <= 1) {
-            output.push_back(seq);
-            return output;
-        }
-
-        // Otherwise, try to factorize properly
-        OpStringBitset checklist{seq.size(), true};
-
-        const auto total_source_count = this->total_inflated_sources; // this->Sources().size() * this->inflation;
-
-        while (!checklist.empty()) {
-            // Next string of unfactorized operators...
-            sequence_storage_t opers{};
-            SourceListBitset included_sources{total_source_count};
-
-            // Get next operator from input string that's not been put into any of the factors
-            const size_t this_pos = checklist.first_index();
-            checklist.unset(this_pos);
-            assert(this_pos < seq.size());
-            const oper_name_t this_oper_id = seq[this_pos];
-            assert((this_oper_id >= 0) && (this_oper_id < this->operator_info.size()));
-            const auto& this_oper_info = this->operator_info[this_oper_id];
-
-            // Add operator to factor list
-            opers.emplace_back(this_oper_id);
-
-            // Flag sources that are included
-            const auto& this_observable_variant =
-                this->inflated_observables[this_oper_info.observable].variants[this_oper_info.variant];
-            included_sources |= this_observable_variant.connected_sources;
-
-            // Loop over remaining symbols in string, trying greedily to include them if any link is found
-            bool done = false;
-            while (!done) {
-                done = true;
-                for (size_t other_pos : checklist) {
-                    assert(other_pos < seq.size());
-                    const oper_name_t other_oper_id = seq[other_pos];
-                    assert((other_oper_id >= 0) && (other_oper_id < this->operator_info.size()));
-                    const auto& other_oper_info = this->operator_info[other_oper_id];
-                    const auto& other_obs = this->inflated_observables[other_oper_info.observable];
-                    const auto& other_obs_variant = other_obs.variants[other_oper_info.variant];
-
-                    // Test for overlap
-                    const bool overlap = !(included_sources & other_obs_variant.connected_sources).empty();
-                    if (overlap) {
-                        // Add to string
-                        opers.emplace_back(other_oper_id);
-
-                        // Included sources are now relevant
-                        included_sources |= other_obs_variant.connected_sources;
-
-                        // Operator is joined in list, so flag as handled.
-                        checklist.unset(other_pos);
-
-                        // Exit the for loop, but continue the while loop...
-                        done = false;
-                        break;
+            return {seq};
+        }
+
+        // Have we factorized this sequence before?
+        if (auto cached = this->factor_cache->find(seq.hash()); cached.has_value()) {
+            return std::move(cached.value());
+        }
+
+        auto output = this->calculate_factors(seq);
+        this->factor_cache->insert(seq.hash(), output);
+        return output;
+    }
+
+    std::vector<OperatorSequence> InflationContext::calculate_factors(const OperatorSequence& seq) const {
+        const size_t length = seq.size();
+
+        // Union-find over positions in the sequence; joined if operators share a source.
+        SmallVector<size_t, op_seq_stack_length> parent(length, 0);
+        std::iota(parent.begin(), parent.end(), 0);
+        auto find_root = [&parent](size_t index) {
+            while (parent[index] != index) {
+                parent[index] = parent[parent[index]]; // path halving
+                index = parent[index];
+            }
+            return index;
+        };
+
+        // First position in the sequence at which each source appears
+        std::vector<ptrdiff_t> first_appearance(this->total_inflated_sources, -1);
+        for (size_t pos = 0; pos < length; ++pos) {
+            const oper_name_t oper_id = seq[pos];
+            assert((oper_id >= 0) && (static_cast<size_t>(oper_id) < this->operator_sources.size()));
+            for (const auto global_source : this->operator_sources[oper_id]) {
+                auto& first = first_appearance[global_source];
+                if (first < 0) {
+                    first = static_cast<ptrdiff_t>(pos);
+                } else {
+                    const auto root_lhs = find_root(static_cast<size_t>(first));
+                    const auto root_rhs = find_root(pos);
+                    if (root_lhs != root_rhs) {
+                        // Attach later root onto earlier root, so that roots are first position of each factor
+                        parent[std::max(root_lhs, root_rhs)] = std::min(root_lhs, root_rhs);
                     }
                 }
-                // For loop terminated without overlap, hence done == true and while loop terminates.
             }
+        }
 
-            // Create operator sequence with what we have found
-            output.emplace_back(std::move(opers), *this);
+        // Gather factors, in order of first operator in each factor
+        SmallVector<size_t, op_seq_stack_length> factor_index(length, 0);
+        std::vector<sequence_storage_t> factor_operators;
+        for (size_t pos = 0; pos < length; ++pos) {
+            const auto root = find_root(pos);
+            if (root == pos) {
+                factor_index[pos] = factor_operators.size();
+                factor_operators.emplace_back();
+            }
+            factor_operators[factor_index[root]].push_back(seq[pos]);
         }
 
+        std::vector<OperatorSequence> output;
+        output.reserve(factor_operators.size());
+        for (auto& opers : factor_operators) {
+            output.emplace_back(std::move(opers), *this);
+        }
         return output;
     }
 
@@ -265,6 +593,18 @@ namespace Moment::Inflation {
     }
 
 
+    bool InflationContext::is_canonical_concatenation(const OperatorSequence& lhs,
+                                                      const OperatorSequence& rhs) const noexcept {
+        assert(!lhs.empty() && !rhs.empty());
+        const oper_name_t lhs_back = lhs.raw().back();
+        const oper_name_t rhs_front = rhs.raw().front();
+        if (lhs_back >= rhs_front) {
+            return false;
+        }
+        const ICOperatorInfo::IsOrthogonal isOrth;
+        return !isOrth(this->operator_info[lhs_back], this->operator_info[rhs_front]);
+    }
+
     std::optional<OperatorSequence> InflationContext::get_if_canonical(const sequence_storage_t &sequence) const {
         // Sequences commute, so canonical variations are sorted.
         if (!std::is_sorted(sequence.cbegin(), sequence.cend())) {
@@ -315,132 +655,65 @@ namespace Moment::Inflation {
             return false;
         }
 
-        SmallVector<oper_name_t, 4> next_free_source_variant(this->base_network.explicit_source_count(), 0);
-
-        DynamicBitset<uint64_t, size_t, SmallVector<uint64_t, 1>> done_permutation{this->total_inflated_sources};
-
-        // Go through operators looking for permutations
-        for (const auto op : input) {
-            const auto &opData = this->operator_info[op];
-            const auto &observableInfo = this->inflated_observables[opData.observable];
-            // Singleton operators are always canonical
-            if (observableInfo.singleton) {
-                continue;
-            }
-
-            // Is this the lowest variant possible at this point?
-            const auto &variantInfo = observableInfo.variants[opData.variant];
-            for (int s_index = observableInfo.sources.size()-1; s_index >= 0; --s_index) { // last-index-major
-
-                const auto src_id = observableInfo.sources[s_index];
-                assert(src_id < base_network.explicit_source_count());
-                const auto src_variant = variantInfo.indices[s_index];
-                const auto src_global = (this->inflation * src_id) + src_variant;
-
-                if (!done_permutation.test(src_global)) {
-                    const auto target_global = (this->inflation * src_id) + next_free_source_variant[src_id];
-                    if (src_global != target_global) {
-                        return true;
-                    }
-
-                    done_permutation.set(src_global);
-                    ++next_free_source_variant[src_id];
-                }
-            }
-        }
-
-        return false;
+        // Sequence can be simplified if it is not its own orbit representative
+        return this->simplify_as_moment(input).hash() != input.hash();
     }
 
-    std::pair<bool, const std::vector<oper_name_t>&>
-    InflationContext::find_permutation(const OperatorSequence& input) const {
+    OperatorSequence InflationContext::calculate_canonical_moment(const OperatorSequence& input) const {
+        const size_t explicit_sources = this->base_network.explicit_source_count();
 
-        SmallVector<oper_name_t, 4> next_free_source_variant(this->base_network.explicit_source_count(), 0);
-
-        std::vector<oper_name_t>& permutation = get_permutation_scratch(this->total_inflated_sources);
-        std::pair<bool, const std::vector<oper_name_t>&> output{false, permutation};
-
-        DynamicBitset<uint64_t, size_t, SmallVector<uint64_t, 1>> done_permutation{this->total_inflated_sources};
-        bool& non_trivial = output.first;
-
-        // Go through operators looking for permutations
+        // Identify which copies of each source are present in the sequence, assigning each a slot per source.
+        std::vector<oper_name_t> global_to_slot(this->total_inflated_sources, -1);
+        SlottedMoment moment{{}, SmallVector<oper_name_t, 4>(explicit_sources, 0),
+                             static_cast<oper_name_t>(this->inflation)};
+        moment.operators.reserve(input.size());
         for (const auto op : input) {
-            const auto &opData = this->operator_info[op];
-            const auto &observableInfo = this->inflated_observables[opData.observable];
-            // Singleton operators are always canonical
+            const auto& opData = this->operator_info[op];
+            const auto& observableInfo = this->inflated_observables[opData.observable];
+            auto& info = moment.operators.emplace_back(&observableInfo, opData.outcome, SmallVector<oper_name_t, 4>{});
+
+            // Singleton operators are invariant under relabelling
             if (observableInfo.singleton) {
                 continue;
             }
 
-            // Is this the lowest variant possible at this point?
-            const auto &variantInfo = observableInfo.variants[opData.variant];
-            for (int s_index = observableInfo.sources.size()-1; s_index >= 0; --s_index) { // last-index-major
+            const auto& variantInfo = observableInfo.variants[opData.variant];
+            for (size_t s_index = 0, s_max = observableInfo.sources.size(); s_index < s_max; ++s_index) {
                 const auto src_id = observableInfo.sources[s_index];
-                assert(src_id < base_network.explicit_source_count());
-                const auto src_variant = variantInfo.indices[s_index];
-                const auto src_global = (this->inflation * src_id) + src_variant;
-
-                if (!done_permutation.test(src_global)) {
-                    const auto target_global = (this->inflation * src_id) + next_free_source_variant[src_id];
-                    permutation[src_global] = target_global;
-                    ++next_free_source_variant[src_id];
-                    done_permutation.set(src_global);
-
-                    non_trivial |= (src_global != target_global);
+                assert(static_cast<size_t>(src_id) < explicit_sources);
+                const auto src_global = (this->inflation * src_id) + variantInfo.indices[s_index];
+                if (global_to_slot[src_global] < 0) {
+                    global_to_slot[src_global] = moment.slot_counts[src_id];
+                    ++moment.slot_counts[src_id];
                 }
+                info.slots.push_back(global_to_slot[src_global]);
             }
         }
-        return output;
-    }
 
-    OperatorSequence InflationContext::apply_permutation(const OperatorSequence& input,
-                                                         const std::vector<oper_name_t>& permutation) const {
-        // Permute operators
-        sequence_storage_t permuted_operators;
-        for (const oper_name_t op : input) {
-            assert((op >= 0) && (op < this->operator_count));
-            const auto& op_info = this->operator_info[op];
-            const auto& obs_info = this->inflated_observables[op_info.observable];
-            // Singleton operators are not permuted
-            if (obs_info.singleton) {
-                permuted_operators.emplace_back(op);
-                continue;
+        // Size of the search space is the product of the orbit sizes of each source's copies
+        bool exhaustive = true;
+        size_t search_size = 1;
+        for (const auto count : moment.slot_counts) {
+            for (oper_name_t k = 2; exhaustive && (k <= count); ++k) {
+                search_size *= static_cast<size_t>(k);
+                exhaustive = (search_size <= InflationContext::max_orbit_search_size);
             }
-
-            const auto& variant_info = obs_info.variants[op_info.variant];
-            const auto permuted_indices = this->base_network.permute_variant(this->inflation, obs_info.sources,
-                                                                             permutation, variant_info.indices);
-            const auto& permuted_variant = obs_info.variant(permuted_indices);
-
-            permuted_operators.push_back(permuted_variant.operator_offset + op_info.outcome);
-        }
-
-        // If source-relabelling causes change in operator order, there could be further simplifications:
-        if (!std::is_sorted(permuted_operators.cbegin(), permuted_operators.cend())) {
-            return this->simplify_as_moment(OperatorSequence{std::move(permuted_operators), *this}); // recurse..!
         }
 
-        return OperatorSequence{std::move(permuted_operators), *this};
+        // Small orbits are searched for their lexicographically-lowest element; larger ones by refinement.
+        // Search size is invariant under relabelling, so equivalent moments always take the same branch.
+        auto canonical = exhaustive ? exhaustive_relabelling(moment) : RefinedRelabelling{moment}();
+        return OperatorSequence{OperatorSequence::ConstructPresortedFlag{}, std::move(canonical), *this,
+                                input.get_sign()};
     }
 
-
     OperatorSequence InflationContext::simplify_as_moment(OperatorSequence&& input) const {
         assert(this->can_have_aliases());
         // If 0, or I, or no inflation, then just pass through
         if (input.empty()) {
             return std::move(input);
         }
-
-        // Can we simplify through permutation?
-        auto [non_trivial, permutations] = this->find_permutation(input);
-
-        // Early exit if no permutations made
-        if (!non_trivial) {
-            return std::move(input);
-        }
-
-        // Otherwise, apply this permutation.
-        return this->apply_permutation(input, permutations);
+        return this->simplify_as_moment(static_cast<const OperatorSequence&>(input));
     }
 
     OperatorSequence InflationContext::simplify_as_moment(const OperatorSequence& input) const {
@@ -450,16 +723,16 @@ namespace Moment::Inflation {
             return OperatorSequence{input};
         }
 
-        // Can we simplify through permutation?
-        auto [non_trivial, permutations] = this->find_permutation(input);
-
-        // Early exit if no permutations made
-        if (!non_trivial) {
-            return OperatorSequence{input};
+        // Have we seen this sequence before?
+        if (auto cached = this->moment_cache->find(input.hash()); cached.has_value()) {
+            return OperatorSequence{OperatorSequence::ConstructRawFlag{}, std::move(cached->operators), cached->hash,
+                                    *this, input.get_sign()};
         }
 
-        // Otherwise, apply this permutation.
-        return this->apply_permutation(input, permutations);
+        // Otherwise, calculate and store
+        auto output = this->calculate_canonical_moment(input);
+        this->moment_cache->insert(input.hash(), output);
+        return output;
     }
 
     std::vector<OVOIndex>
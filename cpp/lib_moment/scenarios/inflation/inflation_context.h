@@ -7,15 +7,19 @@
 #pragma once
 
 #include "../context.h"
+#include "../canonical_moment_cache.h"
 #include "dictionary/operator_sequence.h"
 
 #include "causal_network.h"
 #include "observable_variant_index.h"
 
 #include "utilities/dynamic_bitset.h"
+#include "utilities/sharded_hash_map.h"
 #include "utilities/small_vector.h"
 
 #include <map>
+#include <memory>
+#include <optional>
 #include <set>
 #include <stdexcept>
 #include <string>
@@ -30,6 +34,13 @@ namespace Moment::Inflation {
 
     class InflationContext : public Context {
     public:
+        /**
+         * Largest number of source-copy relabellings tested exhaustively when finding a moment's canonical form.
+         * Beyond this, the canonical form is instead found by individualisation-refinement search: it is still shared
+         * by all equivalent moments, but is not necessarily the lexicographically lowest relabelling.
+         */
+        constexpr static size_t max_orbit_search_size = 40320;
+
         /** Extra operator information for inflation scenario */
         struct ICOperatorInfo {
             oper_name_t global_id;
@@ -161,6 +172,15 @@ namespace Moment::Inflation {
         /** Bitset, size equal to number of operators in context. True if other operator is not independent */
         std::vector<DynamicBitset<uint64_t>> dependent_operators;
 
+        /** For each operator, list of global indices of sources it is connected to. */
+        std::vector<SmallVector<oper_name_t, 4>> operator_sources;
+
+        /** Memoized results of simplify_as_moment, shared between threads. */
+        std::unique_ptr<CanonicalMomentCache> moment_cache;
+
+        /** Memoized results of factorize, shared between threads. */
+        std::unique_ptr<ShardedHashMap<std::vector<OperatorSequence>>> factor_cache;
+
     public:
         /**
          * Create a causal network context, for inflating.
@@ -211,21 +231,43 @@ namespace Moment::Inflation {
         bool additional_simplification(sequence_storage_t &op_sequence, SequenceSignType& sign_type) const override;
 
         /**
-         * Replace string with symmetric equivalent
+         * Concatenation is canonical if it remains sorted, and the operators at the join are not orthogonal.
+         */
+        [[nodiscard]] bool is_canonical_concatenation(const OperatorSequence& lhs,
+                                                      const OperatorSequence& rhs) const noexcept override;
+
+        /**
+         * Replace string with symmetric equivalent.
+         * This is the lexicographically lowest string obtainable by relabelling the copies of each source; or, if there
+         * are more than max_orbit_search_size such relabellings, a canonical choice amongst them.
          */
         [[nodiscard]] OperatorSequence simplify_as_moment(OperatorSequence&& seq) const final;
 
         /**
-         * Replace string with symmetric equivalent
+         * Replace string with symmetric equivalent.
+         * This is the lexicographically lowest string obtainable by relabelling the copies of each source; or, if there
+         * are more than max_orbit_search_size such relabellings, a canonical choice amongst them.
          */
         [[nodiscard]] OperatorSequence simplify_as_moment(const OperatorSequence& seq) const final;
 
+        /**
+         * Cache of previously calculated canonical moments.
+         */
+        [[nodiscard]] const CanonicalMomentCache& canonical_moment_cache() const noexcept {
+            return *this->moment_cache;
+        }
+
 
     private:
-        std::pair<bool, const std::vector<oper_name_t>&> find_permutation(const OperatorSequence& seq) const;
+        /**
+         * Calculate the canonical moment without reference to the cache.
+         */
+        [[nodiscard]] OperatorSequence calculate_canonical_moment(const OperatorSequence& seq) const;
 
-        OperatorSequence apply_permutation(const OperatorSequence& input,
-                                           const std::vector<oper_name_t>& permutation) const;
+        /**
+         * Calculate factors of a sequence without reference to the cache.
+         */
+        [[nodiscard]] std::vector<OperatorSequence> calculate_factors(const OperatorSequence& seq) const;
     public:
         /**
          * Bitstring of sources associated with an operator sequence.
@@ -245,9 +287,17 @@ namespace Moment::Inflation {
 
         /**
          * Split operator sequence into smallest independent factors.
+         * Factors are ordered by the position of their first operator in the input sequence.
          */
         [[nodiscard]] std::vector<OperatorSequence> factorize(const OperatorSequence& seq) const;
 
+        /**
+         * Cache of previously calculated factorizations.
+         */
+        [[nodiscard]] const ShardedHashMap<std::vector<OperatorSequence>>& factorization_cache() const noexcept {
+            return *this->factor_cache;
+        }
+
         /**
          * Calculate equivalent variant of operator string with lowest possible source indices (e.g. 'A2' -> 'A0' etc.).
          * Unlike simplify_as_moment, this is also defined if aliasing is disabled.
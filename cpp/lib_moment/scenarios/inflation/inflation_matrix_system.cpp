@@ -106,6 +106,15 @@ namespace Moment::Inflation {
         this->expand_rulebook(write_rb, 0);
     }
 
+    void InflationMatrixSystem::on_matrix_deleted(const WriteLock& write_lock, ptrdiff_t /* matrix_offset */,
+                                                  const class SymbolicMatrix& matrix) noexcept {
+        assert(write_lock.owns_lock());
+        // Cached matrix data is keyed by address, which could be re-used by a later matrix
+        if (const auto* mono_ptr = dynamic_cast<const class MonomialMatrix*>(&matrix); mono_ptr != nullptr) {
+            this->extensionSuggester->forget(*mono_ptr);
+        }
+    }
+
     ptrdiff_t InflationMatrixSystem::expand_rulebook(MomentRulebook &rulebook, size_t from_symbol) {
         // Debug check rulebook is compatible
         assert(&rulebook.symbols == &(this->Symbols()));
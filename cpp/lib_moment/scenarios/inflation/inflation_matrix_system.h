@@ -104,6 +104,13 @@ namespace Moment::Inflation {
          */
         [[nodiscard]] std::set<symbol_name_t> suggest_extensions(const class MonomialMatrix& matrix) const;
 
+        /**
+         * Extension suggester, with its cache of matrix information.
+         */
+        [[nodiscard]] const ExtensionSuggester& extension_suggester() const noexcept {
+            return *this->extensionSuggester;
+        }
+
     protected:
         /**
          * Virtual method, called to generate an extended matrix.
@@ -127,6 +134,9 @@ namespace Moment::Inflation {
         void on_rulebook_added(const MaintainsMutex::WriteLock& write_lock, size_t index,
                                const MomentRulebook &rb, bool insertion) override;
 
+        void on_matrix_deleted(const MaintainsMutex::WriteLock& write_lock,
+                               ptrdiff_t matrix_offset, const class SymbolicMatrix& matrix) noexcept override;
+
 
     private:
         std::unique_ptr<class CollinsGisin> makeCollinsGisin() override;
@@ -56,7 +56,7 @@ namespace Moment::Multithreading {
                       output_data + output_col_offset);
 
             // Get symbol for column
-            const size_t source_op_hash = this->bundle.context.simplify_as_moment(
+            const hash_t source_op_hash = this->bundle.context.simplify_as_moment(
                     OperatorSequence{this->bundle.source_osg[col]}
             ).hash();
 
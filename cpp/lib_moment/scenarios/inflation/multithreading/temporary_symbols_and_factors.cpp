@@ -37,19 +37,11 @@ namespace Moment::Multithreading {
             return maybe_val.value();
         }
 
-        // If fails, we have to look in new factors with mutex
-        auto read_lock = this->get_read_lock();
-
-        // Can we directly find node?
-        auto [hint_tree, hint_factors] = this->index_tree.find_node_or_return_hint(joint_factors);
-        if (hint_factors.empty()) {
-            assert (hint_tree->value().has_value());
-            return hint_tree->value().value();
+        // If fails, look in new factors; reading the hashed index does not require the mutex.
+        if (auto maybe_val = this->index.find(joint_factors); maybe_val.has_value()) {
+            return maybe_val.value();
         }
 
-        // Did not find, so we have to upgrade our lock
-        read_lock.unlock();
-
         // Do memory assignments and look-up of op seqs first, without blocking.
         // If we are scooped, we throw these redundant results away - but its worth it to avoid holding lock too long.
         auto new_factor_str = std::make_unique<std::vector<symbol_name_t>>(joint_factors.begin(), joint_factors.end());
@@ -68,14 +60,14 @@ namespace Moment::Multithreading {
         // Now, upgrade lock to report results
         auto write_lock = this->get_write_lock();
 
-        // Check again on subtree with hint [make sure racing thread hasn't already created!]
-        if (auto maybe_symbol_index = hint_tree->find(hint_factors); maybe_symbol_index.has_value()) {
+        // Check again [make sure racing thread hasn't already created!]
+        if (auto maybe_symbol_index = this->index.find(joint_factors); maybe_symbol_index.has_value()) {
             return maybe_symbol_index.value();
         }
 
-        // We have to create a new symbol, and list it as known in our tree.
+        // We have to create a new symbol, and list it as known in our index.
         const auto registered_id = this->next_symbol_id;
-        this->index_tree.add(joint_factors, registered_id);
+        this->index.add(joint_factors, registered_id);
         this->new_factors.push_back(std::move(new_factor_str));
         this->new_op_seqs.push_back(std::move(new_op_seq_str));
 
@@ -99,7 +91,7 @@ namespace Moment::Multithreading {
         // Register new factors
         this->factors.register_new(std::move(this->new_factors),
                                    std::move(this->new_op_seqs),
-                                   std::move(this->index_tree));
+                                   std::move(this->index));
 
     }
 
@@ -9,7 +9,7 @@
 
 #include "integer_types.h"
 
-#include "utilities/index_tree.h"
+#include "utilities/hashed_index.h"
 #include "multithreading/maintains_mutex.h"
 
 #include <vector>
@@ -34,7 +34,7 @@ namespace Moment {
 
             std::vector<std::unique_ptr<std::vector<symbol_name_t>>> new_factors;
             std::vector<std::unique_ptr<std::vector<OperatorSequence>>> new_op_seqs;
-            IndexTree<symbol_name_t, symbol_name_t> index_tree;
+            HashedIndex<symbol_name_t, symbol_name_t> index;
 
         public:
             TemporarySymbolsAndFactors(SymbolTable& symbols, Inflation::FactorTable& factors);
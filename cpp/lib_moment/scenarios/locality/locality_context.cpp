@@ -14,6 +14,7 @@
 #include "party.h"
 
 #include <algorithm>
+#include <array>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
@@ -62,6 +63,8 @@ namespace Moment::Locality {
                     //this->operators.emplace_back(total_operator_count);
                     this->global_to_local_indices.emplace_back(party_index, mmt_index, 
                                                                static_cast<uint32_t>(oper_index));
+                    this->global_op_id_to_global_mmt.emplace_back(
+                            static_cast<mmt_name_t>(party.global_measurement_offset + mmt_index));
                     ++party_op_count;
                     ++total_operator_count;
                 }
@@ -77,6 +80,7 @@ namespace Moment::Locality {
         }
 
         assert(this->global_op_id_to_party.size() == this->operator_count);
+        assert(this->global_op_id_to_global_mmt.size() == static_cast<size_t>(this->operator_count));
     }
 
     bool LocalityContext::additional_simplification(sequence_storage_t &op_sequence,
@@ -93,6 +97,71 @@ namespace Moment::Locality {
             }
         }
 
+        // Use kernel, if possible
+        if ((op_sequence.size() <= op_seq_stack_length) && (this->parties.size() <= max_kernel_parties)) {
+            return this->simplify_short_sequence(op_sequence);
+        }
+        return this->simplify_long_sequence(op_sequence);
+    }
+
+    bool LocalityContext::is_canonical_concatenation(const OperatorSequence& lhs,
+                                                     const OperatorSequence& rhs) const noexcept {
+        assert(!lhs.empty() && !rhs.empty());
+        const oper_name_t lhs_back = lhs.raw().back();
+        const oper_name_t rhs_front = rhs.raw().front();
+        const auto lhs_party = this->global_op_id_to_party[lhs_back];
+        const auto rhs_party = this->global_op_id_to_party[rhs_front];
+        if (lhs_party != rhs_party) {
+            return lhs_party < rhs_party;
+        }
+        return this->global_op_id_to_global_mmt[lhs_back] != this->global_op_id_to_global_mmt[rhs_front];
+    }
+
+    bool LocalityContext::simplify_short_sequence(sequence_storage_t& op_sequence) const noexcept {
+        const size_t length = op_sequence.size();
+        assert(length <= op_seq_stack_length);
+        assert(this->parties.size() <= max_kernel_parties);
+
+        // Counting sort by party (stable, so ordering within each party is preserved)
+        std::array<uint8_t, max_kernel_parties + 1> party_offsets{};
+        std::array<party_name_t, op_seq_stack_length> op_party; // NOLINT(*-pro-type-member-init)
+        for (size_t index = 0; index < length; ++index) {
+            op_party[index] = this->global_op_id_to_party[op_sequence[index]];
+            ++party_offsets[op_party[index] + 1];
+        }
+        for (size_t party = 1; party <= this->parties.size(); ++party) {
+            party_offsets[party] += party_offsets[party - 1];
+        }
+        std::array<oper_name_t, op_seq_stack_length> sorted; // NOLINT(*-pro-type-member-init)
+        for (size_t index = 0; index < length; ++index) {
+            sorted[party_offsets[op_party[index]]++] = op_sequence[index];
+        }
+
+        // Remove excess idempotent elements [all ops are projectors in this context!], and flag any neighbouring
+        // distinct operators from the same measurement (which are mutually exclusive).
+        const auto* const op_mmt = this->global_op_id_to_global_mmt.data();
+        size_t write_index = 1;
+        bool exclusive = false;
+        for (size_t read_index = 1; read_index < length; ++read_index) {
+            const oper_name_t current = sorted[read_index];
+            const oper_name_t previous = sorted[write_index - 1];
+            const bool repeated = (current == previous);
+            exclusive |= (!repeated) & (op_mmt[current] == op_mmt[previous]);
+            sorted[write_index] = current;
+            write_index += static_cast<size_t>(!repeated);
+        }
+
+        if (exclusive) {
+            op_sequence.clear();
+            return true;
+        }
+
+        std::copy(sorted.cbegin(), sorted.cbegin() + write_index, op_sequence.begin());
+        op_sequence.erase(op_sequence.begin() + write_index, op_sequence.end());
+        return false;
+    }
+
+    bool LocalityContext::simplify_long_sequence(sequence_storage_t& op_sequence) const {
         // Group first by party (preserving ordering within each party)
         std::stable_sort(op_sequence.begin(), op_sequence.end(),
                          [&](const auto& lhs, const auto& rhs) {
@@ -53,6 +53,12 @@ namespace Moment::Locality {
         std::vector<size_t> mmts_per_party;
         std::vector<size_t> ops_per_party;
 
+        /** Global measurement index for each operator: operators are exclusive if distinct, with same index. */
+        std::vector<mmt_name_t> global_op_id_to_global_mmt;
+
+        /** Largest number of parties for which the short-sequence simplification kernel is used. */
+        constexpr static const size_t max_kernel_parties = 16;
+
 
     public:
         LocalityContext();
@@ -66,6 +72,29 @@ namespace Moment::Locality {
          */
         bool additional_simplification(sequence_storage_t &op_sequence, SequenceSignType& sign_type) const override;
 
+        /**
+         * Concatenation is canonical if the parties remain in order, and the operators at the join (if from the same
+         * party) are from different measurements.
+         */
+        [[nodiscard]] bool is_canonical_concatenation(const OperatorSequence& lhs,
+                                                      const OperatorSequence& rhs) const noexcept override;
+
+    private:
+        /**
+         * Simplification kernel for sequences up to op_seq_stack_length: counting sort by party into stack storage,
+         * then one branch-free pass removing idempotent repeats and flagging mutually exclusive neighbours.
+         * Operators must already be validated.
+         */
+        bool simplify_short_sequence(sequence_storage_t& op_sequence) const noexcept;
+
+        /**
+         * Generic simplification, for long sequences (or contexts with many parties).
+         * Operators must already be validated.
+         */
+        bool simplify_long_sequence(sequence_storage_t& op_sequence) const;
+
+    public:
+
         /** Converts global measurement index to Party, Measurement pair */
         [[nodiscard]] PMIndex global_index_to_PM(size_t global_index) const noexcept;
 
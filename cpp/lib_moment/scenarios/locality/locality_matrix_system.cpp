@@ -9,9 +9,12 @@
 #include "locality_collins_gisin.h"
 #include "locality_context.h"
 #include "locality_full_correlator.h"
+#include "locality_moment_matrix_factory.h"
 #include "locality_probability_tensor.h"
 
+#include "matrix/monomial_matrix.h"
 #include "symbolic/monomial_comparator_by_hash.h"
+#include "symbolic/symbol_table.h"
 
 #include <algorithm>
 
@@ -54,6 +57,21 @@ namespace Moment::Locality {
     }
 
 
+    std::unique_ptr<class SymbolicMatrix>
+    LocalityMatrixSystem::create_moment_matrix(const WriteLock& lock, const size_t level,
+                                               const Multithreading::MultiThreadPolicy mt_policy) {
+        assert(this->is_locked_write_lock(lock));
+        return this->register_prepared_matrix(lock,
+            LocalityMomentMatrixFactory::prepare_matrix(this->localityContext, level, mt_policy), mt_policy);
+    }
+
+    PreparedMonomialMatrix
+    LocalityMatrixSystem::prepare_moment_matrix(const ReadLock& lock, const size_t level,
+                                                const Multithreading::MultiThreadPolicy mt_policy) {
+        assert(this->is_locked_read_lock(lock));
+        return LocalityMomentMatrixFactory::prepare_matrix(this->localityContext, level, mt_policy);
+    }
+
     std::unique_ptr<class CollinsGisin> LocalityMatrixSystem::makeCollinsGisin() {
         return std::make_unique<class LocalityCollinsGisin>(*this);
     }
@@ -57,6 +57,19 @@ namespace Moment::Locality {
 
         bool CanHaveFullCorrelator() const noexcept override;
 
+    protected:
+        /**
+         * Creates moment matrix directly from per-party product tables.
+         */
+        [[nodiscard]] std::unique_ptr<class SymbolicMatrix>
+        create_moment_matrix(const WriteLock& lock, size_t level, Multithreading::MultiThreadPolicy mt_policy) override;
+
+        /**
+         * Assembles operator matrix of moment matrix from per-party product tables, ahead of symbol registration.
+         */
+        [[nodiscard]] PreparedMonomialMatrix
+        prepare_moment_matrix(const ReadLock& lock, size_t level, Multithreading::MultiThreadPolicy mt_policy) override;
+
     private:
         std::unique_ptr<class CollinsGisin> makeCollinsGisin() override;
 
@@ -0,0 +1,178 @@
+/**
+ * locality_moment_matrix_factory.cpp
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+#include "locality_moment_matrix_factory.h"
+
+#include "locality_context.h"
+#include "locality_osg.h"
+
+#include "dictionary/dictionary.h"
+#include "dictionary/operator_sequence.h"
+#include "matrix/monomial_matrix.h"
+#include "matrix/operator_matrix/moment_matrix.h"
+#include "multithreading/fan_out.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace Moment::Locality {
+
+    namespace {
+        const LocalityOperatorSequenceGenerator& get_locality_osg(const LocalityContext& context,
+                                                                  const MomentMatrixIndex index) {
+            const auto* osg_ptr = dynamic_cast<const LocalityOperatorSequenceGenerator*>(
+                    &(context.dictionary().Level(index.Level)()));
+            if (osg_ptr == nullptr) {
+                throw std::logic_error{"Locality context should generate locality operator sequence generators."};
+            }
+            return *osg_ptr;
+        }
+    }
+
+    LocalityMomentMatrixFactory::LocalityMomentMatrixFactory(const LocalityContext& context,
+                                                             const MomentMatrixIndex index)
+        : context{context}, index{index}, osg{get_locality_osg(context, index)} {
+
+        this->dimension = this->osg.size();
+        const size_t party_count = this->osg.PartyCount();
+        const auto& hasher = context.the_hasher();
+
+        // Index each party's local words by hash
+        std::vector<std::unordered_map<hash_t, uint32_t>> local_word_index(party_count);
+        this->party_word_count.reserve(party_count);
+        for (size_t party = 0; party < party_count; ++party) {
+            const auto words = this->osg.Party(party).all();
+            this->party_word_count.emplace_back(words.size());
+            local_word_index[party].reserve(words.size());
+            for (uint32_t word_index = 0; word_index < words.size(); ++word_index) {
+                local_word_index[party].emplace(words[word_index].hash(), word_index);
+            }
+        }
+
+        // Decompose every word in the dictionary into its per-party components
+        this->local_indices.reserve(this->dimension * party_count);
+        for (const auto& word : this->osg) {
+            auto op_iter = word.begin();
+            for (size_t party = 0; party < party_count; ++party) {
+                const auto& party_info = *this->osg.Party(party).party;
+                const oper_name_t party_end = party_info.global_offset() + static_cast<oper_name_t>(party_info.size());
+                auto segment_end = std::find_if(op_iter, word.end(), [party_end](const oper_name_t op) {
+                    return op >= party_end;
+                });
+                const auto local_hash = hasher({op_iter, segment_end});
+                auto found = local_word_index[party].find(local_hash);
+                assert(found != local_word_index[party].end());
+                this->local_indices.emplace_back(found->second);
+                op_iter = segment_end;
+            }
+            assert(op_iter == word.end());
+        }
+
+        // Calculate each party's table of products
+        this->product_tables.resize(party_count);
+        for (size_t party = 0; party < party_count; ++party) {
+            const auto words = this->osg.Party(party).all();
+            auto& table = this->product_tables[party];
+            table.reserve(words.size() * words.size());
+            for (const auto& row_word : words) {
+                const auto conj_row_word = row_word.conjugate();
+                for (const auto& col_word : words) {
+                    const auto product = conj_row_word * col_word;
+                    auto& entry = table.emplace_back();
+                    if (product.zero()) {
+                        entry.zero = true;
+                        continue;
+                    }
+                    assert(product.get_sign() == SequenceSignType::Positive);
+                    entry.operators = product.raw();
+                    entry.partial_hash = product.hash() - hasher.offset;
+                    entry.stride = hasher.radix_power(product.size());
+                }
+            }
+        }
+    }
+
+    LocalityMomentMatrixFactory::~LocalityMomentMatrixFactory() noexcept = default;
+
+    void LocalityMomentMatrixFactory::assemble_columns(std::vector<OperatorSequence>& output,
+                                                       const size_t first_col, const size_t last_col) const {
+        const size_t party_count = this->product_tables.size();
+        const hash_t hash_offset = this->context.the_hasher().offset;
+
+        output.reserve(output.size() + ((last_col - first_col) * this->dimension));
+        sequence_storage_t next_seq;
+        for (size_t col = first_col; col < last_col; ++col) {
+            const uint32_t * const col_indices = this->local_indices.data() + (col * party_count);
+            for (size_t row = 0; row < this->dimension; ++row) {
+                const uint32_t * const row_indices = this->local_indices.data() + (row * party_count);
+
+                // Concatenate per-party products, composing hash
+                next_seq.clear();
+                hash_t partial_hash = 0;
+                bool zero = false;
+                for (size_t party = 0; party < party_count; ++party) {
+                    const auto& local = this->local_product(party, row_indices[party], col_indices[party]);
+                    if (local.zero) {
+                        zero = true;
+                        break;
+                    }
+                    next_seq.insert(next_seq.end(), local.operators.begin(), local.operators.end());
+                    partial_hash = (partial_hash * local.stride) + local.partial_hash;
+                }
+
+                if (zero) {
+                    output.emplace_back(OperatorSequence::Zero(this->context));
+                } else {
+                    output.emplace_back(OperatorSequence::ConstructRawFlag{}, next_seq, partial_hash + hash_offset,
+                                        this->context, SequenceSignType::Positive); // <- copies next_seq.
+                }
+            }
+        }
+    }
+
+    std::unique_ptr<MomentMatrix>
+    LocalityMomentMatrixFactory::make_operator_matrix(const Multithreading::MultiThreadPolicy mt_policy) const {
+        const size_t numel = this->dimension * this->dimension;
+        std::vector<OperatorSequence> matrix_data;
+
+        const size_t worker_count = std::min(Multithreading::get_max_worker_threads(), this->dimension);
+        if (Multithreading::should_multithread_matrix_creation(mt_policy, numel) && (worker_count > 1)) {
+            // Assemble contiguous blocks of columns in parallel
+            std::vector<std::vector<OperatorSequence>> partial_data(worker_count);
+            Multithreading::fan_out(worker_count, [this, &partial_data, worker_count](const size_t worker_id) {
+                const size_t first_col = (worker_id * this->dimension) / worker_count;
+                const size_t last_col = ((worker_id + 1) * this->dimension) / worker_count;
+                this->assemble_columns(partial_data[worker_id], first_col, last_col);
+            });
+
+            matrix_data.reserve(numel);
+            for (auto& partial : partial_data) {
+                std::move(partial.begin(), partial.end(), std::back_inserter(matrix_data));
+            }
+        } else {
+            this->assemble_columns(matrix_data, 0, this->dimension);
+        }
+        assert(matrix_data.size() == numel);
+
+        return std::make_unique<MomentMatrix>(this->context, this->index, this->dimension, std::move(matrix_data));
+    }
+
+    PreparedMonomialMatrix
+    LocalityMomentMatrixFactory::prepare_matrix(const LocalityContext& context, const MomentMatrixIndex index,
+                                                const Multithreading::MultiThreadPolicy mt_policy) {
+        LocalityMomentMatrixFactory factory{context, index};
+        return PreparedMonomialMatrix{factory.make_operator_matrix(mt_policy), nullptr};
+    }
+
+    std::unique_ptr<MonomialMatrix>
+    LocalityMomentMatrixFactory::create_matrix(const LocalityContext& context, SymbolTable& symbols,
+                                               const MomentMatrixIndex index,
+                                               const Multithreading::MultiThreadPolicy mt_policy) {
+        return MonomialMatrix::register_symbols_and_create_matrix(symbols, prepare_matrix(context, index, mt_policy),
+                                                                  mt_policy);
+    }
+}
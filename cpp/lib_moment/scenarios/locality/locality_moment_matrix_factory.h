@@ -0,0 +1,125 @@
+/**
+ * locality_moment_matrix_factory.h
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+#pragma once
+
+#include "integer_types.h"
+#include "hashed_sequence.h"
+
+#include "matrix/prepared_monomial_matrix.h"
+#include "matrix_system/indices/moment_matrix_index.h"
+#include "multithreading/multithreading.h"
+
+#include <cassert>
+
+#include <memory>
+#include <vector>
+
+namespace Moment {
+    class MomentMatrix;
+    class MonomialMatrix;
+    class OperatorSequence;
+    class SymbolTable;
+}
+
+namespace Moment::Locality {
+
+    class LocalityContext;
+    class LocalityOperatorSequenceGenerator;
+
+    /**
+     * Constructs moment matrices in the locality scenario directly from per-party blocks.
+     *
+     * As operators from different parties commute, each word in the dictionary is a concatenation of per-party words,
+     * and each moment matrix element is a concatenation of per-party products. Each party's table of products (of
+     * conjugated row word and column word) is calculated once; every element of the matrix is then assembled by table
+     * look-ups, with its hash composed from the per-party hashes.
+     */
+    class LocalityMomentMatrixFactory {
+    public:
+        /** Product of two words within one party. */
+        struct LocalProduct {
+            /** Canonical local word. */
+            sequence_storage_t operators;
+
+            /** Hash of local word, without the hasher's offset. */
+            hash_t partial_hash = 0;
+
+            /** Radix raised to the length of the local word. */
+            hash_t stride = 1;
+
+            /** True if product is zero. */
+            bool zero = false;
+        };
+
+        const LocalityContext& context;
+
+        const MomentMatrixIndex index;
+
+    private:
+        /** Words in the dictionary (i.e. the columns of the matrix). */
+        const LocalityOperatorSequenceGenerator& osg;
+
+        /** Number of rows/columns in the matrix. */
+        size_t dimension = 0;
+
+        /** Number of words known to each party. */
+        std::vector<size_t> party_word_count;
+
+        /** For each word in the dictionary, the index of each party's local word (dimension x parties). */
+        std::vector<uint32_t> local_indices;
+
+        /** For each party, table of products: entry [row * word_count + col] is conj(row word) * col word. */
+        std::vector<std::vector<LocalProduct>> product_tables;
+
+    public:
+        /**
+         * Prepare per-party product tables for a moment matrix.
+         * @param context The locality context.
+         * @param index The moment matrix level.
+         */
+        LocalityMomentMatrixFactory(const LocalityContext& context, MomentMatrixIndex index);
+
+        ~LocalityMomentMatrixFactory() noexcept;
+
+        /** Number of rows/columns of the matrix to be produced. */
+        [[nodiscard]] size_t Dimension() const noexcept { return this->dimension; }
+
+        /**
+         * Product of conjugated row word and column word, for one party.
+         */
+        [[nodiscard]] const LocalProduct& local_product(size_t party, size_t row_word, size_t col_word) const noexcept {
+            assert(party < this->product_tables.size());
+            return this->product_tables[party][row_word * this->party_word_count[party] + col_word];
+        }
+
+        /**
+         * Assemble the operator matrix.
+         * @param mt_policy Whether to assemble columns in parallel.
+         */
+        [[nodiscard]] std::unique_ptr<MomentMatrix>
+        make_operator_matrix(Multithreading::MultiThreadPolicy mt_policy
+                                = Multithreading::MultiThreadPolicy::Optional) const;
+
+        /**
+         * Assemble operator matrix, without registering symbols.
+         */
+        [[nodiscard]] static PreparedMonomialMatrix
+        prepare_matrix(const LocalityContext& context, MomentMatrixIndex index,
+                       Multithreading::MultiThreadPolicy mt_policy = Multithreading::MultiThreadPolicy::Optional);
+
+        /**
+         * Full creation stack: assemble operator matrix, then register symbols and make monomial matrix.
+         */
+        [[nodiscard]] static std::unique_ptr<MonomialMatrix>
+        create_matrix(const LocalityContext& context, SymbolTable& symbols, MomentMatrixIndex index,
+                      Multithreading::MultiThreadPolicy mt_policy = Multithreading::MultiThreadPolicy::Optional);
+
+    private:
+        /** Assemble columns [first_col, last_col) into output, in column-major order. */
+        void assemble_columns(std::vector<OperatorSequence>& output, size_t first_col, size_t last_col) const;
+    };
+}
@@ -8,8 +8,9 @@
 #include "tensor_conversion.h"
 #include "locality_context.h"
 
+#include "multithreading/fan_out.h"
+
 #include <algorithm>
-#include <numeric>
 #include <stdexcept>
 
 namespace Moment::Locality {
@@ -26,131 +27,30 @@ namespace Moment::Locality {
             return TensorConvertor::TensorType{std::move(tensor_dimensions)};
         }
 
-        std::vector<double> cg_to_fc_matrix(TensorConvertor::TensorType tensor_info,
-                                            const std::span<const double> cg_tensor) {
-            std::vector<double> output(tensor_info.ElementCount, 0.0);
-
-            // Calculate marginals
-            std::vector<double> alice_marginals(tensor_info.Dimensions[0], 0.0); // sum over b for, e, a0, a1, ...
-            std::vector<double> bob_marginals(tensor_info.Dimensions[1], 0.0);   // sum over a for, e, b0, b1, ...
-
-
-            // e, b: sum over B only
-            std::array<size_t, 2> index{0, 0};
-            for (index[1] = 1; index[1] < tensor_info.Dimensions[1]; ++index[1]) {
-                const size_t offset = tensor_info.index_to_offset(index);
-                alice_marginals[0] += cg_tensor[offset];
-            }
-
-            // a, e
-            index[1] = 0;
-            for (index[0] = 1; index[0] < tensor_info.Dimensions[0]; ++index[0]) {
-                const size_t offset = tensor_info.index_to_offset(index);
-                bob_marginals[0] += cg_tensor[offset];
-            }
-
-            // a, b
-            for (index[0] = 1; index[0] < tensor_info.Dimensions[0]; ++index[0]) {
-                for (index[1] = 1; index[1] < tensor_info.Dimensions[1]; ++index[1]) {
-                    const size_t offset = tensor_info.index_to_offset(index);
-
-                    alice_marginals[index[0]] += cg_tensor[offset];
-                    bob_marginals[index[1]] += cg_tensor[offset];
-                }
-            }
-
-            // Joint marginal
-            const double central_sum = std::reduce(alice_marginals.cbegin()+1, alice_marginals.cend(), 0.0);
-
-            // Constant term
-            output[0] = cg_tensor[0] + (alice_marginals[0]/2.0) + (bob_marginals[0]/2.0) + (central_sum / 4.0);
-
-            // a- terms
-            index[1] = 0;
-            for (index[0] = 1; index[0] < tensor_info.Dimensions[0]; ++index[0]) {
-                const size_t offset = tensor_info.index_to_offset(index);
-                output[offset] = (cg_tensor[offset] /2.0) + (alice_marginals[index[0]] / 4.0);
-            }
-
-            // -b terms
-            index[0] = 0;
-            for (index[1] = 1; index[1] < tensor_info.Dimensions[1]; ++index[1]) {
-                const size_t offset = tensor_info.index_to_offset(index);
-                output[offset] = (cg_tensor[offset] /2.0) + (bob_marginals[index[1]] / 4.0);
-            }
-
-            // ab terms
-            for (index[0] = 1; index[0] < tensor_info.Dimensions[0]; ++index[0]) {
-                for (index[1] = 1; index[1] < tensor_info.Dimensions[1]; ++index[1]) {
-                    const size_t offset = tensor_info.index_to_offset(index);
-                    output[offset] = cg_tensor[offset] / 4.0;
-                }
-            }
-
-            return output;
-        }
-
-        std::vector<double> fc_to_cg_matrix(TensorConvertor::TensorType tensor_info,
-                                            const std::span<const double> fc_tensor) {
-            std::vector<double> output(tensor_info.ElementCount, 0.0);
-
-            // Calculate marginals
-            std::vector<double> alice_marginals(tensor_info.Dimensions[0], 0.0); // sum over b for, e, a0, a1, ...
-            std::vector<double> bob_marginals(tensor_info.Dimensions[1], 0.0);   // sum over a for, e, b0, b1, ...
-
-
-            // e, b: sum over B only
-            std::array<size_t, 2> index{0, 0};
-            for (index[1] = 1; index[1] < tensor_info.Dimensions[1]; ++index[1]) {
-                const size_t offset = tensor_info.index_to_offset(index);
-                alice_marginals[0] += fc_tensor[offset];
-            }
-
-            // a, e
-            index[1] = 0;
-            for (index[0] = 1; index[0] < tensor_info.Dimensions[0]; ++index[0]) {
-                const size_t offset = tensor_info.index_to_offset(index);
-                bob_marginals[0] += fc_tensor[offset];
-            }
-
-            // a, b
-            for (index[0] = 1; index[0] < tensor_info.Dimensions[0]; ++index[0]) {
-                for (index[1] = 1; index[1] < tensor_info.Dimensions[1]; ++index[1]) {
-                    const size_t offset = tensor_info.index_to_offset(index);
-
-                    alice_marginals[index[0]] += fc_tensor[offset];
-                    bob_marginals[index[1]] += fc_tensor[offset];
-                }
-            }
-
-            // Joint marginal
-            const double central_sum = std::reduce(alice_marginals.cbegin()+1, alice_marginals.cend(), 0.0);
-
-            // Constant term
-            output[0] = fc_tensor[0] + central_sum - alice_marginals[0] - bob_marginals[0];
-
-            // a- terms
-            index[1] = 0;
-            for (index[0] = 1; index[0] < tensor_info.Dimensions[0]; ++index[0]) {
-                const size_t offset = tensor_info.index_to_offset(index);
-                output[offset] = (2*fc_tensor[offset]) - (2.0 * alice_marginals[index[0]]);
-            }
-
-            // -b terms
-            index[0] = 0;
-            for (index[1] = 1; index[1] < tensor_info.Dimensions[1]; ++index[1]) {
-                const size_t offset = tensor_info.index_to_offset(index);
-                output[offset] = (2*fc_tensor[offset]) - (2.0 * bob_marginals[index[1]]);
-            }
-
-            // ab terms
-            for (index[0] = 1; index[0] < tensor_info.Dimensions[0]; ++index[0]) {
-                for (index[1] = 1; index[1] < tensor_info.Dimensions[1]; ++index[1]) {
-                    const size_t offset = tensor_info.index_to_offset(index);
-                    output[offset] = 4.0 * fc_tensor[offset];
+        /**
+         * Apply the map y_0 = x_0 + marginal_factor * sum_k x_k, y_k = joint_factor * x_k (k > 0) along every axis.
+         * @param tensor_info The tensor dimensions and strides.
+         * @param data Pointer to the first element of the tensor.
+         */
+        void transform_tensor(const TensorConvertor::TensorType& tensor_info, double * const data,
+                              const double marginal_factor, const double joint_factor) noexcept {
+            for (size_t axis = 0; axis < tensor_info.DimensionCount; ++axis) {
+                const size_t stride = tensor_info.Strides[axis];
+                const size_t dimension = tensor_info.Dimensions[axis];
+                const size_t block_size = stride * dimension;
+
+                // Each block has axis as its slowest index; the innermost loop is contiguous, and vectorizes.
+                for (size_t block_start = 0; block_start < tensor_info.ElementCount; block_start += block_size) {
+                    double * const marginal = data + block_start;
+                    for (size_t axis_index = 1; axis_index < dimension; ++axis_index) {
+                        double * const joint = marginal + (axis_index * stride);
+                        for (size_t inner = 0; inner < stride; ++inner) {
+                            marginal[inner] += marginal_factor * joint[inner];
+                            joint[inner] *= joint_factor;
+                        }
+                    }
                 }
             }
-            return output;
         }
     }
 
@@ -163,40 +63,65 @@ namespace Moment::Locality {
         } )) {
             throw std::logic_error{"Full correlator <-> Collins-Gisin conversion is only possible for binary measurements."};
         }
-
-        // For now, limit to bipartite
-        if (context.Parties.size() != 2) {
-            throw std::runtime_error{"Currently only bipartite scenarios are supported."};
-        }
-
     }
 
     std::vector<double> TensorConvertor::full_correlator_to_collins_gisin(std::span<const double> fc_tensor) const {
         if (fc_tensor.size() != this->tensor_info.ElementCount) {
-            throw std::invalid_argument("The input CG tensor view was the wrong size.");
-        }
-
-        // Special case: bipartite
-        if (tensor_info.DimensionCount == 2) {
-            return fc_to_cg_matrix(this->tensor_info, fc_tensor);
+            throw std::invalid_argument("The input FC tensor view was the wrong size.");
         }
-
-        // For now, limit to bipartite
-        throw std::runtime_error{"Currently only full-correlator matrices are supported."};
+        std::vector<double> output(fc_tensor.begin(), fc_tensor.end());
+        this->full_correlator_to_collins_gisin_in_place(output, Multithreading::MultiThreadPolicy::Never);
+        return output;
     }
 
     std::vector<double> TensorConvertor::collins_gisin_to_full_correlator(std::span<const double> cg_tensor) const {
         if (cg_tensor.size() != this->tensor_info.ElementCount) {
             throw std::invalid_argument("The input CG tensor view was the wrong size.");
         }
+        std::vector<double> output(cg_tensor.begin(), cg_tensor.end());
+        this->collins_gisin_to_full_correlator_in_place(output, Multithreading::MultiThreadPolicy::Never);
+        return output;
+    }
+
+    void TensorConvertor::full_correlator_to_collins_gisin_in_place(std::span<double> fc_tensors,
+                                                                    Multithreading::MultiThreadPolicy mt_policy) const {
+        // Per party: A = 2 P(a=0) - 1, so a + A x -> (a - x) + 2x P(a=0).
+        this->transform_in_place(fc_tensors, -1.0, 2.0, mt_policy);
+    }
+
+    void TensorConvertor::collins_gisin_to_full_correlator_in_place(std::span<double> cg_tensors,
+                                                                    Multithreading::MultiThreadPolicy mt_policy) const {
+        // Per party: P(a=0) = (1 + A)/2, so a + P(a=0) x -> (a + x/2) + (x/2) A.
+        this->transform_in_place(cg_tensors, 0.5, 0.5, mt_policy);
+    }
+
+    void TensorConvertor::transform_in_place(std::span<double> tensors,
+                                             const double marginal_factor, const double joint_factor,
+                                             Multithreading::MultiThreadPolicy mt_policy) const {
+        const size_t tensor_size = this->tensor_info.ElementCount;
+        if (tensors.empty() || ((tensors.size() % tensor_size) != 0)) {
+            throw std::invalid_argument("The input tensor view was the wrong size.");
+        }
+        const size_t tensor_count = tensors.size() / tensor_size;
 
-        // Special case: bipartite
-        if (tensor_info.DimensionCount == 2) {
-            return cg_to_fc_matrix(this->tensor_info, cg_tensor);
+        const size_t worker_count = std::min(Multithreading::get_max_worker_threads(), tensor_count);
+        if ((worker_count <= 1) || !Multithreading::should_multithread_tensor_conversion(mt_policy, tensors.size())) {
+            for (size_t tensor_index = 0; tensor_index < tensor_count; ++tensor_index) {
+                transform_tensor(this->tensor_info, tensors.data() + (tensor_index * tensor_size),
+                                 marginal_factor, joint_factor);
+            }
+            return;
         }
 
-        // For now, limit to bipartite
-        throw std::runtime_error{"Currently only full-correlator matrices are supported."};
+        // Divide tensors between workers in contiguous chunks
+        Multithreading::fan_out(worker_count, [&](const size_t worker_id) {
+            const size_t first_tensor = (tensor_count * worker_id) / worker_count;
+            const size_t last_tensor = (tensor_count * (worker_id + 1)) / worker_count;
+            for (size_t tensor_index = first_tensor; tensor_index < last_tensor; ++tensor_index) {
+                transform_tensor(this->tensor_info, tensors.data() + (tensor_index * tensor_size),
+                                 marginal_factor, joint_factor);
+            }
+        });
     }
 
-}
\ No newline at end of file
+}
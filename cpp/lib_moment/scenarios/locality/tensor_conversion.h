@@ -9,6 +9,7 @@
 
 #include "integer_types.h"
 
+#include "multithreading/multithreading.h"
 #include "tensor/tensor.h"
 
 #include <span>
@@ -20,6 +21,10 @@ namespace Moment::Locality {
 
     /**
      * Utility class, for converting between numerical CG Tensors and FC Tensors.
+     *
+     * For binary measurements, each party's Collins-Gisin operators are related to their correlators by
+     * P(a=0) = (1 + A)/2, so the conversion is a tensor product of one small map per party. This is applied in place,
+     * one party (tensor axis) at a time, in O(N x parties) operations for an N-element tensor.
      */
     class TensorConvertor {
     public:
@@ -40,6 +45,28 @@ namespace Moment::Locality {
         /** Convert Collins-Gisin to full correaltor tensor */
         std::vector<double> collins_gisin_to_full_correlator(std::span<const double> fc_tensor) const;
 
+        /**
+         * Convert full correlator tensors to Collins-Gisin tensors, overwriting the input.
+         * @param fc_tensors One or more full correlator tensors, stored consecutively.
+         * @param mt_policy Whether tensors in the batch may be converted in parallel.
+         */
+        void full_correlator_to_collins_gisin_in_place(std::span<double> fc_tensors,
+                                                       Multithreading::MultiThreadPolicy mt_policy
+                                                            = Multithreading::MultiThreadPolicy::Optional) const;
+
+        /**
+         * Convert Collins-Gisin tensors to full correlator tensors, overwriting the input.
+         * @param cg_tensors One or more Collins-Gisin tensors, stored consecutively.
+         * @param mt_policy Whether tensors in the batch may be converted in parallel.
+         */
+        void collins_gisin_to_full_correlator_in_place(std::span<double> cg_tensors,
+                                                       Multithreading::MultiThreadPolicy mt_policy
+                                                            = Multithreading::MultiThreadPolicy::Optional) const;
+
+    private:
+        void transform_in_place(std::span<double> tensors, double marginal_factor, double joint_factor,
+                                Multithreading::MultiThreadPolicy mt_policy) const;
+
     };
 
 }
@@ -36,7 +36,7 @@ namespace Moment::Pauli {
 
         NearestNeighbourIndex Index;
         OperatorSequence Word;
-        uint64_t WordHash;
+        hash_t WordHash;
 
 
         PauliMonomialIndex(const NearestNeighbourIndex& nn_info, OperatorSequence word)
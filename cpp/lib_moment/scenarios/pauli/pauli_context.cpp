@@ -71,6 +71,7 @@ namespace Moment::Pauli {
         // In symmetric mode, make hasher object
         if (translational_symmetry != SymmetryType::None) {
             this->tx_hasher = MomentSimplifier::make(*this);
+            this->moment_cache = std::make_unique<CanonicalMomentCache>();
         }
 
         // Replace with a dictionary that can handle nearest-neighbour NPA sublevels.
@@ -100,6 +101,7 @@ namespace Moment::Pauli {
         // In symmetric mode, make hasher object
         if (translational_symmetry != SymmetryType::None) {
             this->tx_hasher = MomentSimplifier::make(*this);
+            this->moment_cache = std::make_unique<CanonicalMomentCache>();
         }
 
         // Replace with a dictionary that can handle nearest-neighbour NPA sublevels.
@@ -187,6 +189,12 @@ namespace Moment::Pauli {
         return false;
     }
 
+    bool PauliContext::is_canonical_concatenation(const OperatorSequence& lhs,
+                                                  const OperatorSequence& rhs) const noexcept {
+        assert(!lhs.empty() && !rhs.empty());
+        return (lhs.raw().back() / static_cast<oper_name_t>(3)) < (rhs.raw().front() / static_cast<oper_name_t>(3));
+    }
+
     OperatorSequence PauliContext::multiply(const OperatorSequence &lhs, const OperatorSequence &rhs) const {
 
         // Get initial sign of product
@@ -214,7 +222,12 @@ namespace Moment::Pauli {
             }
         }
 
-        // Both sides are non-trivial.
+        // Both sides are non-trivial; if they act on disjoint ordered qubits, compose hash.
+        if (this->is_canonical_concatenation(lhs, rhs)) {
+            auto joined = HashedSequence::concatenate(lhs, rhs, this->hasher);
+            return OperatorSequence{OperatorSequence::ConstructRawFlag{}, std::move(joined.raw()), joined.hash(),
+                                    *this, sign};
+        }
         sequence_storage_t result;
 
         const auto * lhs_iter = lhs.raw().begin();
@@ -478,15 +491,26 @@ namespace Moment::Pauli {
     OperatorSequence PauliContext::simplify_as_moment(const OperatorSequence& seq) const {
         assert(this->translational_symmetry == SymmetryType::Translational);
         assert(this->tx_hasher); // assert hasher was instantiated
+        assert(this->moment_cache);
+
+        // Zero and identity are always canonical
+        if (seq.empty()) {
+            return this->tx_hasher->canonical_sequence(seq);
+        }
 
-        return this->tx_hasher->canonical_sequence(seq);
+        // Have we seen this sequence before?
+        if (auto cached = this->moment_cache->find(seq.hash()); cached.has_value()) {
+            return OperatorSequence{OperatorSequence::ConstructRawFlag{}, std::move(cached->operators), cached->hash,
+                                    *this, seq.get_sign()};
+        }
+
+        auto output = this->tx_hasher->canonical_sequence(seq);
+        this->moment_cache->insert(seq.hash(), output);
+        return output;
     }
 
     OperatorSequence PauliContext::simplify_as_moment(OperatorSequence&& seq) const {
-        assert(this->translational_symmetry == SymmetryType::Translational);
-        assert(this->tx_hasher); // assert hasher was instantiated
-
-        return this->tx_hasher->canonical_sequence(seq);
+        return this->simplify_as_moment(static_cast<const OperatorSequence&>(seq));
     }
 
     bool PauliContext::can_be_simplified_as_moment(const OperatorSequence& seq) const {
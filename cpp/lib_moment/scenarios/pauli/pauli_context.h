@@ -8,6 +8,7 @@
 #pragma once
 
 #include "../context.h"
+#include "../canonical_moment_cache.h"
 
 #include "dictionary/raw_polynomial.h"
 
@@ -97,6 +98,9 @@ namespace Moment {
              /** Hasher, for calculating translational symmetry equivalence classes */
              std::unique_ptr<MomentSimplifier> tx_hasher;
 
+             /** Memoized results of simplify_as_moment, shared between threads. */
+             std::unique_ptr<CanonicalMomentCache> moment_cache;
+
         public:
             /**
              * Construct a context for a chain of qubits.
@@ -147,6 +151,12 @@ namespace Moment {
 
             bool additional_simplification(sequence_storage_t &op_sequence, SequenceSignType &sign) const final;
 
+            /**
+             * Concatenation is canonical if every qubit in LHS is strictly before every qubit in RHS.
+             */
+            [[nodiscard]] bool is_canonical_concatenation(const OperatorSequence& lhs,
+                                                          const OperatorSequence& rhs) const noexcept final;
+
             [[nodiscard]] OperatorSequence
             multiply(const OperatorSequence &lhs, const OperatorSequence &rhs) const final;
 
@@ -240,6 +250,13 @@ namespace Moment {
              */
             [[nodiscard]] const MomentSimplifier& moment_simplifier() const;
 
+            /**
+             * Cache of previously calculated canonical moments, or nullptr if no translational symmetry.
+             */
+            [[nodiscard]] const CanonicalMomentCache* canonical_moment_cache() const noexcept {
+                return this->moment_cache.get();
+            }
+
             /**
              * Convert qubit offset to [row, col] pair.
              * Undefined behaviour if context is not a lattice.
@@ -9,6 +9,8 @@
 #include "pauli_context.h"
 #include "pauli_osg.h"
 
+#include "utilities/memory_footprint.h"
+
 #include <cassert>
 
 namespace Moment::Pauli {
@@ -34,7 +36,14 @@ namespace Moment::Pauli {
         read_lock.unlock();
 
         // OSG not found, so we create a new one
-        auto new_osg = std::make_unique<PauliSequenceGenerator>(this->pauliContext, index);
+        std::unique_ptr<PauliSequenceGenerator> new_osg;
+        {
+            Instrumentation::ScopedPhase timer{this->pauliContext.instrumentation(),
+                                               Instrumentation::Phase::OSGGeneration};
+            new_osg = std::make_unique<PauliSequenceGenerator>(this->pauliContext, index);
+        }
+        Instrumentation::count(this->pauliContext.instrumentation(), Instrumentation::Counter::OSGWords,
+                               new_osg->size());
 
         // Once generated, acquire write lock to store
         auto write_lock = const_cast<PauliDictionary*>(this)->get_write_lock();
@@ -58,4 +67,10 @@ namespace Moment::Pauli {
         const auto& osg_pair = this->NearestNeighbour(index);
         return osg_pair().size();
     }
+
+    size_t PauliDictionary::memory_footprint() const {
+        const size_t generator_bytes = Dictionary::memory_footprint();
+        auto read_lock = this->get_read_lock();
+        return generator_bytes + Memory::container_bytes(this->nn_indices);
+    }
 }
\ No newline at end of file
@@ -37,6 +37,8 @@ namespace Moment::Pauli {
          */
         [[nodiscard]] const size_t WordCount(const NearestNeighbourIndex& index) const;
 
+        [[nodiscard]] size_t memory_footprint() const override;
+
 
     };
 }
\ No newline at end of file
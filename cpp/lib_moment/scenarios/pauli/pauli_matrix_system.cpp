@@ -115,6 +115,22 @@ namespace Moment::Pauli {
         return ptr;
     }
 
+    PreparedMonomialMatrix
+    PauliMatrixSystem::prepare_moment_matrix(const ReadLock& lock, const size_t level,
+                                             const Multithreading::MultiThreadPolicy mt_policy) {
+        assert(this->is_locked_read_lock(lock));
+        return Pauli::MomentMatrix::prepare_matrix(this->pauliContext, Pauli::MomentMatrixIndex{level, 0}, mt_policy);
+    }
+
+    PreparedMonomialMatrix
+    PauliMatrixSystem::prepare_localizing_matrix(const ReadLock& lock, const ::Moment::LocalizingMatrixIndex& lmi,
+                                                 const Multithreading::MultiThreadPolicy mt_policy) {
+        assert(this->is_locked_read_lock(lock));
+        return Pauli::MonomialLocalizingMatrix::prepare_matrix(this->pauliContext,
+                                                               static_cast<Pauli::LocalizingMatrixIndex>(lmi),
+                                                               mt_policy);
+    }
+
     std::unique_ptr<PolynomialMatrix>
     PauliMatrixSystem::create_polynomial_localizing_matrix(const WriteLock& write_lock,
                                                            const ::Moment::PolynomialLocalizingMatrixIndex& plmi,
@@ -116,6 +116,13 @@ namespace Moment::Pauli {
                                             const ::Moment::PolynomialLocalizingMatrixIndex& index,
                                             Multithreading::MultiThreadPolicy mt_policy) override;
 
+        [[nodiscard]] PreparedMonomialMatrix
+        prepare_moment_matrix(const ReadLock& lock, size_t level, Multithreading::MultiThreadPolicy mt_policy) override;
+
+        [[nodiscard]] PreparedMonomialMatrix
+        prepare_localizing_matrix(const ReadLock& lock, const ::Moment::LocalizingMatrixIndex& lmi,
+                                  Multithreading::MultiThreadPolicy mt_policy) override;
+
         /**
          * Construct a new moment matrix, with restriction of top-row elements to N-nearest neighbours.
          */
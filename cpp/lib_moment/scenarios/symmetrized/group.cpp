@@ -15,6 +15,7 @@
 #include <atomic>
 #include <iostream>
 #include <set>
+#include <unordered_set>
 
 namespace Moment::Symmetrized {
 
@@ -131,6 +132,25 @@ namespace Moment::Symmetrized {
             return elements;
         }
 
+        // If all generators are signed permutations, use hashed generation
+        std::vector<SignedPermutation> perm_generators;
+        perm_generators.reserve(generators.size());
+        for (const auto& gen : generators) {
+            auto maybe_perm = SignedPermutation::from_matrix(gen);
+            if (!maybe_perm.has_value()) {
+                break;
+            }
+            perm_generators.emplace_back(std::move(maybe_perm.value()));
+        }
+        if (perm_generators.size() == generators.size()) {
+            const auto perm_elements = Group::dimino_generation(perm_generators, max_subgroup_size);
+            elements.reserve(perm_elements.size());
+            for (const auto& perm : perm_elements) {
+                elements.emplace_back(perm.to_matrix());
+            }
+            return elements;
+        }
+
         // Otherwise, ascertain representation dimension, and insert ID element.
         auto gen_iter = generators.cbegin();
         assert(gen_iter != generators.cend());
@@ -197,6 +217,83 @@ namespace Moment::Symmetrized {
         return elements;
     }
 
+    std::vector<SignedPermutation>
+    Group::dimino_generation(const std::vector<SignedPermutation>& generators, const size_t max_subgroup_size) {
+        std::vector<SignedPermutation> elements;
+
+        // Special case of no generators, 1x1 identity only.
+        if (generators.empty()) {
+            elements.emplace_back(1);
+            return elements;
+        }
+
+        // Otherwise, ascertain representation dimension, and insert ID element.
+        auto gen_iter = generators.cbegin();
+        const size_t rep_dim = gen_iter->dimension();
+        if (std::any_of(generators.cbegin(), generators.cend(),
+                        [rep_dim](const auto& gen) { return gen.dimension() != rep_dim; })) {
+            throw std::invalid_argument{"All generators must be of the same dimension."};
+        }
+        std::unordered_set<SignedPermutation> known_elements;
+        elements.emplace_back(rep_dim);
+        known_elements.emplace(elements.back());
+
+        // Generate orbit for first generator
+        SignedPermutation elem{*gen_iter};
+        size_t sg_index = 0;
+        while ((sg_index < max_subgroup_size) && (!elem.is_identity())) {
+            elements.emplace_back(elem);
+            known_elements.emplace(elem);
+            elem = elem * (*gen_iter);
+            ++sg_index;
+        }
+
+        // Check first subgroup was actually generated
+        if (!elem.is_identity()) {
+            throw std::runtime_error{"Maximum subgroup size reached, but orbit of first generator was not completed."};
+        }
+
+        // Cycle over remaining generators
+        ++gen_iter;
+        for (;gen_iter != generators.cend(); ++gen_iter) {
+            const auto& gen = *gen_iter;
+
+            // Skip redundant generators
+            if (known_elements.contains(gen)) {
+                continue;
+            }
+
+            // Apply generator to every element in set so far
+            const size_t previous_order = elements.size();
+            elements.reserve(previous_order*2);
+            for (size_t prev_index = 0; prev_index < previous_order; ++prev_index) {
+                elements.emplace_back(elements[prev_index] * gen);
+                known_elements.emplace(elements.back());
+            }
+
+            size_t rep_pos = previous_order;
+            do {
+                for (const auto& other_gen : generators) {
+                    // Try to find a non-trivial new coset
+                    const SignedPermutation next_coset_rep = elements[rep_pos] * other_gen;
+
+                    // Skip redundant coset
+                    if (known_elements.contains(next_coset_rep)) {
+                        continue;
+                    }
+
+                    // Add new coset (NB: no exact reserve here, to keep geometric growth of element list)
+                    for (size_t idx = 0; idx < previous_order; ++idx) {
+                        elements.emplace_back(elements[idx] * next_coset_rep);
+                        known_elements.emplace(elements.back());
+                    }
+                }
+                rep_pos += previous_order;
+            } while (rep_pos < elements.size());
+        }
+        return elements;
+    }
+
 
     const Representation& Group::create_representation(const size_t word_length,
                                                        const Multithreading::MultiThreadPolicy mt_policy) {
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "representation.h"
+#include "signed_permutation.h"
 
 #include "multithreading/multithreading.h"
 
@@ -75,6 +76,7 @@ namespace Moment::Symmetrized {
     public:
         /**
          * Generate all elements of group from a set of generators using Dimino's algorithm.
+         * If every generator is a signed permutation matrix, generation is done on SignedPermutation objects.
          * @param generators Generator matrices, all square matrices of same dimension.
          * @return List of group elements.
          */
@@ -82,6 +84,16 @@ namespace Moment::Symmetrized {
         dimino_generation(const std::vector<repmat_t>& generators,
                          size_t max_subgroup_size = 1000000);
 
+        /**
+         * Generate all elements of group from a set of signed permutations using Dimino's algorithm.
+         * Membership of each candidate element is tested by hash look-up.
+         * @param generators Generators, all of same dimension.
+         * @return List of group elements, in the same order as the matrix version.
+         */
+        [[nodiscard]] static std::vector<SignedPermutation>
+        dimino_generation(const std::vector<SignedPermutation>& generators,
+                          size_t max_subgroup_size = 1000000);
+
         [[nodiscard]] static build_list_t decompose_build_list(size_t word_length);
 
         /**
@@ -0,0 +1,156 @@
+/**
+ * orbit_symbol_table_map.cpp
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+#include "orbit_symbol_table_map.h"
+
+#include "symbolic/symbol_table.h"
+
+#include <numeric>
+#include <sstream>
+
+namespace Moment::Symmetrized {
+
+    namespace {
+        /**
+         * Union-find over indices, tracking the sign of each element relative to its parent.
+         * Roots are always the smallest index in their set.
+         */
+        class SignedUnionFind {
+        private:
+            std::vector<size_t> parent;
+            std::vector<bool> negated;
+            std::vector<bool> zero;
+
+        public:
+            explicit SignedUnionFind(const size_t size) : parent(size), negated(size, false), zero(size, false) {
+                std::iota(parent.begin(), parent.end(), 0);
+            }
+
+            /** Find root of index, and whether index is negated relative to root. */
+            std::pair<size_t, bool> find(const size_t index) {
+                size_t root = index;
+                bool sign = false;
+                while (this->parent[root] != root) {
+                    sign = (sign != this->negated[root]);
+                    root = this->parent[root];
+                }
+
+                // Path compression
+                size_t cursor = index;
+                bool cursor_sign = sign;
+                while (this->parent[cursor] != root && cursor != root) {
+                    const size_t next = this->parent[cursor];
+                    const bool next_sign = (cursor_sign != this->negated[cursor]);
+                    this->parent[cursor] = root;
+                    this->negated[cursor] = cursor_sign;
+                    cursor = next;
+                    cursor_sign = next_sign;
+                }
+                return {root, sign};
+            }
+
+            /** Register that x_rhs = (rhs_negated ? -1 : +1) * x_lhs. */
+            void join(const size_t lhs, const size_t rhs, const bool rhs_negated) {
+                auto [lhs_root, lhs_sign] = this->find(lhs);
+                auto [rhs_root, rhs_sign] = this->find(rhs);
+                const bool relative_sign = (lhs_sign != rhs_sign) != rhs_negated;
+                if (lhs_root == rhs_root) {
+                    // Element equal to its own negation
+                    if (relative_sign) {
+                        this->zero[lhs_root] = true;
+                    }
+                    return;
+                }
+
+                if (rhs_root < lhs_root) {
+                    std::swap(lhs_root, rhs_root);
+                }
+                this->parent[rhs_root] = lhs_root;
+                this->negated[rhs_root] = relative_sign;
+                if (this->zero[rhs_root]) {
+                    this->zero[lhs_root] = true;
+                }
+            }
+
+            /** True if set with root is identically zero. */
+            [[nodiscard]] bool is_zero(const size_t root) const noexcept {
+                return this->zero[root];
+            }
+        };
+    }
+
+    OrbitSymbolTableMap::OrbitSymbolTableMap(const SymbolTable& origin, SymbolTable& target,
+                                             const std::vector<SignedPermutation>& group_elements)
+             : Derived::SymbolTableMap{origin, target} {
+        if (group_elements.empty()) {
+            throw errors::bad_map{"Orbit map requires at least one group element."};
+        }
+
+        const size_t dimension = group_elements.front().dimension();
+        for (const auto& elem : group_elements) {
+            if (elem.dimension() != dimension) {
+                throw errors::bad_map{"All group elements must be of the same dimension."};
+            }
+            if ((elem.image(0) != 0) || elem.negated(0)) {
+                throw errors::bad_map{"First column of transformation must map identity to the identity."};
+            }
+        }
+
+        // Find orbits
+        SignedUnionFind orbits{dimension};
+        for (const auto& elem : group_elements) {
+            for (size_t index = 1; index < dimension; ++index) {
+                orbits.join(index, elem.image(index), elem.negated(index));
+            }
+        }
+
+        // Gather orbits, in order of their smallest element
+        std::vector<std::vector<std::pair<size_t, bool>>> members(dimension);
+        std::vector<std::pair<size_t, bool>> root_of(dimension);
+        for (size_t index = 1; index < dimension; ++index) {
+            root_of[index] = orbits.find(index);
+            members[root_of[index].first].emplace_back(index, root_of[index].second);
+        }
+
+        std::vector<symbol_name_t> new_symbol_of_root(dimension, 0);
+        this->inverse_map.reserve(2 + dimension);
+        this->inverse_map.emplace_back(Polynomial{});      // 0 -> 0 always.
+        this->inverse_map.emplace_back(Polynomial::Scalar(1.0)); // 1 -> 1 always.
+        for (size_t root = 1; root < dimension; ++root) {
+            if (members[root].empty() || orbits.is_zero(root)) {
+                continue;
+            }
+
+            // New symbol is signed average over orbit
+            const double weight = 1.0 / static_cast<double>(members[root].size());
+            Polynomial::storage_t from_y_to_x;
+            for (const auto& [member, negated] : members[root]) {
+                auto [symbol_id, conjugated] = origin.OSGIndex(member);
+                from_y_to_x.emplace_back(symbol_id, negated ? -weight : weight, conjugated);
+            }
+            new_symbol_of_root[root] = static_cast<symbol_name_t>(this->inverse_map.size());
+            this->inverse_map.emplace_back(std::move(from_y_to_x));
+        }
+
+        // Forward map: each (non-conjugate) symbol to signed orbit symbol
+        this->map.assign(origin.size(), Polynomial{}); // 0 -> 0 always
+        this->map[1] = Polynomial::Scalar(1.0); // 1 -> 1 always.
+        for (size_t index = 1; index < dimension; ++index) {
+            auto [symbol_id, conjugated] = origin.OSGIndex(index);
+            if (conjugated) {
+                continue;
+            }
+            const auto [root, negated] = root_of[index];
+            if (orbits.is_zero(root)) {
+                continue; // Leave as zero
+            }
+            this->map[symbol_id] = Polynomial{Monomial{new_symbol_of_root[root], negated ? -1.0 : 1.0}};
+        }
+        this->_is_monomial_map = true;
+
+        this->populate_target_symbols();
+    }
+}
@@ -0,0 +1,38 @@
+/**
+ * orbit_symbol_table_map.h
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+#pragma once
+
+#include "../derived/symbol_table_map.h"
+
+#include "signed_permutation.h"
+
+#include <vector>
+
+namespace Moment::Symmetrized {
+
+    /**
+     * Symbol table map for a group acting by signed permutations of operator sequences.
+     *
+     * In this case, the invariant symbols are exactly the orbits of the operator sequence generator under the group:
+     * each orbit (with consistent signs) defines one new symbol, equal to the signed average of its members, and each
+     * orbit that contains an element along with its own negation maps to zero.
+     * Orbits are found by union-find with sign tracking, without forming the averaged representation matrix or
+     * decomposing it.
+     */
+    class OrbitSymbolTableMap : public Derived::SymbolTableMap {
+    public:
+        /**
+         * Construct map from orbits.
+         * @param origin The source symbol table.
+         * @param target The (empty) target symbol table.
+         * @param group_elements Signed permutations acting on the OSG index; these need only generate the group.
+         * @throws errors::bad_map If the identity is not fixed, or elements are of the wrong dimension.
+         */
+        OrbitSymbolTableMap(const SymbolTable& origin, SymbolTable& target,
+                            const std::vector<SignedPermutation>& group_elements);
+    };
+}
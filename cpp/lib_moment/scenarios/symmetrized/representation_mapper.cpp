@@ -39,8 +39,8 @@ namespace Moment::Symmetrized {
 
             // First, reverse OSG to get map from hash to order.
             const auto& osg = context.operator_sequence_generator(target_word_length);
-            std::map<size_t, size_t> hash_to_index;
-            hash_to_index.emplace(std::make_pair(static_cast<size_t>(0), static_cast<size_t>(0))); // 0 -> 0
+            std::map<hash_t, size_t> hash_to_index;
+            hash_to_index.emplace(std::make_pair(static_cast<hash_t>(0), static_cast<size_t>(0))); // 0 -> 0
             size_t osg_index = 1;
             for (const auto& seq : osg) {
                 hash_to_index.emplace_hint(
@@ -165,6 +165,15 @@ namespace Moment::Symmetrized {
 
         this->lhs = make_lhs(this->remap, this->raw_dim, this->remapped_dim);
         this->rhs = make_rhs(this->remap, this->raw_dim, this->remapped_dim);
+
+        // Choice of raw index per remapped index, matching RHS:
+        this->raw_source.assign(this->remapped_dim, this->raw_dim);
+        for (size_t raw_index = 0; raw_index < this->raw_dim; ++raw_index) {
+            const size_t mapped_index = this->remap[raw_index];
+            if ((mapped_index > 0) && (this->raw_source[mapped_index-1] == this->raw_dim)) {
+                this->raw_source[mapped_index-1] = raw_index;
+            }
+        }
     }
 
     repmat_t RepresentationMapper::operator()(const repmat_t &matrix) const {
@@ -175,6 +184,48 @@ namespace Moment::Symmetrized {
 
 
     repmat_t RepresentationMapper::operator()(const repmat_t& elem_r1, const repmat_t& elem_r2) const {
+        // Signed permutations act directly on words
+        if (auto perm_r1 = SignedPermutation::from_matrix(elem_r1); perm_r1.has_value()) {
+            if (auto perm_r2 = SignedPermutation::from_matrix(elem_r2); perm_r2.has_value()) {
+                return (*this)(perm_r1.value(), perm_r2.value());
+            }
+        }
+
+        // Otherwise, general linear representation
+        return this->kronecker_map(elem_r1, elem_r2);
+    }
+
+    repmat_t RepresentationMapper::operator()(const SignedPermutation& elem_r1, const SignedPermutation& elem_r2) const {
+        assert(this->target_word_length > 1);
+        assert(elem_r1.dimension() == this->left_input_dim);
+        assert(elem_r2.dimension() == this->right_input_dim);
+        assert(this->raw_source.size() == this->remapped_dim);
+
+        std::vector<Eigen::Triplet<double>> triplets;
+        triplets.reserve(this->remapped_dim);
+        for (size_t col = 0; col < this->remapped_dim; ++col) {
+            // Target word is product of words (lhs_index, rhs_index) in parents
+            const size_t raw_index = this->raw_source[col];
+            const size_t lhs_index = raw_index / this->right_input_dim;
+            const size_t rhs_index = raw_index % this->right_input_dim;
+
+            // Image of word is (remapped) product of images of parent words
+            const size_t image_raw_index = elem_r1.image(lhs_index) * this->right_input_dim
+                                            + elem_r2.image(rhs_index);
+            const size_t image_index = this->remap[image_raw_index];
+            if (image_index == 0) { // Product is zero
+                continue;
+            }
+            const bool negated = elem_r1.negated(lhs_index) != elem_r2.negated(rhs_index);
+            triplets.emplace_back(static_cast<int>(image_index - 1), static_cast<int>(col), negated ? -1.0 : 1.0);
+        }
+
+        repmat_t output(static_cast<int>(this->remapped_dim), static_cast<int>(this->remapped_dim));
+        output.setFromTriplets(triplets.begin(), triplets.end());
+        return output;
+    }
+
+    repmat_t RepresentationMapper::kronecker_map(const repmat_t& elem_r1, const repmat_t& elem_r2) const {
         assert(elem_r1.cols() == this->left_input_dim);
         assert(elem_r1.rows() == this->left_input_dim);
         assert(elem_r2.cols() == this->right_input_dim);
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "representation.h"
+#include "signed_permutation.h"
 
 #include <Eigen/Sparse>
 
@@ -40,6 +41,9 @@ namespace Moment::Symmetrized {
 
         std::vector<size_t> remap;
 
+        /** For each remapped index, the first raw (Kronecker) index that maps to it. */
+        std::vector<size_t> raw_source;
+
         lhs_mat_t lhs;
         rhs_mat_t rhs;
 
@@ -104,13 +108,33 @@ namespace Moment::Symmetrized {
 
 
         /**
-         * Map group matrix in parent representation to length N representation
+         * Map group matrix in parent representation to length N representation.
+         * If both parent elements are signed permutations, the action is calculated directly on words.
          * @param p1_rep The group element in the first parent representation.
          * @param p2_rep The group element in the second parent representation.
          * @return Group element in target representation.
          */
         [[nodiscard]] repmat_t operator()(const repmat_t& p1_rep, const repmat_t& p2_rep) const;
 
+        /**
+         * Map signed permutation group elements in parent representations to length N representation.
+         * The image of each target word is the (remapped) product of the images of its parent words, so the
+         * Kronecker product of the parent representations is never formed.
+         * @param p1_rep The group element in the first parent representation.
+         * @param p2_rep The group element in the second parent representation.
+         * @return Group element in target representation.
+         */
+        [[nodiscard]] repmat_t operator()(const SignedPermutation& p1_rep, const SignedPermutation& p2_rep) const;
+
+        /**
+         * Map group matrix in parent representation to length N representation, via Kronecker product.
+         * Valid for general linear representations.
+         * @param p1_rep The group element in the first parent representation.
+         * @param p2_rep The group element in the second parent representation.
+         * @return Group element in target representation.
+         */
+        [[nodiscard]] repmat_t kronecker_map(const repmat_t& p1_rep, const repmat_t& p2_rep) const;
+
 
     };
 }
\ No newline at end of file
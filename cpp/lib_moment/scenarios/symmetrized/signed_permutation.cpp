@@ -0,0 +1,125 @@
+/**
+ * signed_permutation.cpp
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+#include "signed_permutation.h"
+
+#include <cmath>
+
+#include <stdexcept>
+
+namespace Moment::Symmetrized {
+
+    SignedPermutation::SignedPermutation(const size_t dimension) : data(dimension) {
+        for (size_t index = 0; index < dimension; ++index) {
+            this->data[index] = static_cast<uint32_t>(index << 1);
+        }
+        this->calculate_hash();
+    }
+
+    SignedPermutation::SignedPermutation(const std::vector<size_t>& images, const std::vector<bool>& negated)
+        : data(images.size()) {
+        if (images.size() != negated.size()) {
+            throw std::invalid_argument{"Image and sign lists must be of the same length."};
+        }
+        std::vector<bool> seen(images.size(), false);
+        for (size_t index = 0; index < images.size(); ++index) {
+            if ((images[index] >= images.size()) || seen[images[index]]) {
+                throw std::invalid_argument{"Images must be a permutation."};
+            }
+            seen[images[index]] = true;
+            this->data[index] = static_cast<uint32_t>((images[index] << 1) | (negated[index] ? 1 : 0));
+        }
+        this->calculate_hash();
+    }
+
+    std::optional<SignedPermutation> SignedPermutation::from_matrix(const repmat_t& matrix, const double tolerance) {
+        if (matrix.rows() != matrix.cols()) {
+            return std::nullopt;
+        }
+        const auto dimension = static_cast<size_t>(matrix.cols());
+
+        SignedPermutation output;
+        output.data.assign(dimension, 0);
+        std::vector<bool> seen(dimension, false);
+        for (int col = 0; col < matrix.outerSize(); ++col) {
+            bool found = false;
+            for (repmat_t::InnerIterator iter(matrix, col); iter; ++iter) {
+                const double value = iter.value();
+                if (std::abs(value) <= tolerance) {
+                    continue; // Explicit zero
+                }
+                // Second non-zero, or non-unit entry -> not a signed permutation
+                if (found || (std::abs(std::abs(value) - 1.0) > tolerance)) {
+                    return std::nullopt;
+                }
+                const auto row = static_cast<size_t>(iter.row());
+                if (seen[row]) {
+                    return std::nullopt;
+                }
+                seen[row] = true;
+                found = true;
+                output.data[col] = static_cast<uint32_t>((row << 1) | ((value < 0) ? 1 : 0));
+            }
+            if (!found) {
+                return std::nullopt;
+            }
+        }
+        output.calculate_hash();
+        return output;
+    }
+
+    bool SignedPermutation::is_identity() const noexcept {
+        for (size_t index = 0; index < this->data.size(); ++index) {
+            if (this->data[index] != static_cast<uint32_t>(index << 1)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    SignedPermutation SignedPermutation::operator*(const SignedPermutation& rhs) const {
+        assert(this->data.size() == rhs.data.size());
+        SignedPermutation output;
+        output.data.resize(rhs.data.size());
+        for (size_t index = 0; index < rhs.data.size(); ++index) {
+            const uint32_t mid = rhs.data[index];
+            const uint32_t end = this->data[mid >> 1];
+            output.data[index] = (end & ~1U) | ((end ^ mid) & 1U);
+        }
+        output.calculate_hash();
+        return output;
+    }
+
+    SignedPermutation SignedPermutation::inverse() const {
+        SignedPermutation output;
+        output.data.resize(this->data.size());
+        for (size_t index = 0; index < this->data.size(); ++index) {
+            const uint32_t entry = this->data[index];
+            output.data[entry >> 1] = static_cast<uint32_t>((index << 1) | (entry & 1U));
+        }
+        output.calculate_hash();
+        return output;
+    }
+
+    repmat_t SignedPermutation::to_matrix() const {
+        const auto dimension = static_cast<int>(this->data.size());
+        repmat_t output(dimension, dimension);
+        output.reserve(Eigen::VectorXi::Constant(dimension, 1));
+        for (int col = 0; col < dimension; ++col) {
+            output.insert(static_cast<int>(this->image(col)), col) = this->negated(col) ? -1.0 : 1.0;
+        }
+        output.makeCompressed();
+        return output;
+    }
+
+    void SignedPermutation::calculate_hash() noexcept {
+        uint64_t hash = 0xcbf29ce484222325ULL;
+        for (const auto entry : this->data) {
+            hash = (hash ^ entry) * 0x100000001b3ULL;
+        }
+        this->the_hash = hash;
+    }
+}
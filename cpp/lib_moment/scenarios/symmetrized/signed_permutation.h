@@ -0,0 +1,101 @@
+/**
+ * signed_permutation.h
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+#pragma once
+
+#include "representation.h"
+
+#include <cassert>
+#include <cstdint>
+
+#include <functional>
+#include <optional>
+#include <vector>
+
+namespace Moment::Symmetrized {
+
+    /**
+     * Group element that maps each basis vector to plus or minus another basis vector.
+     * Equivalently, a monomial matrix with entries in {-1, 0, +1} (exactly one non-zero per row and column).
+     *
+     * Column c of the matrix has entry sign(c) in row image(c).
+     */
+    class SignedPermutation {
+    private:
+        /** Image of each basis element; sign bit stored as lowest bit: (image << 1) | negative. */
+        std::vector<uint32_t> data;
+
+        /** Pre-calculated hash. */
+        uint64_t the_hash = 0;
+
+    public:
+        /** Construct identity permutation of supplied dimension. */
+        explicit SignedPermutation(size_t dimension);
+
+        /**
+         * Construct from list of images and signs.
+         * @param images Image of each basis element; must be a permutation of 0...N-1.
+         * @param negated For each basis element, true if the image is multiplied by -1.
+         */
+        SignedPermutation(const std::vector<size_t>& images, const std::vector<bool>& negated);
+
+        /**
+         * Attempt to read signed permutation from sparse matrix.
+         * @param matrix The matrix to interpret.
+         * @param tolerance Relative tolerance for matching entries to 0 or +/-1.
+         * @return Signed permutation if matrix is a signed permutation matrix, nullopt otherwise.
+         */
+        [[nodiscard]] static std::optional<SignedPermutation>
+        from_matrix(const repmat_t& matrix, double tolerance = 1e-12);
+
+        /** Number of basis elements acted upon. */
+        [[nodiscard]] inline size_t dimension() const noexcept { return this->data.size(); }
+
+        /** Image of basis element. */
+        [[nodiscard]] inline size_t image(const size_t index) const noexcept {
+            assert(index < this->data.size());
+            return static_cast<size_t>(this->data[index] >> 1);
+        }
+
+        /** True if image of basis element is negated. */
+        [[nodiscard]] inline bool negated(const size_t index) const noexcept {
+            assert(index < this->data.size());
+            return (this->data[index] & 1U) != 0;
+        }
+
+        /** Hash of permutation. */
+        [[nodiscard]] inline uint64_t hash() const noexcept { return this->the_hash; }
+
+        /** True if identity element. */
+        [[nodiscard]] bool is_identity() const noexcept;
+
+        /** Compose, as matrices: (this * rhs) applies rhs first, then this. */
+        [[nodiscard]] SignedPermutation operator*(const SignedPermutation& rhs) const;
+
+        /** Inverse element. */
+        [[nodiscard]] SignedPermutation inverse() const;
+
+        /** Export as sparse matrix. */
+        [[nodiscard]] repmat_t to_matrix() const;
+
+        [[nodiscard]] inline bool operator==(const SignedPermutation& rhs) const noexcept {
+            return (this->the_hash == rhs.the_hash) && (this->data == rhs.data);
+        }
+
+    private:
+        SignedPermutation() = default;
+
+        void calculate_hash() noexcept;
+    };
+
+}
+
+template<>
+struct std::hash<Moment::Symmetrized::SignedPermutation> {
+    size_t operator()(const Moment::Symmetrized::SignedPermutation& perm) const noexcept {
+        return static_cast<size_t>(perm.hash());
+    }
+};
@@ -6,6 +6,7 @@
  */
 #include "symmetrized_matrix_system.h"
 #include "group.h"
+#include "orbit_symbol_table_map.h"
 
 #include "../derived/derived_context.h"
 #include "../derived/map_core.h"
@@ -34,7 +35,21 @@ namespace Moment::Symmetrized {
         // Next, ensure group has representation for requested length.
         const auto& group_rep = this->group.create_representation(max_word_length, mt_policy);
 
-        // Next, get average of group action in this representation
+        // If group acts by signed permutations, the invariant symbols are orbits
+        std::vector<SignedPermutation> permutations;
+        permutations.reserve(group_rep.size());
+        for (const auto& elem : group_rep) {
+            auto maybe_perm = SignedPermutation::from_matrix(elem);
+            if (!maybe_perm.has_value()) {
+                break;
+            }
+            permutations.emplace_back(std::move(maybe_perm.value()));
+        }
+        if (permutations.size() == group_rep.size()) {
+            return std::make_unique<OrbitSymbolTableMap>(origin_symbols, target_symbols, permutations);
+        }
+
+        // Otherwise, get average of group action in this representation
         const repmat_t average = group_rep.sum_of() / static_cast<double>(group.size);
 
         // Do processing
@@ -10,27 +10,64 @@
 
 #include <cmath>
 
+#include <algorithm>
+#include <array>
+#include <limits>
 #include <span>
+#include <string>
 #include <vector>
 
 namespace Moment {
 
-    /** Hashes will be stored as 64-bit integers. */
-    using hash_t = uint64_t;
+    /**
+     * Write hash as decimal string (cf. ostream, which does not support 128-bit integers).
+     */
+    [[nodiscard]] inline std::string hash_to_string(hash_t hash) {
+        if (hash == 0) {
+            return "0";
+        }
+        std::string output;
+        while (hash != 0) {
+            output.push_back(static_cast<char>('0' + static_cast<int>(hash % 10)));
+            hash /= 10;
+        }
+        std::reverse(output.begin(), output.end());
+        return output;
+    }
+
+    /**
+     * Fold hash to 64 bits (e.g. for use as a key in a hash map, or for export).
+     */
+    [[nodiscard]] constexpr inline uint64_t fold_hash(const hash_t hash) noexcept {
+        if constexpr (sizeof(hash_t) > sizeof(uint64_t)) {
+            return static_cast<uint64_t>(hash) ^ static_cast<uint64_t>(hash >> (sizeof(hash_t) * 4));
+        } else {
+            return static_cast<uint64_t>(hash);
+        }
+    }
 
     /**
      * Dense hashing function, orders a sequence first by size, then lexicographically.
      */
     struct ShortlexHasher {
     public:
+        /** Number of precomputed powers of the radix (enough for the longest string hashable with radix 2). */
+        constexpr static const size_t precomputed_power_count = std::numeric_limits<hash_t>::digits + 1;
+
         /** The number of distinct unit operators. */
         const hash_t radix;
 
         /** A constant offset to add to the calculated hash. */
         const hash_t offset;
 
+    private:
+        /** Radix raised to the power 0, 1, 2, ... */
+        std::array<hash_t, precomputed_power_count> radix_powers;
+
+    public:
         /** Construct a shortlex hash function for supplied radix and offset. */
-        constexpr explicit ShortlexHasher(hash_t r, hash_t o = 1) : radix{r}, offset{o} { }
+        constexpr explicit ShortlexHasher(hash_t r, hash_t o = 1)
+            : radix{r}, offset{o}, radix_powers{make_powers(r)} { }
 
         /** Calculate the hash of an operator sequence */
         [[nodiscard]] constexpr hash_t hash(const std::span<const oper_name_t> operator_string) const noexcept {
@@ -62,15 +99,53 @@ namespace Moment {
             return hash(std::span(sequence.begin(), sequence.size()));
         }
 
+        /**
+         * Radix raised to the supplied power (i.e. the stride of a string of that length).
+         * As with the hash itself, overflows wrap around.
+         */
+        [[nodiscard]] constexpr hash_t radix_power(const size_t power) const noexcept {
+            if (power < precomputed_power_count) [[likely]] {
+                return this->radix_powers[power];
+            }
+            hash_t output = this->radix_powers[precomputed_power_count - 1];
+            for (size_t n = precomputed_power_count - 1; n < power; ++n) {
+                output *= this->radix;
+            }
+            return output;
+        }
+
+        /**
+         * Calculate the hash of the concatenation of two strings from their hashes, without re-reading the strings.
+         * @param lhs_hash The hash of the prefix string.
+         * @param rhs_hash The hash of the suffix string.
+         * @param rhs_length The length of the suffix string.
+         * @return The hash of the string 'lhs rhs'.
+         */
+        [[nodiscard]] constexpr hash_t concatenate(const hash_t lhs_hash, const hash_t rhs_hash,
+                                                   const size_t rhs_length) const noexcept {
+            return ((lhs_hash - this->offset) * this->radix_power(rhs_length)) + rhs_hash;
+        }
+
         /** The largest supported string. */
         [[nodiscard]] size_t longest_hashable_string() const {
             if (this->radix == 1) {
                 // Hash is basically just string length for radix 1.
-                return std::numeric_limits<size_t>::max() - this->offset;
+                return std::numeric_limits<size_t>::max() - static_cast<size_t>(this->offset);
             }
             return static_cast<size_t>(
-                    static_cast<double>(std::numeric_limits<size_t>::digits) / std::log2(this->radix)
+                    static_cast<double>(std::numeric_limits<hash_t>::digits)
+                        / std::log2(static_cast<double>(this->radix))
             );
         }
+
+    private:
+        [[nodiscard]] constexpr static std::array<hash_t, precomputed_power_count> make_powers(const hash_t radix) {
+            std::array<hash_t, precomputed_power_count> output{};
+            output[0] = 1;
+            for (size_t n = 1; n < precomputed_power_count; ++n) {
+                output[n] = output[n-1] * radix;
+            }
+            return output;
+        }
     };
 }
\ No newline at end of file
@@ -23,7 +23,7 @@ namespace Moment {
         return key_lhs < key_rhs;
     }
 
-    std::pair<uint64_t, uint64_t> CompareByOpHash::key(const Monomial& monomial) const noexcept {
+    std::pair<hash_t, uint64_t> CompareByOpHash::key(const Monomial& monomial) const noexcept {
         assert(monomial.id < this->symbolTable.size());
         const auto& lhs_entry = this->symbolTable[monomial.id];
         if (lhs_entry.has_sequence()) {
@@ -31,7 +31,7 @@ namespace Moment {
         }
 
         uint64_t tx_id = static_cast<uint64_t>(monomial.id)*2 + static_cast<uint64_t>(monomial.conjugated ? 1 : 0);
-        return {std::numeric_limits<uint64_t>::max(), tx_id};
+        return {std::numeric_limits<hash_t>::max(), tx_id};
     }
 
     size_t ByHashPolynomialFactory::maximum_degree(const Polynomial& poly) const {
@@ -27,7 +27,7 @@ namespace Moment {
 
         [[nodiscard]] bool operator()(const Monomial& lhs, const Monomial& rhs) const noexcept;
 
-        [[nodiscard]] std::pair<uint64_t, uint64_t> key(const Monomial& lhs) const noexcept;
+        [[nodiscard]] std::pair<hash_t, uint64_t> key(const Monomial& lhs) const noexcept;
     };
 
 
@@ -107,6 +107,9 @@ namespace Moment {
         /** Get number of terms in polynomial. */
         [[nodiscard]] size_t size() const noexcept { return this->data.size(); }
 
+        /** Bytes of heap memory owned by polynomial (zero for monomials). */
+        [[nodiscard]] size_t heap_bytes() const noexcept { return this->data.heap_bytes(); }
+
         /** True if polynomial is equal to zero. */
         [[nodiscard]] bool empty() const noexcept { return this->data.empty(); }
 
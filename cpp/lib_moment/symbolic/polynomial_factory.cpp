@@ -194,6 +194,13 @@ namespace Moment {
         return output;
     }
 
+    Polynomial PolynomialFactory::presorted(Polynomial::storage_t&& data) const {
+        assert(std::is_sorted(data.begin(), data.end(),
+                              [this](const Monomial& lhs, const Monomial& rhs) { return this->less(lhs, rhs); }));
+        Polynomial::remove_zeros(data, this->zero_tolerance);
+        return Polynomial{Polynomial::init_raw_tag{}, std::move(data)};
+    }
+
     size_t PolynomialFactory::maximum_degree(const Polynomial& poly) const {
         size_t largest_monomial = 0;
         for (auto& mono : poly) {
@@ -94,6 +94,12 @@ namespace Moment {
          */
         [[nodiscard]] Polynomial sum(const Polynomial& lhs, const Polynomial& rhs) const;
 
+        /**
+         * Construct a Polynomial from monomials that are already in factory order, with no duplicates.
+         * Terms that are approximately zero are removed, but no sorting or merging is performed.
+         */
+        [[nodiscard]] Polynomial presorted(Polynomial::storage_t&& data) const;
+
         [[nodiscard]] inline bool is_hermitian(const Polynomial& poly) const {
             return poly.is_hermitian(this->symbols, this->zero_tolerance);
         }
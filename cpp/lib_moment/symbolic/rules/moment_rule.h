@@ -169,6 +169,14 @@ namespace Moment {
          */
         [[nodiscard]] inline bool is_partial() const noexcept { return this->partial; }
 
+        /**
+         * Bytes of heap memory owned by the rule's polynomials.
+         */
+        [[nodiscard]] size_t heap_bytes() const noexcept {
+            return this->rhs.heap_bytes()
+                   + (this->split_polynomial.has_value() ? this->split_polynomial->heap_bytes() : 0);
+        }
+
         /**
          * What direction does the rule apply to?
          */
@@ -13,9 +13,13 @@
 
 #include "matrix/substituted_matrix.h"
 
+#include "scenarios/context.h"
+
 #include "scenarios/inflation/inflation_matrix_system.h"
 #include "scenarios/inflation/factor_table.h"
 
+#include "utilities/memory_footprint.h"
+
 
 #include <algorithm>
 #include <stdexcept>
@@ -129,6 +133,9 @@ namespace Moment {
             return 0;
         }
 
+        Instrumentation::ScopedPhase timer{this->context.instrumentation(),
+                                           Instrumentation::Phase::RulebookCompletion};
+
         // First, sort input raw rules by lowest leading monomial, tie-breaking with shorter strings first.
         std::sort(this->raw_rules.begin(), this->raw_rules.end(), PolynomialOrdering(this->factory));
 
@@ -239,6 +246,7 @@ namespace Moment {
         });
 
         // MonomialRules are now complete
+        Instrumentation::count(this->context.instrumentation(), Instrumentation::Counter::RulesAdded, rules_added);
         return rules_added;
     }
 
@@ -304,6 +312,17 @@ namespace Moment {
         return processed_rules;
     }
 
+    size_t MomentRulebook::memory_footprint() const noexcept {
+        size_t total = this->human_readable_name.capacity()
+                       + Memory::deep_container_bytes(this->raw_rules)
+                       + Memory::container_bytes(this->rules)
+                       + Memory::container_bytes(this->rules_in_order);
+        for (const auto& [id, rule] : this->rules) {
+            total += rule.heap_bytes();
+        }
+        return total;
+    }
+
     std::pair<MomentRulebook::rule_map_t::const_iterator, Polynomial::storage_t::const_iterator>
     MomentRulebook::match(const Polynomial &polynomial) const noexcept {
         for (auto poly_iter = polynomial.begin(); poly_iter != polynomial.end(); ++poly_iter) {
@@ -325,6 +344,7 @@ namespace Moment {
             // Rule match?
             if (rule_iter != rules.cend()) {
                 const auto& rule = rule_iter->second;
+                Instrumentation::count(this->context.instrumentation(), Instrumentation::Counter::RuleReductions);
                 if (!ever_matched) {
                     potential_output.reserve(polynomial.size() + rule_iter->second.RHS().size() - 1);
                     std::copy(polynomial.begin(), poly_iter, std::back_inserter(potential_output));
@@ -367,6 +387,7 @@ namespace Moment {
             throw errors::not_monomial{mono, poly};
         }
 
+        Instrumentation::count(this->context.instrumentation(), Instrumentation::Counter::RuleReductions);
         return rule.reduce_monomial(this->symbols, expr);
     }
 
@@ -378,6 +399,7 @@ namespace Moment {
         }
 
         // Otherwise, make substitution
+        Instrumentation::count(this->context.instrumentation(), Instrumentation::Counter::RuleReductions);
         return rule_iter->second.reduce(this->factory, expr);
     }
 
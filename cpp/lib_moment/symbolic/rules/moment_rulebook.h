@@ -284,6 +284,11 @@ namespace Moment {
          */
         [[nodiscard]] size_t size() const noexcept { return this->rules.size(); }
 
+        /**
+         * Approximate bytes used by rules, including raw rules not yet processed.
+         */
+        [[nodiscard]] size_t memory_footprint() const noexcept;
+
         /**
          * Begin iteration over rules.
          */
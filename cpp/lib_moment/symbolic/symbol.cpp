@@ -54,9 +54,9 @@ namespace Moment {
         }
         const bool has_fwd = this->opSeq.has_value();
         if (has_fwd) {
-            os << ", hash=" << this->hash();
+            os << ", hash=" << hash_to_string(this->hash());
             if (this->hash_conj() != this->hash()) {
-                os << "/" << this->hash_conj();
+                os << "/" << hash_to_string(this->hash_conj());
             }
         } else {
             os << ", unhashable";
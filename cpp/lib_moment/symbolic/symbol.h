@@ -51,6 +51,12 @@ namespace Moment {
         /** True if a concrete operator sequence is associated with this symbol */
         [[nodiscard]] constexpr bool has_sequence() const noexcept { return this->opSeq.has_value(); }
 
+        /** Bytes of heap memory owned by the symbol's operator sequences. */
+        [[nodiscard]] constexpr size_t heap_bytes() const noexcept {
+            return (this->opSeq.has_value() ? this->opSeq->heap_bytes() : 0)
+                   + (this->conjSeq.has_value() ? this->conjSeq->heap_bytes() : 0);
+        }
+
         /** The symbol ID */
         [[nodiscard]] constexpr symbol_name_t Id() const noexcept { return this->id; }
 
@@ -59,7 +65,7 @@ namespace Moment {
          * Undefined behaviour if no operator sequence associated with this entry.
          */
 
-        [[nodiscard]] constexpr size_t hash() const noexcept {
+        [[nodiscard]] constexpr hash_t hash() const noexcept {
             assert(this->opSeq.has_value());
             return this->opSeq.value().hash();
         }
@@ -68,7 +74,7 @@ namespace Moment {
          * The hash associated with the operator sequence's complex conjugate..
          * Undefined behaviour if no operator sequence associated with this entry.
          */
-        [[nodiscard]] constexpr size_t hash_conj() const noexcept {
+        [[nodiscard]] constexpr hash_t hash_conj() const noexcept {
             assert(this->conjSeq.has_value() || this->opSeq.has_value());
             return this->conjSeq.has_value() ? this->conjSeq->hash() : this->opSeq.value().hash();
         }
@@ -6,6 +6,9 @@
  */
 
 #include "symbol_errors.h"
+
+#include "shortlex_hasher.h"
+
 #include <sstream>
 
 namespace Moment::errors {
@@ -33,9 +36,9 @@ namespace Moment::errors {
             return errMsg.str();
         }
 
-        [[nodiscard]] std::string make_uos_err_msg(const std::string& formatted_sequence, const uint64_t hash_num) {
+        [[nodiscard]] std::string make_uos_err_msg(const std::string& formatted_sequence, const hash_t hash_num) {
             std::stringstream errMsg;
-            errMsg << "Sequence '" << formatted_sequence << "' (hash: " << hash_num << ") "
+            errMsg << "Sequence '" << formatted_sequence << "' (hash: " << hash_to_string(hash_num) << ") "
                    << "did not correspond to an entry in the symbol table.";
             return errMsg.str();
         }
@@ -49,7 +52,7 @@ namespace Moment::errors {
             : std::domain_error{make_ube_err_msg(real_or, basis_id)}, real{real_or}, id{basis_id} { }
 
     unregistered_operator_sequence::unregistered_operator_sequence(const std::string& formatted_sequence,
-                                                                   const uint64_t hash)
+                                                                   const hash_t hash)
             : runtime_error(make_uos_err_msg(formatted_sequence, hash)), missing_hash{hash} { }
 
 }
\ No newline at end of file
@@ -54,9 +54,9 @@ namespace Moment::errors {
     class unregistered_operator_sequence : public std::runtime_error {
     public:
         /** The hash of the missing operator sequence. */
-        const uint64_t missing_hash;
+        const hash_t missing_hash;
 
-        unregistered_operator_sequence(const std::string& formatted_sequence, uint64_t hash);
+        unregistered_operator_sequence(const std::string& formatted_sequence, hash_t hash);
     };
 
 }
\ No newline at end of file
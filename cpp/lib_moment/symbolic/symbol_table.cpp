@@ -10,6 +10,7 @@
 #include "scenarios/context.h"
 
 #include "utilities/dynamic_bitset.h"
+#include "utilities/memory_footprint.h"
 
 #include <algorithm>
 #include <iostream>
@@ -89,7 +90,21 @@ namespace Moment {
         return first_id;
     }
 
+    size_t SymbolTable::memory_footprint() const {
+        return Memory::deep_container_bytes(this->unique_sequences)
+               + Memory::container_bytes(this->hash_table)
+               + Memory::container_bytes(this->Basis.real_symbols)
+               + Memory::container_bytes(this->Basis.imaginary_symbols)
+               + Memory::container_bytes(this->Basis.im_of_real)
+               + Memory::container_bytes(this->Basis.re_of_imaginary)
+               + this->OSGIndex.memory_footprint();
+    }
+
     std::set<symbol_name_t> SymbolTable::merge_in(std::vector<Symbol> &&build_unique, size_t * const newly_added) {
+        Instrumentation::ScopedPhase timer{this->context.instrumentation(), Instrumentation::Phase::SymbolMerge};
+        Instrumentation::count(this->context.instrumentation(), Instrumentation::Counter::SymbolsOffered,
+                               build_unique.size());
+
         std::set<symbol_name_t> included_symbols;
         for (auto& elem : build_unique) {
             const auto symbol_name = this->merge_in(std::move(elem), newly_added);
@@ -99,9 +114,15 @@ namespace Moment {
     }
 
     std::set<symbol_name_t>
-    SymbolTable::merge_in(std::map<size_t, Symbol>::iterator iter,
-                          std::map<size_t, Symbol>::iterator iter_end,
+    SymbolTable::merge_in(std::map<hash_t, Symbol>::iterator iter,
+                          std::map<hash_t, Symbol>::iterator iter_end,
                           size_t * const new_symbols) {
+        Instrumentation::ScopedPhase timer{this->context.instrumentation(), Instrumentation::Phase::SymbolMerge};
+        if constexpr (Instrumentation::enabled) {
+            Instrumentation::count(this->context.instrumentation(), Instrumentation::Counter::SymbolsOffered,
+                                   static_cast<uint64_t>(std::distance(iter, iter_end)));
+        }
+
         std::set<symbol_name_t> included_symbols;
         while (iter != iter_end) {
             symbol_name_t symbol_name = this->merge_in(std::move(iter->second), new_symbols);
@@ -185,6 +206,7 @@ namespace Moment {
 
         // Register element
         this->unique_sequences.emplace_back(std::move(elem));
+        Instrumentation::count(this->context.instrumentation(), Instrumentation::Counter::SymbolsAdded);
 
         // Flag as added
         if (new_symbols != nullptr) {
@@ -250,7 +272,7 @@ namespace Moment {
 
     SymbolLookupResult
     SymbolTable::where(const OperatorSequence &seq) const noexcept {
-        const size_t hash = this->context.hash(seq);
+        const hash_t hash = this->context.hash(seq);
         auto [id, conj] = this->hash_to_index(hash);
         // Found normal.
         if (id != std::numeric_limits<ptrdiff_t>::max()) {
@@ -261,7 +283,7 @@ namespace Moment {
         // Try aliases
         if (this->can_have_aliases) {
             auto aliasedSeq = this->context.simplify_as_moment(OperatorSequence(seq));
-            const size_t alias_hash = aliasedSeq.hash();
+            const hash_t alias_hash = aliasedSeq.hash();
             if (alias_hash != seq.hash()) {
                 auto [alias_id, alias_conj] = this->hash_to_index(alias_hash);
                 // Found alias?
@@ -280,7 +302,7 @@ namespace Moment {
 
 
     Monomial SymbolTable::to_symbol(const OperatorSequence &seq) const noexcept {
-        size_t hash = this->context.hash(seq);
+        hash_t hash = this->context.hash(seq);
         auto [id, conj] = this->hash_to_index(hash);
         if (id == std::numeric_limits<ptrdiff_t>::max()) {
             return Monomial{0};
@@ -290,7 +312,7 @@ namespace Moment {
     }
 
 
-    std::pair<ptrdiff_t, bool> SymbolTable::hash_to_index(size_t hash) const noexcept {
+    std::pair<ptrdiff_t, bool> SymbolTable::hash_to_index(hash_t hash) const noexcept {
         auto hash_iter = this->hash_table.find(hash);
         if (hash_iter == this->hash_table.end()) {
             return {std::numeric_limits<ptrdiff_t>::max(), false};
@@ -313,7 +335,7 @@ namespace Moment {
         }
 
         // Merge in symbols and update OSGIndex
-        std::map<size_t, Symbol> build_unique;
+        std::map<hash_t, Symbol> build_unique;
         for (const auto& op_seq : osg) {
             // Skip aliased symbols
             if (this->can_have_aliases && this->context.can_be_simplified_as_moment(op_seq)) {
@@ -321,8 +343,8 @@ namespace Moment {
             }
 
             auto conj_seq = op_seq.conjugate();
-            const size_t seq_hash = op_seq.hash();
-            const size_t conj_hash = conj_seq.hash();
+            const hash_t seq_hash = op_seq.hash();
+            const hash_t conj_hash = conj_seq.hash();
 
             if (seq_hash == conj_hash) {
                 build_unique.emplace_hint(build_unique.end(),
@@ -41,7 +41,7 @@ namespace Moment {
 
         /** Maps hash to unique symbol; +ve is forward element, -ve is Hermitian conjugate.
          * Invariant promise: non-hermitian elements will have both forward and reverse hashes saved. */
-        std::map<size_t, ptrdiff_t> hash_table;
+        std::map<hash_t, ptrdiff_t> hash_table;
 
     public:
         /** True if aliased symbols could be present (that is, two operator sequences mapping to same moment). */
@@ -189,8 +189,8 @@ namespace Moment {
          * @param iter_end End of range of symbols to add.
          * @return The IDs of the (possibly new) symbol.
          */
-        std::set<symbol_name_t> merge_in(std::map<size_t, Symbol>::iterator iter,
-                                         std::map<size_t, Symbol>::iterator iter_end,
+        std::set<symbol_name_t> merge_in(std::map<hash_t, Symbol>::iterator iter,
+                                         std::map<hash_t, Symbol>::iterator iter_end,
                                          size_t * added = nullptr);
 
         /**
@@ -244,6 +244,12 @@ namespace Moment {
          */
         [[nodiscard]] size_t size() const noexcept { return this->unique_sequences.size(); }
 
+        /**
+         * Approximate bytes used by the symbols, their hashes, their basis indices and the OSG index.
+         * For thread safety, call for a read lock on the matrix system first.
+         */
+        [[nodiscard]] size_t memory_footprint() const;
+
        /**
          * Get the unique sequence at a supplied index.
          */
@@ -273,7 +279,7 @@ namespace Moment {
          * @param hash The hash to look up
          * @return Pair: First gives the element in unique_sequences, second is true if hash corresponds to conjugate.
          */
-        [[nodiscard]] std::pair<ptrdiff_t, bool> hash_to_index(size_t hash) const noexcept;
+        [[nodiscard]] std::pair<ptrdiff_t, bool> hash_to_index(hash_t hash) const noexcept;
 
         /**
          * Output symbol table, as debug info
@@ -8,10 +8,19 @@
 #pragma once
 
 #include "tensor.h"
+#include "lazy_block_cache.h"
 #include "multi_dimensional_offset_index_iterator.h"
 
+#include "multithreading/fan_out.h"
+#include "multithreading/multithreading.h"
+
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <functional>
+#include <iterator>
+#include <memory>
 #include <numeric>
 #include <optional>
 #include <span>
@@ -33,10 +42,24 @@ namespace Moment {
         Virtual,
         /** Generate data in advance, then read. */
         Explicit,
-        /** Automatically choose between Virtual and Explicit based on total element count. */
+        /** Generate data on first access, in blocks, and keep a bounded cache of these blocks. */
+        Lazy,
+        /**
+         * Explicit for small tensors; otherwise Virtual, but caching blocks as in Lazy mode if elements are
+         * measured to be expensive to generate.
+         */
         Automatic
     };
 
+    /** Number of consecutive elements generated together, when a tensor is lazily materialised. */
+    constexpr static const size_t lazy_tensor_block_size = 1024ULL;
+
+    /** Maximum number of elements retained in the cache of a lazily materialised tensor. */
+    constexpr static const size_t lazy_tensor_cache_element_limit = 262144ULL; // = 256 blocks.
+
+    /** Minimum measured cost of generating an element (in ns) for an automatic virtual tensor to begin caching. */
+    constexpr static const uint64_t lazy_tensor_minimum_element_cost_ns = 250ULL;
+
     template<typename tensor_t>
     class TensorRange;
 
@@ -58,6 +81,7 @@ namespace Moment {
     public:
         using TensorType = Tensor<size_t, AutoStorageIndex, AutoStorageIndexView, true>;
         using Element = elem_t;
+        using BlockPtr = typename LazyBlockCache<Element>::BlockPtr;
 
     public:
 
@@ -70,45 +94,59 @@ namespace Moment {
 
             };
 
-            std::variant<const Element *, Element> view;
+            /** Element within a lazily materialised block; holding the block keeps the element alive. */
+            struct LazyElement {
+                BlockPtr block;
+                const Element * element;
+            };
+
+            std::variant<const Element *, Element, LazyElement> view;
 
         public:
             /** Get view into tensor, constructing virtual object if necessary */
             ElementView(const AutoStorageTensor& tensor, const IndexView index) {
                 tensor.validate_index(index);
-                if (tensor.StorageType == TensorStorageType::Explicit) {
-                    const size_t offset = tensor.index_to_offset_no_checks(index);
-                    this->view.template emplace<0>(&tensor.data[offset]);
-                } else {
-                    this->view.template emplace<1>(tensor.make_element_no_checks(index));
-                }
+                this->view_index(tensor, index);
             }
 
             /** Get view into tensor, constructing virtual object if necessary */
             ElementView(const AutoStorageTensor& tensor, size_t offset) {
                 tensor.validate_offset(offset);
-                if (tensor.StorageType == TensorStorageType::Explicit) {
-                    this->view.template emplace<0>(&tensor.data[offset]);
-                } else {
-                    const auto index = tensor.offset_to_index_no_checks(offset);
-                    this->view.template emplace<1>(tensor.make_element_no_checks(index));
-                }
+                this->view_offset(tensor, offset);
             }
 
         private:
             /** Get view into tensor, constructing virtual object if necessary */
             ElementView(const AutoStorageTensor& tensor, const IndexView index, const flag_no_checks& /**/) {
-                if (tensor.StorageType == TensorStorageType::Explicit) {
-                    const size_t offset = tensor.index_to_offset_no_checks(index);
-                    this->view.template emplace<0>(&tensor.data[offset]);
+                this->view_index(tensor, index);
+            }
+
+            ElementView(const AutoStorageTensor& tensor, size_t offset, const flag_no_checks& /**/) {
+                this->view_offset(tensor, offset);
+            }
+
+            void view_index(const AutoStorageTensor& tensor, const IndexView index) {
+                if ((tensor.StorageType == TensorStorageType::Explicit) || tensor.may_cache_elements()) {
+                    this->view_offset(tensor, tensor.index_to_offset_no_checks(index));
                 } else {
                     this->view.template emplace<1>(tensor.make_element_no_checks(index));
                 }
             }
 
-            ElementView(const AutoStorageTensor& tensor, size_t offset, const flag_no_checks& /**/) {
+            void view_offset(const AutoStorageTensor& tensor, const size_t offset) {
                 if (tensor.StorageType == TensorStorageType::Explicit) {
                     this->view.template emplace<0>(&tensor.data[offset]);
+                    return;
+                }
+                auto block = tensor.lazy_block(offset);
+                if (block) {
+                    const Element * element = &((*block)[offset % lazy_tensor_block_size]);
+                    if (tensor.can_cache_element(*element)) {
+                        this->view.template emplace<2>(LazyElement{std::move(block), element});
+                    } else {
+                        // Element might have changed since block was generated: generate just this element afresh
+                        this->view.template emplace<1>(tensor.regenerate_element(block, offset));
+                    }
                 } else {
                     const auto index = tensor.offset_to_index_no_checks(offset);
                     this->view.template emplace<1>(tensor.make_element_no_checks(index));
@@ -117,18 +155,24 @@ namespace Moment {
 
         public:
             operator const Element&() const { // NOLINT(google-explicit-constructor)
-                if (this->view.index() == 0) {
-                    return *std::get<0>(this->view);
-                } else {
-                    return std::get<1>(this->view);
+                switch (this->view.index()) {
+                    case 0:
+                        return *std::get<0>(this->view);
+                    case 1:
+                        return std::get<1>(this->view);
+                    default:
+                        return *std::get<2>(this->view).element;
                 }
             }
 
             inline const Element* operator->() const {
-                if (this->view.index() == 0) {
-                    return std::get<0>(this->view);
-                } else {
-                    return &std::get<1>(this->view);
+                switch (this->view.index()) {
+                    case 0:
+                        return std::get<0>(this->view);
+                    case 1:
+                        return &std::get<1>(this->view);
+                    default:
+                        return std::get<2>(this->view).element;
                 }
             }
 
@@ -147,6 +191,12 @@ namespace Moment {
             /** Evaluated current entry (only in virtual mode). */
             mutable std::optional<Element> virtual_entry;
 
+            /** Block holding current entry (only in lazy mode). */
+            mutable BlockPtr lazy_entry_block;
+
+            /** Index of block holding current entry (only in lazy mode). */
+            mutable size_t lazy_entry_block_index = 0;
+
             /** Index, in tensor indices. */
             MultiDimensionalOffsetIndexIterator<true, Index> mdoii;
 
@@ -211,6 +261,9 @@ namespace Moment {
                 if (this->tensorPtr->StorageType == TensorStorageType::Explicit) {
                     return this->tensorPtr->data[this->current_offset];
                 }
+                if (const auto * lazy_entry = this->get_lazy_entry(); lazy_entry != nullptr) {
+                    return *lazy_entry;
+                }
                 if (!this->virtual_entry.has_value()) {
                     this->virtual_entry = this->tensorPtr->make_element_no_checks(*this->mdoii);
                 }
@@ -224,6 +277,9 @@ namespace Moment {
                 if (this->tensorPtr->StorageType == TensorStorageType::Explicit) {
                     return &this->tensorPtr->data[this->current_offset];
                 }
+                if (const auto * lazy_entry = this->get_lazy_entry(); lazy_entry != nullptr) {
+                    return lazy_entry;
+                }
                 if (!this->virtual_entry.has_value()) {
                     this->virtual_entry = this->tensorPtr->make_element_no_checks(*this->mdoii);
                 }
@@ -257,6 +313,40 @@ namespace Moment {
             [[nodiscard]] inline size_t offset() const noexcept {
                 return this->current_offset;
             }
+
+        private:
+            /**
+             * Gets current element from its lazily materialised block, regenerating it if it is not final.
+             * @return Pointer to element, or nullptr if not in lazy mode.
+             */
+            [[nodiscard]] const Element* get_lazy_entry() const {
+                if (!this->tensorPtr->may_cache_elements()) {
+                    return nullptr;
+                }
+                const size_t block_index = this->current_offset / lazy_tensor_block_size;
+                if (!this->lazy_entry_block || (this->lazy_entry_block_index != block_index)) {
+                    this->lazy_entry_block = this->tensorPtr->lazy_block(this->current_offset);
+                    this->lazy_entry_block_index = block_index;
+                }
+                if (!this->lazy_entry_block) {
+                    return nullptr;
+                }
+                const Element * element = &((*this->lazy_entry_block)[this->current_offset % lazy_tensor_block_size]);
+                if (this->tensorPtr->can_cache_element(*element)) {
+                    return element;
+                }
+
+                // Element might have changed since block was generated: generate just this element afresh
+                if (!this->virtual_entry.has_value()) {
+                    this->virtual_entry = this->tensorPtr->regenerate_element(this->lazy_entry_block,
+                                                                              this->current_offset);
+                    // If element is now final, the block is out of date, so get it afresh for the next element
+                    if (this->tensorPtr->can_cache_element(this->virtual_entry.value())) {
+                        this->lazy_entry_block.reset();
+                    }
+                }
+                return &this->virtual_entry.value();
+            }
         };
 
 
@@ -387,13 +477,53 @@ namespace Moment {
         /** Explicitly stored data */
         std::vector<Element> data;
 
+    private:
+        /** Whether lazily generated elements are kept. */
+        enum class LazyCacheState : int {
+            /** Never cache: elements are generated on every access. */
+            Disabled,
+            /** Cost of generating elements is not yet known. */
+            Unmeasured,
+            /** Cache blocks of elements. */
+            Enabled
+        };
+
+        /** Blocks of lazily generated elements (unless in explicit mode, or virtual mode was requested). */
+        std::unique_ptr<LazyBlockCache<Element>> lazy_cache;
+
+        mutable std::atomic<LazyCacheState> lazy_cache_state;
+
+        /** Measured time to generate one element, in ns; or 0 if not yet measured. */
+        mutable std::atomic<uint64_t> element_cost{0};
+
     public:
         explicit AutoStorageTensor(std::vector<size_t>&& dimensions,
                                    TensorStorageType storage = TensorStorageType::Automatic)
-         : TensorType{std::move(dimensions)}, StorageType(get_storage_type(storage, ElementCount)) { }
+         : TensorType{std::move(dimensions)}, StorageType(get_storage_type(storage, ElementCount)),
+           lazy_cache_state{initial_cache_state(storage, StorageType)} {
+            if (this->lazy_cache_state != LazyCacheState::Disabled) {
+                this->lazy_cache = std::make_unique<LazyBlockCache<Element>>(lazy_tensor_cache_element_limit
+                                                                             / lazy_tensor_block_size);
+            }
+        }
 
          virtual ~AutoStorageTensor() noexcept = default;
 
+        /** True if blocks of generated elements are currently being cached. */
+        [[nodiscard]] bool CachingElements() const noexcept {
+            return this->lazy_cache_state == LazyCacheState::Enabled;
+        }
+
+        /** Number of blocks of elements currently cached. */
+        [[nodiscard]] size_t CachedBlockCount() const {
+            return this->lazy_cache ? this->lazy_cache->size() : 0;
+        }
+
+        /** Measured time to generate one element, in ns; or 0 if not (yet) measured. */
+        [[nodiscard]] uint64_t ElementCost() const noexcept {
+            return this->element_cost;
+        }
+
         const std::vector<Element>& Data() const {
             if (this->StorageType != TensorStorageType::Explicit) {
                 throw errors::bad_tensor_no_data_stored(this->get_name(true));
@@ -466,6 +596,132 @@ namespace Moment {
          */
         [[nodiscard]] virtual Element make_element_no_checks(IndexView index) const = 0;
 
+    protected:
+        /**
+         * True if element will not change once generated, and hence may be read from a cached block in lazy mode.
+         * Other elements in a cached block are generated afresh each time they are read.
+         */
+        [[nodiscard]] virtual bool can_cache_element(const Element& /**/) const noexcept {
+            return true;
+        }
+
+    private:
+        /** True if non-explicit elements should be obtained via lazy_block. */
+        [[nodiscard]] bool may_cache_elements() const noexcept {
+            return this->lazy_cache_state != LazyCacheState::Disabled;
+        }
+
+        /**
+         * Gets the block of lazily generated elements containing offset, generating it if necessary.
+         * @return The block, or nullptr if elements should be generated individually.
+         */
+        [[nodiscard]] BlockPtr lazy_block(const size_t offset) const {
+            if (!this->may_cache_elements()) {
+                return nullptr;
+            }
+            assert(this->lazy_cache);
+
+            const size_t block_index = offset / lazy_tensor_block_size;
+            if (this->lazy_cache_state == LazyCacheState::Enabled) {
+                if (auto found = this->lazy_cache->find(block_index); found) {
+                    return found;
+                }
+            }
+
+            // Block is cached even if some elements are not final, as these are regenerated individually on read
+            auto block = this->materialise_block(block_index);
+            if (this->lazy_cache_state != LazyCacheState::Enabled) {
+                return block;
+            }
+            return this->lazy_cache->insert(block_index, std::move(block));
+        }
+
+        /**
+         * Generate a single element afresh, as its copy in a lazily materialised block was not final.
+         * If the element is now final, the cached block is out of date, so is dropped to be regenerated on next use.
+         */
+        [[nodiscard]] Element regenerate_element(const BlockPtr& block, const size_t offset) const {
+            auto element = this->make_element_no_checks(this->offset_to_index_no_checks(offset));
+            if (this->can_cache_element(element)) {
+                assert(this->lazy_cache);
+                this->lazy_cache->erase(offset / lazy_tensor_block_size, block);
+            }
+            return element;
+        }
+
+        /**
+         * Generate a block of elements.
+         * The first block generated is timed, and decides whether automatic mode caches elements. Later blocks are
+         * generated in parallel if they are estimated to be sufficiently expensive.
+         */
+        [[nodiscard]] BlockPtr materialise_block(const size_t block_index) const {
+            const size_t first = block_index * lazy_tensor_block_size;
+            const size_t last = std::min(first + lazy_tensor_block_size, this->ElementCount);
+            assert(first < last);
+            auto block = std::make_shared<std::vector<Element>>();
+            block->reserve(last - first);
+
+            const uint64_t known_cost = this->element_cost;
+            if (known_cost > 0) {
+                const bool multithread = Multithreading::should_multithread_tensor_block(
+                        Multithreading::MultiThreadPolicy::Optional, last - first, known_cost);
+                this->generate_elements(*block, first, last, multithread);
+                return block;
+            }
+
+            const auto start = std::chrono::steady_clock::now();
+            this->generate_elements(*block, first, last, false);
+            const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start).count();
+            const auto measured_cost = std::max<uint64_t>(static_cast<uint64_t>(elapsed) / (last - first), 1);
+            this->element_cost = measured_cost;
+
+            auto expected = LazyCacheState::Unmeasured;
+            this->lazy_cache_state.compare_exchange_strong(expected,
+                    (measured_cost >= lazy_tensor_minimum_element_cost_ns) ? LazyCacheState::Enabled
+                                                                           : LazyCacheState::Disabled);
+            return block;
+        }
+
+        /** Generate elements [first, last), appending them to output. */
+        void generate_elements(std::vector<Element>& output, const size_t first, const size_t last,
+                               const bool multithread) const {
+            const size_t worker_count = multithread ? std::min(Multithreading::get_max_worker_threads(), last - first)
+                                                    : 1;
+            if (worker_count <= 1) {
+                for (size_t offset = first; offset < last; ++offset) {
+                    output.emplace_back(this->make_element_no_checks(this->offset_to_index_no_checks(offset)));
+                }
+                return;
+            }
+
+            // Each worker generates one contiguous chunk of the block
+            const size_t chunk_size = ((last - first) + worker_count - 1) / worker_count;
+            std::vector<std::vector<Element>> chunks(worker_count);
+            Multithreading::fan_out(worker_count, [&](const size_t worker) {
+                const size_t chunk_first = first + (worker * chunk_size);
+                const size_t chunk_last = std::min(chunk_first + chunk_size, last);
+                chunks[worker].reserve(chunk_last > chunk_first ? chunk_last - chunk_first : 0);
+                for (size_t offset = chunk_first; offset < chunk_last; ++offset) {
+                    chunks[worker].emplace_back(this->make_element_no_checks(this->offset_to_index_no_checks(offset)));
+                }
+            });
+            for (auto& chunk : chunks) {
+                std::move(chunk.begin(), chunk.end(), std::back_inserter(output));
+            }
+        }
+
+        static constexpr LazyCacheState initial_cache_state(const TensorStorageType hint,
+                                                            const TensorStorageType actual) {
+            if (actual == TensorStorageType::Lazy) {
+                return LazyCacheState::Enabled;
+            }
+            if ((hint == TensorStorageType::Automatic) && (actual == TensorStorageType::Virtual)) {
+                return LazyCacheState::Unmeasured;
+            }
+            return LazyCacheState::Disabled;
+        }
+
     public:
         static constexpr TensorStorageType get_storage_type(const TensorStorageType hint, const size_t num_elems) {
             if (hint != TensorStorageType::Automatic) {
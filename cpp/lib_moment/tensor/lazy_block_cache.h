@@ -0,0 +1,109 @@
+/**
+ * lazy_block_cache.h
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+
+#pragma once
+
+#include <cassert>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Moment {
+
+    /**
+     * Bounded, thread-safe cache of blocks of consecutive tensor elements, with least-recently-used eviction.
+     * Blocks are shared, so a block that is evicted stays alive for as long as any reader still holds it.
+     * @tparam element_t The element type.
+     */
+    template<typename element_t>
+    class LazyBlockCache {
+    public:
+        using Block = std::vector<element_t>;
+        using BlockPtr = std::shared_ptr<const Block>;
+
+        /** Maximum number of blocks retained at once. */
+        const size_t max_blocks;
+
+    private:
+        /** Block indices, most recently used first. */
+        std::list<size_t> usage;
+
+        /** Cached blocks, and their position in the usage list. */
+        std::unordered_map<size_t, std::pair<BlockPtr, std::list<size_t>::iterator>> blocks;
+
+        mutable std::mutex mutex;
+
+    public:
+        explicit LazyBlockCache(const size_t max_blocks) : max_blocks{max_blocks > 0 ? max_blocks : 1} { }
+
+        /**
+         * Get block, if it is cached, marking it as most recently used.
+         * @return Pointer to block, or nullptr if not cached.
+         */
+        [[nodiscard]] BlockPtr find(const size_t block_index) {
+            std::lock_guard lock{this->mutex};
+            auto iter = this->blocks.find(block_index);
+            if (iter == this->blocks.end()) {
+                return nullptr;
+            }
+            this->usage.splice(this->usage.begin(), this->usage, iter->second.second);
+            return iter->second.first;
+        }
+
+        /**
+         * Cache block, evicting the least recently used block if full.
+         * @return The cached block: either the supplied block, or one that another thread cached in the interim.
+         */
+        BlockPtr insert(const size_t block_index, BlockPtr block) {
+            assert(block);
+            std::lock_guard lock{this->mutex};
+            auto iter = this->blocks.find(block_index);
+            if (iter != this->blocks.end()) {
+                this->usage.splice(this->usage.begin(), this->usage, iter->second.second);
+                return iter->second.first;
+            }
+
+            if (this->blocks.size() >= this->max_blocks) {
+                this->blocks.erase(this->usage.back());
+                this->usage.pop_back();
+            }
+
+            this->usage.push_front(block_index);
+            this->blocks.emplace(block_index, std::make_pair(block, this->usage.begin()));
+            return block;
+        }
+
+        /**
+         * Drop block, if it is still the one cached at this index (and not a replacement cached in the interim).
+         */
+        void erase(const size_t block_index, const BlockPtr& block) {
+            std::lock_guard lock{this->mutex};
+            auto iter = this->blocks.find(block_index);
+            if ((iter == this->blocks.end()) || (iter->second.first != block)) {
+                return;
+            }
+            this->usage.erase(iter->second.second);
+            this->blocks.erase(iter);
+        }
+
+        /** Number of blocks currently cached. */
+        [[nodiscard]] size_t size() const {
+            std::lock_guard lock{this->mutex};
+            return this->blocks.size();
+        }
+
+        /** Drop all cached blocks. */
+        void clear() {
+            std::lock_guard lock{this->mutex};
+            this->blocks.clear();
+            this->usage.clear();
+        }
+    };
+}
@@ -95,6 +95,22 @@ namespace Moment {
     [[nodiscard]] bool is_antihermitian(const Eigen::SparseMatrix<std::complex<double>>& data,
                                         double zero_tolerance = 1.0) noexcept;
 
+    /**
+     * Bytes of heap memory owned by a dense matrix.
+     */
+    template<typename derived_t>
+    [[nodiscard]] size_t heap_bytes(const Eigen::PlainObjectBase<derived_t>& data) noexcept {
+        return static_cast<size_t>(data.size()) * sizeof(typename derived_t::Scalar);
+    }
+
+    /**
+     * Approximate bytes of heap memory owned by a compressed sparse matrix.
+     */
+    template<typename scalar_t, int options, typename index_t>
+    [[nodiscard]] size_t heap_bytes(const Eigen::SparseMatrix<scalar_t, options, index_t>& data) noexcept {
+        return static_cast<size_t>(data.nonZeros()) * (sizeof(scalar_t) + sizeof(index_t))
+               + static_cast<size_t>(data.outerSize() + 1) * sizeof(index_t);
+    }
 
 
 
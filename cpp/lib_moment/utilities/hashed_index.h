@@ -0,0 +1,246 @@
+/**
+ * hashed_index.h
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace Moment {
+
+    /**
+     * Flat map from strings of integers to values, as an open-addressed hash table.
+     *
+     * Functionally similar to IndexTree, but a look-up costs one hash of the string, and (typically) one probe into
+     * a contiguous table, followed by verification of the full key, rather than a binary search per level of a tree.
+     *
+     * Look-ups (find) are lock-free, and may be made concurrently with a single writer (add, merge_in). Writes
+     * must be externally synchronized with each other (e.g. by holding a write lock).
+     * Entries are never moved once added, and tables replaced on growth are retained until destruction, so a reader
+     * never observes freed memory.
+     *
+     * @tparam look_up_t The integral type of elements of the key string.
+     * @tparam value_t The value type.
+     */
+    template<std::integral look_up_t, typename value_t = std::size_t>
+    class HashedIndex {
+    public:
+        using ValueType = value_t;
+
+        /** Stored entry. */
+        struct Entry {
+            uint64_t hash;
+            std::vector<look_up_t> key;
+            value_t value;
+        };
+
+    private:
+        struct Slot {
+            std::atomic<uint64_t> hash{0};
+            std::atomic<const Entry*> entry{nullptr};
+        };
+
+        struct Table {
+            const size_t capacity;
+            std::unique_ptr<Slot[]> slots;
+
+            explicit Table(const size_t capacity) : capacity{capacity}, slots{std::make_unique<Slot[]>(capacity)} {
+                assert(std::has_single_bit(capacity));
+            }
+        };
+
+        /** Owning list of entries, in order of insertion. */
+        std::vector<std::unique_ptr<Entry>> entries;
+
+        /** All tables ever created (the last being current). */
+        std::vector<std::unique_ptr<Table>> tables;
+
+        /** Current table. */
+        std::atomic<Table*> current_table;
+
+        /** Number of entries, readable without lock. */
+        std::atomic<size_t> entry_count = 0;
+
+    public:
+        /**
+         * Construct empty index.
+         * @param initial_capacity The initial number of slots (rounded up to a power of two).
+         */
+        explicit HashedIndex(const size_t initial_capacity = 64) {
+            this->tables.emplace_back(std::make_unique<Table>(std::bit_ceil(std::max<size_t>(initial_capacity, 8))));
+            this->current_table.store(this->tables.back().get(), std::memory_order_release);
+        }
+
+        HashedIndex(const HashedIndex& rhs) = delete;
+
+        /** Move constructor; not thread safe. */
+        HashedIndex(HashedIndex&& rhs) noexcept
+            : entries{std::move(rhs.entries)}, tables{std::move(rhs.tables)},
+              current_table{rhs.current_table.load(std::memory_order_acquire)},
+              entry_count{rhs.entry_count.load(std::memory_order_acquire)} {
+            rhs.reset();
+        }
+
+        /**
+         * Rolling hash of a key string.
+         */
+        [[nodiscard]] constexpr static uint64_t hash_key(const std::span<const look_up_t> key) noexcept {
+            uint64_t hash = 0xcbf29ce484222325ULL ^ static_cast<uint64_t>(key.size());
+            for (const auto elem : key) {
+                hash = (hash * 0x100000001b3ULL) + static_cast<uint64_t>(elem) + 1;
+            }
+            // Final avalanche (splitmix64), so low bits depend on whole string:
+            hash ^= (hash >> 30);
+            hash *= 0xbf58476d1ce4e5b9ULL;
+            hash ^= (hash >> 27);
+            hash *= 0x94d049bb133111ebULL;
+            hash ^= (hash >> 31);
+            return hash;
+        }
+
+        /**
+         * Find value associated with key.
+         * Lock-free; can be called concurrently with a writer.
+         */
+        [[nodiscard]] std::optional<value_t> find(const std::span<const look_up_t> key) const noexcept {
+            const auto* entry = this->find_entry(key, hash_key(key));
+            if (entry == nullptr) {
+                return std::nullopt;
+            }
+            return entry->value;
+        }
+
+        /**
+         * Add an entry to the index, if it does not already exist.
+         * Not thread safe with respect to other writers.
+         * @return Pair: the value associated with key, and true if this was newly inserted.
+         */
+        std::pair<value_t, bool> add_if_new(const std::span<const look_up_t> key, value_t value) {
+            const uint64_t hash = hash_key(key);
+            if (const auto* existing = this->find_entry(key, hash); existing != nullptr) {
+                return {existing->value, false};
+            }
+            const auto& entry = this->insert_new(hash, key, std::move(value));
+            return {entry.value, true};
+        }
+
+        /**
+         * Add an entry to the index. If the key already exists, the existing value is kept.
+         * Not thread safe with respect to other writers.
+         */
+        inline void add(const std::span<const look_up_t> key, value_t value) {
+            this->add_if_new(key, std::move(value));
+        }
+
+        /**
+         * Move all entries of another index into this one.
+         * Not thread safe with respect to other writers.
+         */
+        void merge_in(HashedIndex&& other) {
+            for (auto& entry_ptr : other.entries) {
+                if (nullptr == this->find_entry(entry_ptr->key, entry_ptr->hash)) {
+                    this->insert_entry(std::move(entry_ptr));
+                }
+            }
+            other.reset();
+        }
+
+        /** Number of entries in index. */
+        [[nodiscard]] size_t size() const noexcept {
+            return this->entry_count.load(std::memory_order_acquire);
+        }
+
+        /** True if no entries in index. */
+        [[nodiscard]] bool empty() const noexcept {
+            return this->size() == 0;
+        }
+
+        /** Iterate over entries (in insertion order). Not thread safe with respect to writers. */
+        [[nodiscard]] auto begin() const noexcept { return this->entries.cbegin(); }
+
+        /** End of iteration over entries. */
+        [[nodiscard]] auto end() const noexcept { return this->entries.cend(); }
+
+    private:
+        /** Return to empty state, discarding entries and tables. Not thread safe. */
+        void reset() {
+            this->entries.clear();
+            this->tables.clear();
+            this->tables.emplace_back(std::make_unique<Table>(8));
+            this->current_table.store(this->tables.back().get(), std::memory_order_release);
+            this->entry_count.store(0, std::memory_order_release);
+        }
+
+        [[nodiscard]] const Entry * find_entry(const std::span<const look_up_t> key,
+                                               const uint64_t hash) const noexcept {
+            const Table& table = *this->current_table.load(std::memory_order_acquire);
+            const size_t mask = table.capacity - 1;
+            for (size_t index = hash & mask; ; index = (index + 1) & mask) {
+                const Slot& slot = table.slots[index];
+                const Entry * entry = slot.entry.load(std::memory_order_acquire);
+                if (entry == nullptr) {
+                    return nullptr;
+                }
+                if ((slot.hash.load(std::memory_order_relaxed) == hash)
+                    && std::equal(entry->key.cbegin(), entry->key.cend(), key.begin(), key.end())) {
+                    return entry;
+                }
+            }
+        }
+
+        const Entry& insert_new(const uint64_t hash, const std::span<const look_up_t> key, value_t value) {
+            auto entry = std::make_unique<Entry>(Entry{hash, std::vector<look_up_t>(key.begin(), key.end()),
+                                                       std::move(value)});
+            return this->insert_entry(std::move(entry));
+        }
+
+        const Entry& insert_entry(std::unique_ptr<Entry> entry_ptr) {
+            // Grow table, keeping load factor below 1/2
+            const size_t new_count = this->entries.size() + 1;
+            Table* table = this->current_table.load(std::memory_order_relaxed);
+            if (2 * new_count > table->capacity) {
+                table = this->grow(2 * table->capacity);
+            }
+
+            const Entry& entry = *this->entries.emplace_back(std::move(entry_ptr));
+            place(*table, entry);
+            this->entry_count.store(new_count, std::memory_order_release);
+            return entry;
+        }
+
+        Table* grow(const size_t new_capacity) {
+            auto& new_table = *this->tables.emplace_back(std::make_unique<Table>(new_capacity));
+            for (const auto& entry_ptr : this->entries) {
+                place(new_table, *entry_ptr);
+            }
+            // Publish; old tables are kept alive for any readers still probing them.
+            this->current_table.store(&new_table, std::memory_order_release);
+            return &new_table;
+        }
+
+        static void place(Table& table, const Entry& entry) noexcept {
+            const size_t mask = table.capacity - 1;
+            for (size_t index = entry.hash & mask; ; index = (index + 1) & mask) {
+                Slot& slot = table.slots[index];
+                if (slot.entry.load(std::memory_order_relaxed) == nullptr) {
+                    slot.hash.store(entry.hash, std::memory_order_relaxed);
+                    slot.entry.store(&entry, std::memory_order_release);
+                    return;
+                }
+            }
+        }
+    };
+
+}
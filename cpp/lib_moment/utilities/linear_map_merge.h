@@ -30,7 +30,7 @@ namespace Moment {
                 continue;
             }
 
-            const size_t try_hash = other_iter->first;
+            const index_t try_hash = other_iter->first;
 
             // Can directly add
             if (this_iter->first < try_hash) {
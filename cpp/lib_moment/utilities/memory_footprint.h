@@ -0,0 +1,51 @@
+/**
+ * memory_footprint.h
+ *
+ * Approximate heap usage of standard containers, for memory accounting.
+ * Estimates count element storage and typical per-node bookkeeping, but not allocator overhead.
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace Moment::Memory {
+
+    /** Approximate bookkeeping bytes per node of an ordered (red-black tree) container. */
+    constexpr const size_t tree_node_overhead = 4 * sizeof(void*);
+
+    /** Bytes of heap memory reserved by vector, not counting memory owned by its elements. */
+    template<typename value_t, typename alloc_t>
+    [[nodiscard]] constexpr size_t container_bytes(const std::vector<value_t, alloc_t>& vec) noexcept {
+        return vec.capacity() * sizeof(value_t);
+    }
+
+    /** Approximate bytes of heap memory used by map, not counting memory owned by its elements. */
+    template<typename key_t, typename value_t, typename compare_t, typename alloc_t>
+    [[nodiscard]] constexpr size_t container_bytes(const std::map<key_t, value_t, compare_t, alloc_t>& map) noexcept {
+        return map.size() * (sizeof(typename std::map<key_t, value_t, compare_t, alloc_t>::value_type)
+                             + tree_node_overhead);
+    }
+
+    /** Approximate bytes of heap memory used by set, not counting memory owned by its elements. */
+    template<typename key_t, typename compare_t, typename alloc_t>
+    [[nodiscard]] constexpr size_t container_bytes(const std::set<key_t, compare_t, alloc_t>& set) noexcept {
+        return set.size() * (sizeof(key_t) + tree_node_overhead);
+    }
+
+    /** Bytes of heap memory reserved by vector, plus heap memory owned by each element. */
+    template<typename value_t, typename alloc_t>
+    [[nodiscard]] size_t deep_container_bytes(const std::vector<value_t, alloc_t>& vec) noexcept {
+        size_t total = container_bytes(vec);
+        for (const auto& elem : vec) {
+            total += elem.heap_bytes();
+        }
+        return total;
+    }
+}
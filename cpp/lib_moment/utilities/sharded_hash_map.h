@@ -0,0 +1,138 @@
+/**
+ * sharded_hash_map.h
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+#pragma once
+
+#include "shortlex_hasher.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace Moment {
+
+    /**
+     * Bounded, thread-safe map from hash keys (typically sequence hashes) to values, for memoization.
+     *
+     * The map is split into shards, each with its own read-write lock, such that concurrent workers looking up
+     * different keys will rarely touch the same mutex. Look-ups only take a shared lock, so contention only occurs
+     * when a new entry is written to the same shard.
+     *
+     * Each shard is bounded in size: once full, further insertions into that shard are silently dropped (and the
+     * caller will have to recalculate the value on each subsequent request).
+     *
+     * @tparam value_t The stored value type (returned by copy from look-ups).
+     * @tparam shard_count The number of independently-locked shards; must be a power of two.
+     */
+    template<typename value_t, size_t shard_count = 64>
+    class ShardedHashMap {
+    public:
+        static_assert(std::has_single_bit(shard_count), "Shard count must be a power of two.");
+
+        /** Default maximum number of entries, summed over all shards. */
+        constexpr static size_t default_max_entries = 1 << 22;
+
+    private:
+        struct Shard {
+            mutable std::shared_mutex mutex;
+            std::unordered_map<hash_t, value_t> data;
+        };
+
+        std::array<Shard, shard_count> shards;
+
+        const size_t max_entries_per_shard;
+
+        mutable std::atomic<size_t> hit_count = 0;
+        mutable std::atomic<size_t> miss_count = 0;
+
+    public:
+        /**
+         * Construct an empty map.
+         * @param max_entries The (approximate) maximum number of entries to store.
+         */
+        explicit ShardedHashMap(const size_t max_entries = default_max_entries)
+            : max_entries_per_shard{std::max<size_t>(1, max_entries / shard_count)} { }
+
+        ShardedHashMap(const ShardedHashMap& rhs) = delete;
+
+        ShardedHashMap(ShardedHashMap&& rhs) = delete;
+
+        /**
+         * Look up value associated with key.
+         * @return A copy of the stored value, if any.
+         */
+        [[nodiscard]] std::optional<value_t> find(const hash_t key) const {
+            const auto& shard = this->shards[shard_index(key)];
+            std::shared_lock lock{shard.mutex};
+            auto iter = shard.data.find(key);
+            if (iter == shard.data.end()) {
+                this->miss_count.fetch_add(1, std::memory_order_relaxed);
+                return std::nullopt;
+            }
+            this->hit_count.fetch_add(1, std::memory_order_relaxed);
+            return iter->second;
+        }
+
+        /**
+         * Register value associated with key.
+         * If the appropriate shard is full, or the key is already present, no insertion is made.
+         * @return True if value was inserted.
+         */
+        bool insert(const hash_t key, value_t value) {
+            auto& shard = this->shards[shard_index(key)];
+            std::unique_lock lock{shard.mutex};
+            if (shard.data.size() >= this->max_entries_per_shard) {
+                return false;
+            }
+            return shard.data.try_emplace(key, std::move(value)).second;
+        }
+
+        /**
+         * Remove all entries from the map.
+         */
+        void clear() {
+            for (auto& shard : this->shards) {
+                std::unique_lock lock{shard.mutex};
+                shard.data.clear();
+            }
+        }
+
+        /**
+         * Total number of entries currently stored.
+         */
+        [[nodiscard]] size_t size() const {
+            size_t total = 0;
+            for (const auto& shard : this->shards) {
+                std::shared_lock lock{shard.mutex};
+                total += shard.data.size();
+            }
+            return total;
+        }
+
+        /**
+         * Number of successful look-ups since construction.
+         */
+        [[nodiscard]] size_t hits() const noexcept { return this->hit_count.load(std::memory_order_relaxed); }
+
+        /**
+         * Number of unsuccessful look-ups since construction.
+         */
+        [[nodiscard]] size_t misses() const noexcept { return this->miss_count.load(std::memory_order_relaxed); }
+
+    private:
+        [[nodiscard]] constexpr static size_t shard_index(const hash_t key) noexcept {
+            // Fibonacci hashing, to spread consecutive shortlex hashes over shards:
+            return static_cast<size_t>((fold_hash(key) * 0x9E3779B97F4A7C15ULL) >> 32) & (shard_count - 1);
+        }
+    };
+
+}
@@ -295,6 +295,13 @@ namespace Moment {
             return static_cast<bool>(this->heap_data);
         }
 
+        /**
+         * Bytes of heap memory owned by the container (zero if data is stored on stack).
+         */
+        [[nodiscard]] constexpr size_t heap_bytes() const noexcept {
+            return this->heap_data ? (this->_capacity * sizeof(value_t)) : 0;
+        }
+
         /**
          * Add value at end of vector.
          */
@@ -21,17 +21,17 @@ namespace Moment::Algebraic {
     public:
         using iterator_category = std::input_iterator_tag;
         using difference_type = ptrdiff_t;
-        using value_type = uint64_t;
+        using value_type = hash_t;
         struct end_tag_t {};
 
     private:
         const sequence_storage_t * data_ptr;
-        uint64_t radix;
+        hash_t radix;
 
         ptrdiff_t _substring_start = 0;
         ptrdiff_t _substring_end = 0;
-        uint64_t _stride = 1;
-        uint64_t _current_hash;
+        hash_t _stride = 1;
+        hash_t _current_hash;
 
     public:
         constexpr SubstringHashIter(const sequence_storage_t& ss, size_t radix)
@@ -89,7 +89,7 @@ namespace Moment::Algebraic {
             return useless_copy;
         }
 
-        [[nodiscard]] constexpr uint64_t operator*() const noexcept {
+        [[nodiscard]] constexpr hash_t operator*() const noexcept {
             assert(this->_substring_start >= 0);
             return this->_current_hash;
         }
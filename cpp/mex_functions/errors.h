@@ -177,4 +177,12 @@ namespace Moment::mex {
         explicit BadSymbol(const std::string& what) : MomentMEXException{"bad_symbol", what} { }
     };
 
+    /**
+     * Error caused when an operator sequence hash is too wide to be passed to MATLAB.
+     */
+    class HashOverflow : public MomentMEXException {
+    public:
+        explicit HashOverflow(const std::string& what) : MomentMEXException{"hash_overflow", what} { }
+    };
+
 }
@@ -48,7 +48,7 @@ namespace Moment::mex {
 
             std::tuple<matlab::data::TypedArray<uint64_t>, uint64_t>
             operator()(CollinsGisinIndexView index, const CollinsGisinEntry& element) const {
-                return {export_operator_sequence(factory, element.sequence, true), element.sequence.hash()};
+                return {export_operator_sequence(factory, element.sequence, true), export_hash(element.sequence.hash())};
             }
         };
 
@@ -63,7 +63,7 @@ namespace Moment::mex {
                     throw Moment::errors::BadCGError::make_missing_index_err(index, element.sequence, true);
                 }
 
-                return {export_operator_sequence(factory, element.sequence, true), element.sequence.hash(),
+                return {export_operator_sequence(factory, element.sequence, true), export_hash(element.sequence.hash()),
                         element.symbol_id, element.real_index};
             }
         };
@@ -79,7 +79,7 @@ namespace Moment::mex {
                     throw Moment::errors::BadCGError::make_missing_index_err(index, element.sequence, true);
                 }
 
-                return {export_operator_sequence(factory, element.sequence, true), element.sequence.hash(),
+                return {export_operator_sequence(factory, element.sequence, true), export_hash(element.sequence.hash()),
                         element.symbol_id, element.real_index, element.is_alias};
             }
         };
@@ -7,7 +7,13 @@
 #include "export_operator_sequence.h"
 #include "utilities/write_as_array.h"
 
+#include "errors.h"
+
 #include "dictionary/operator_sequence.h"
+#include "shortlex_hasher.h"
+
+#include <limits>
+#include <sstream>
 
 namespace Moment::mex {
 
@@ -25,4 +31,16 @@ namespace Moment::mex {
         return output;
     }
 
+#ifdef MOMENT_WIDE_HASH
+    uint64_t export_hash(const hash_t hash) {
+        if (hash > static_cast<hash_t>(std::numeric_limits<uint64_t>::max())) {
+            std::stringstream errSS;
+            errSS << "Operator sequence hash " << hash_to_string(hash)
+                  << " is too large to export as a 64-bit integer.";
+            throw HashOverflow{errSS.str()};
+        }
+        return static_cast<uint64_t>(hash);
+    }
+#endif
+
 }
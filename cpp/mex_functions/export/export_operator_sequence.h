@@ -5,8 +5,12 @@
  * @author Andrew J. P. Garner
  */
 #pragma once
+#include "integer_types.h"
+
 #include "MatlabDataArray.hpp"
 
+#include <cstdint>
+
 namespace Moment {
     class OperatorSequence;
 }
@@ -21,4 +25,17 @@ namespace Moment::mex {
      */
     matlab::data::TypedArray<uint64_t>
     export_operator_sequence(matlab::data::ArrayFactory& factory, const OperatorSequence& sequence, bool offset = true);
+
+    /**
+     * Export operator sequence hash as an unsigned 64-bit integer.
+     * With MOMENT_WIDE_HASH, hashes that do not fit are rejected rather than truncated.
+     * @throws HashOverflow If the hash is wider than 64 bits.
+     */
+#ifdef MOMENT_WIDE_HASH
+    [[nodiscard]] uint64_t export_hash(hash_t hash);
+#else
+    [[nodiscard]] constexpr uint64_t export_hash(const hash_t hash) noexcept {
+        return hash;
+    }
+#endif
 }
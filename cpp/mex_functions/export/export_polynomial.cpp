@@ -119,7 +119,7 @@ namespace Moment::mex {
         for (const auto& [op_seq, weight]: raw_polynomial) {
             *op_iter = export_operator_sequence(factory, op_seq, true);
             *coef_iter = weight;
-            *hash_iter = op_seq.hash();
+            *hash_iter = export_hash(op_seq.hash());
 
             // Advance output iterators
             ++op_iter;
@@ -168,7 +168,7 @@ namespace Moment::mex {
             // Write outputs
             *op_iter = export_operator_sequence(factory, op_seq, true);
             *coef_iter = term.factor;
-            *hash_iter = op_seq.hash();
+            *hash_iter = export_hash(op_seq.hash());
             if (include_symbols) {
                 *symbol_iter = term.id;
                 *conj_iter = term.conjugated;
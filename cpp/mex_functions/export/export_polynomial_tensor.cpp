@@ -85,7 +85,7 @@ namespace Moment::mex {
         auto write_coefs = output.coefficients.begin();
         for (auto [sequence, coef]: to_op_seq) {
             *write_ops = export_operator_sequence(this->exporter.factory, sequence, true);
-            *write_hash = sequence.hash();
+            *write_hash = export_hash(sequence.hash());
             *write_coefs = coef;
 
             ++write_ops;
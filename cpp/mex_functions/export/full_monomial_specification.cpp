@@ -180,7 +180,7 @@ namespace Moment::mex {
         return partial_iter_t::value_type {
                 export_operator_sequence(this->factory, op_seq, true),
                 element.factor,
-                op_seq.hash()
+                export_hash(op_seq.hash())
         };
     }
 
@@ -191,7 +191,7 @@ namespace Moment::mex {
         return partial_iter_t::value_type {
             export_operator_sequence(this->factory, sequence, true),
             factor,
-            sequence.hash()
+            export_hash(sequence.hash())
         };
     }
 
@@ -207,7 +207,7 @@ namespace Moment::mex {
         return full_iter_t::value_type {
                 export_operator_sequence(this->factory, op_seq, true),
                 element.factor,
-                op_seq.hash(),
+                export_hash(op_seq.hash()),
                 element.id,
                 element.conjugated,
                 symbol.basis_key().first + 1,
@@ -226,7 +226,7 @@ namespace Moment::mex {
         return full_iter_t::value_type {
             export_operator_sequence(this->factory, sequence, true),
             sequence.negated() ? -1.0 : 1.0,
-            sequence.hash(),
+            export_hash(sequence.hash()),
             symbol.Id(),
             symbol_info.is_conjugated,
             symbol.basis_key().first + 1, // ML index
@@ -248,7 +248,7 @@ namespace Moment::mex {
         return full_iter_t::value_type{
                 export_operator_sequence(factory, op_seq, true), // ML indexing
                 monomial.factor,
-                op_seq.hash(),
+                export_hash(op_seq.hash()),
                 monomial.id,
                 monomial.conjugated,
                 symbol_info.basis_key().first + 1, // ML indexing
@@ -267,7 +267,7 @@ namespace Moment::mex {
         return full_with_alias_t::value_type {
             export_operator_sequence(this->factory, sequence, true),
             sequence.negated() ? -1.0 : 1.0,
-            sequence.hash(),
+            export_hash(sequence.hash()),
             symbol.Id(),
             symbol_ptr.is_conjugated,
             symbol.basis_key().first + 1, // ML index
@@ -294,7 +294,7 @@ namespace Moment::mex {
         return full_with_alias_t::value_type{
                 export_operator_sequence(factory, op_seq, true), // ML indexing
                 monomial.factor,
-                op_seq.hash(),
+                export_hash(op_seq.hash()),
                 monomial.id,
                 monomial.conjugated,
                 symbol_info.basis_key().first + 1, // ML indexing
@@ -101,7 +101,7 @@ namespace Moment::mex::functions {
 
             // Export hash
             if (output.size() >= 3) {
-                output[2] = factory.createScalar<uint64_t>(conjugateSeq.hash());
+                output[2] = factory.createScalar<uint64_t>(export_hash(conjugateSeq.hash()));
             }
         } else {
 
@@ -132,7 +132,7 @@ namespace Moment::mex::functions {
 
                 *out_op_seqs_iter = export_operator_sequence(factory, conjugateSeq);
                 *out_sign_iter = to_scalar(conjugateSeq.get_sign());
-                *out_hashes_iter = conjugateSeq.hash();
+                *out_hashes_iter = export_hash(conjugateSeq.hash());
 
                 // Next:
                 ++out_op_seqs_iter;
@@ -229,7 +229,7 @@ namespace Moment::mex::functions {
 
         // Export hash
         if (output.size() >= 3) {
-            output[2] = factory.createScalar<uint64_t>(opSeq.hash());
+            output[2] = factory.createScalar<uint64_t>(export_hash(opSeq.hash()));
         }
     }
 
@@ -262,7 +262,7 @@ namespace Moment::mex::functions {
 
             *out_op_seqs_iter = export_operator_sequence(factory, opSeq);
             *out_sign_iter = to_scalar(opSeq.get_sign());
-            *out_hashes_iter = opSeq.hash();
+            *out_hashes_iter = export_hash(opSeq.hash());
 
             // Next:
             ++out_op_seqs_iter;
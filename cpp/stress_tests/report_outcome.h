@@ -7,6 +7,9 @@
 
 #pragma once
 
+#include "instrumentation/instrumentation.h"
+#include "matrix_system/matrix_system.h"
+
 #include <chrono>
 #include <iostream>
 #include <stdexcept>
@@ -41,4 +44,11 @@ namespace Moment::StressTests {
         std::cout << "." << std::endl;
     }
 
+    /** Print phase timings and counters for system, if lib_moment was built with MOMENT_INSTRUMENTATION. */
+    inline void report_phases(const MatrixSystem& system) {
+        if constexpr (Instrumentation::enabled) {
+            std::cout << system.instrumentation();
+        }
+    }
+
 }
\ No newline at end of file
@@ -13,6 +13,8 @@
 #include "scenarios/algebraic/algebraic_context.h"
 #include "scenarios/algebraic/algebraic_matrix_system.h"
 
+#include "report_outcome.h"
+
 #include "integer_types.h"
 
 #include <chrono>
@@ -153,6 +155,7 @@ int main() {
                 return -1;
             }
         }
+        report_phases(bff.ams());
         std::cout << "\n";
     }
 
@@ -24,6 +24,8 @@ namespace Moment::StressTests {
 
         void set_up_ams();
 
+        [[nodiscard]] const Algebraic::AlgebraicMatrixSystem& ams() const noexcept { return *this->ams_ptr; }
+
         const Moment::SymbolicMatrix& make_moment_matrix(size_t mm_level);
     };
 }
\ No newline at end of file
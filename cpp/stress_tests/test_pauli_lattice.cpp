@@ -121,6 +121,8 @@ int main() {
 //            }
 //        }
 
+        report_phases(pms);
+
         // Next...
         std::cout << "---\n";
     }
@@ -0,0 +1,216 @@
+/**
+ * cbf_exporter_tests.cpp
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+
+#include "gtest/gtest.h"
+
+#include "export/cbf_exporter.h"
+
+#include "matrix/operator_matrix/moment_matrix.h"
+#include "scenarios/algebraic/algebraic_context.h"
+#include "scenarios/algebraic/algebraic_matrix_system.h"
+#include "symbolic/polynomial_factory.h"
+#include "symbolic/symbol_table.h"
+
+#include "export_test_helpers.h"
+
+#include <sstream>
+
+namespace Moment::Tests {
+    using namespace Moment::Algebraic;
+
+    namespace {
+        struct ParsedCBF {
+            size_t variables = 0;
+            std::vector<size_t> block_sizes;
+            std::vector<double> objective;
+
+            /** Indexed by [variable + 1][block], with index 0 being the constant term G. */
+            std::vector<std::vector<Eigen::MatrixXd>> F;
+
+            /** G + sum_j F_j x_j */
+            [[nodiscard]] Eigen::MatrixXd evaluate(const size_t block, std::span<const double> values) const {
+                Eigen::MatrixXd output = F[0][block];
+                for (size_t variable = 0; variable < this->variables; ++variable) {
+                    output += values[variable] * F[variable + 1][block];
+                }
+                return output;
+            }
+
+            void add(const size_t index, const size_t block, const size_t row, const size_t col, const double value) {
+                if (this->F.empty()) {
+                    this->F.resize(this->variables + 1);
+                    for (auto& per_variable : this->F) {
+                        for (const auto size : this->block_sizes) {
+                            const auto eigen_size = static_cast<Eigen::Index>(size);
+                            per_variable.emplace_back(Eigen::MatrixXd::Zero(eigen_size, eigen_size));
+                        }
+                    }
+                }
+                ASSERT_LT(index, this->F.size());
+                ASSERT_LT(block, this->block_sizes.size());
+                EXPECT_GE(row, col);
+                auto& matrix = this->F[index][block];
+                const auto r = static_cast<Eigen::Index>(row);
+                const auto c = static_cast<Eigen::Index>(col);
+                EXPECT_EQ(matrix(r, c), 0.0) << "Repeated entry";
+                matrix(r, c) = value;
+                matrix(c, r) = value;
+            }
+        };
+
+        ParsedCBF parse_cbf(const std::string& text) {
+            ParsedCBF output;
+            std::istringstream input{text};
+            std::string keyword;
+            while (input >> keyword) {
+                if (keyword.front() == '#') {
+                    std::getline(input, keyword);
+                } else if (keyword == "VER") {
+                    size_t version;
+                    input >> version;
+                    EXPECT_EQ(version, 3);
+                } else if (keyword == "OBJSENSE") {
+                    input >> keyword;
+                    EXPECT_EQ(keyword, "MIN");
+                } else if (keyword == "VAR") {
+                    size_t cones;
+                    input >> output.variables >> cones;
+                    size_t total = 0;
+                    for (size_t cone = 0; cone < cones; ++cone) {
+                        size_t size;
+                        input >> keyword >> size;
+                        EXPECT_EQ(keyword, "F");
+                        total += size;
+                    }
+                    EXPECT_EQ(total, output.variables);
+                    output.objective.assign(output.variables, 0.0);
+                } else if (keyword == "OBJACOORD") {
+                    size_t count;
+                    input >> count;
+                    for (size_t entry = 0; entry < count; ++entry) {
+                        size_t variable;
+                        double value;
+                        input >> variable >> value;
+                        EXPECT_LT(variable, output.variables);
+                        output.objective[variable] = value;
+                    }
+                } else if (keyword == "PSDCON") {
+                    size_t count;
+                    input >> count;
+                    output.block_sizes.resize(count);
+                    for (auto& size : output.block_sizes) {
+                        input >> size;
+                    }
+                } else if (keyword == "HCOORD") {
+                    size_t count;
+                    input >> count;
+                    for (size_t entry = 0; entry < count; ++entry) {
+                        size_t block, variable, row, col;
+                        double value;
+                        EXPECT_TRUE(input >> block >> variable >> row >> col >> value);
+                        output.add(variable + 1, block, row, col, value);
+                    }
+                } else if (keyword == "DCOORD") {
+                    size_t count;
+                    input >> count;
+                    for (size_t entry = 0; entry < count; ++entry) {
+                        size_t block, row, col;
+                        double value;
+                        EXPECT_TRUE(input >> block >> row >> col >> value);
+                        output.add(0, block, row, col, value);
+                    }
+                } else {
+                    ADD_FAILURE() << "Unexpected keyword \"" << keyword << "\"";
+                    break;
+                }
+            }
+            return output;
+        }
+
+        std::string export_to_string(const SolverExporter& exporter, const std::vector<ptrdiff_t>& indices,
+                                     const Polynomial& objective = Polynomial{}) {
+            std::stringstream ss;
+            exporter.write(ss, indices, objective);
+            return ss.str();
+        }
+    }
+
+    TEST(Export_CBFExporter, RealMomentMatrix) {
+        AlgebraicMatrixSystem ams{std::make_unique<AlgebraicContext>(AlgebraicPrecontext{2}, true, true)};
+        const auto [id, mm] = ams.MomentMatrix.create(2);
+        ASSERT_FALSE(mm.HasComplexBasis());
+
+        CBFExporter exporter{ams};
+        const auto parsed = parse_cbf(export_to_string(exporter, {static_cast<ptrdiff_t>(id)}));
+        EXPECT_EQ(parsed.variables, exporter.variable_count());
+        ASSERT_EQ(parsed.block_sizes, std::vector<size_t>{6});
+        ASSERT_FALSE(parsed.F.empty());
+
+        const auto values = export_test_values(parsed.variables);
+        assert_same_block("Moment matrix", parsed.evaluate(0, values), expected_export_block(mm, values));
+    }
+
+    TEST(Export_CBFExporter, ComplexMomentMatrix) {
+        AlgebraicMatrixSystem ams{std::make_unique<AlgebraicContext>(2)};
+        const auto [id, mm] = ams.MomentMatrix.create(2);
+        ASSERT_TRUE(mm.HasComplexBasis());
+
+        CBFExporter exporter{ams};
+        const auto parsed = parse_cbf(export_to_string(exporter, {static_cast<ptrdiff_t>(id)}));
+        EXPECT_EQ(parsed.variables, exporter.variable_count());
+        ASSERT_EQ(parsed.block_sizes, std::vector<size_t>{2 * mm.Dimension()});
+        ASSERT_FALSE(parsed.F.empty());
+
+        const auto values = export_test_values(parsed.variables);
+        assert_same_block("Moment matrix", parsed.evaluate(0, values), expected_export_block(mm, values));
+    }
+
+    TEST(Export_CBFExporter, Objective) {
+        AlgebraicMatrixSystem ams{std::make_unique<AlgebraicContext>(2)};
+        const auto& context = ams.Context();
+        const auto& symbols = ams.Symbols();
+        const auto [id, mm] = ams.MomentMatrix.create(1);
+        const auto& s_b = *symbols.where(OperatorSequence({1}, context));
+
+        const auto& factory = ams.polynomial_factory();
+        const auto objective = factory({Monomial{s_b.Id(), -3.0}});
+
+        CBFExporter exporter{ams};
+        const auto parsed = parse_cbf(export_to_string(exporter, {static_cast<ptrdiff_t>(id)}, objective));
+        std::vector<double> expected(exporter.variable_count(), 0.0);
+        expected[static_cast<size_t>(s_b.basis_key().first) - 1] = -3.0;
+        EXPECT_EQ(parsed.objective, expected);
+    }
+
+    TEST(Export_CBFExporter, ParallelMatchesSerial) {
+        AlgebraicMatrixSystem ams{std::make_unique<AlgebraicContext>(3)};
+        const auto& context = ams.Context();
+        std::vector<ptrdiff_t> indices;
+        for (size_t level = 1; level <= 2; ++level) {
+            indices.emplace_back(static_cast<ptrdiff_t>(ams.MomentMatrix.create(level).first));
+        }
+        for (oper_name_t op = 0; op < 3; ++op) {
+            indices.emplace_back(static_cast<ptrdiff_t>(
+                    ams.LocalizingMatrix.create(LocalizingMatrixIndex{1, OperatorSequence{{op}, context}}).first));
+        }
+
+        CBFExporter serial{ams, Multithreading::MultiThreadPolicy::Never};
+        CBFExporter parallel{ams, Multithreading::MultiThreadPolicy::Always};
+        parallel.buffer_capacity = 16;
+        const auto serial_text = export_to_string(serial, indices);
+        EXPECT_EQ(export_to_string(parallel, indices), serial_text);
+
+        const auto parsed = parse_cbf(serial_text);
+        ASSERT_EQ(parsed.block_sizes.size(), indices.size());
+        ASSERT_FALSE(parsed.F.empty());
+        const auto values = export_test_values(parsed.variables);
+        for (size_t block = 0; block < indices.size(); ++block) {
+            assert_same_block("Block " + std::to_string(block), parsed.evaluate(block, values),
+                              expected_export_block(ams[indices[block]], values));
+        }
+    }
+}
@@ -0,0 +1,62 @@
+/**
+ * export_test_helpers.h
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+
+#pragma once
+
+#include "gtest/gtest.h"
+
+#include "matrix/symbolic_matrix.h"
+#include "matrix/matrix_basis.h"
+
+#include <Eigen/Dense>
+
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Moment::Tests {
+
+    /** Arbitrary distinct values for each exported variable. */
+    inline std::vector<double> export_test_values(const size_t variable_count) {
+        std::vector<double> output;
+        output.reserve(variable_count);
+        for (size_t variable = 0; variable < variable_count; ++variable) {
+            output.emplace_back(0.5 + 0.25 * static_cast<double>(variable));
+        }
+        return output;
+    }
+
+    /** The block an exporter should write for a matrix, evaluated at supplied variable values. */
+    inline Eigen::MatrixXd expected_export_block(const SymbolicMatrix& matrix, std::span<const double> values) {
+        const auto& [real, imaginary] = matrix.Basis.DenseComplex();
+        Eigen::MatrixXcd evaluated = real[0];
+        for (size_t index = 1; index < real.size(); ++index) {
+            evaluated += values[index - 1] * real[index];
+        }
+        for (size_t index = 0; index < imaginary.size(); ++index) {
+            evaluated += values[real.size() - 1 + index] * imaginary[index];
+        }
+
+        if (!matrix.HasComplexBasis() && !matrix.HasComplexCoefficients()) {
+            return evaluated.real();
+        }
+        const auto dimension = static_cast<Eigen::Index>(matrix.Dimension());
+        Eigen::MatrixXd output(2 * dimension, 2 * dimension);
+        output << evaluated.real(), -evaluated.imag(), evaluated.imag(), evaluated.real();
+        return output;
+    }
+
+    inline void assert_same_block(const std::string& name, const Eigen::MatrixXd& test, const Eigen::MatrixXd& ref) {
+        ASSERT_EQ(test.rows(), ref.rows()) << name;
+        ASSERT_EQ(test.cols(), ref.cols()) << name;
+        for (Eigen::Index col = 0; col < ref.cols(); ++col) {
+            for (Eigen::Index row = 0; row < ref.rows(); ++row) {
+                EXPECT_NEAR(test(row, col), ref(row, col), 1e-12) << name << ": (" << row << ", " << col << ")";
+            }
+        }
+    }
+}
@@ -0,0 +1,289 @@
+/**
+ * sdpa_exporter_tests.cpp
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+
+#include "gtest/gtest.h"
+
+#include "export/sdpa_exporter.h"
+
+#include "matrix/operator_matrix/moment_matrix.h"
+#include "matrix/polynomial_matrix.h"
+#include "matrix_system/matrix_system_errors.h"
+#include "scenarios/algebraic/algebraic_context.h"
+#include "scenarios/algebraic/algebraic_matrix_system.h"
+#include "symbolic/polynomial_factory.h"
+#include "symbolic/symbol_table.h"
+
+#include "export_test_helpers.h"
+
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+
+namespace Moment::Tests {
+    using namespace Moment::Algebraic;
+
+    namespace {
+        struct ParsedSDPA {
+            size_t variables = 0;
+            std::vector<size_t> block_sizes;
+            std::vector<double> objective;
+
+            /** Indexed by [variable][block], with variable 0 being F_0. */
+            std::vector<std::vector<Eigen::MatrixXd>> F;
+
+            /** X = sum_i F_i x_i - F_0 */
+            [[nodiscard]] Eigen::MatrixXd evaluate(const size_t block, std::span<const double> values) const {
+                Eigen::MatrixXd output = -F[0][block];
+                for (size_t variable = 1; variable <= this->variables; ++variable) {
+                    output += values[variable - 1] * F[variable][block];
+                }
+                return output;
+            }
+        };
+
+        ParsedSDPA parse_sdpa(const std::string& text) {
+            ParsedSDPA output;
+            std::istringstream input{text};
+            std::string line;
+            do {
+                std::getline(input, line);
+            } while (!line.empty() && ((line.front() == '"') || (line.front() == '*')));
+
+            output.variables = std::stoull(line);
+            std::getline(input, line);
+            const size_t block_count = std::stoull(line);
+
+            std::getline(input, line);
+            std::istringstream block_line{line};
+            output.block_sizes.resize(block_count);
+            for (auto& size : output.block_sizes) {
+                block_line >> size;
+            }
+
+            std::getline(input, line);
+            std::istringstream objective_line{line};
+            output.objective.resize(output.variables);
+            for (auto& c : output.objective) {
+                objective_line >> c;
+            }
+
+            output.F.resize(output.variables + 1);
+            for (auto& per_variable : output.F) {
+                for (const auto size : output.block_sizes) {
+                    const auto eigen_size = static_cast<Eigen::Index>(size);
+                    per_variable.emplace_back(Eigen::MatrixXd::Zero(eigen_size, eigen_size));
+                }
+            }
+
+            std::set<std::tuple<size_t, size_t, size_t, size_t>> seen;
+            size_t variable, block, row, col;
+            double value;
+            while (input >> variable >> block >> row >> col >> value) {
+                EXPECT_LE(variable, output.variables);
+                EXPECT_GE(block, 1);
+                EXPECT_LE(block, block_count);
+                EXPECT_LE(row, col);
+                EXPECT_TRUE(seen.emplace(variable, block, row, col).second)
+                    << "Repeated entry " << variable << " " << block << " " << row << " " << col;
+                auto& matrix = output.F[variable][block - 1];
+                const auto r = static_cast<Eigen::Index>(row - 1);
+                const auto c = static_cast<Eigen::Index>(col - 1);
+                matrix(r, c) = value;
+                matrix(c, r) = value;
+            }
+            EXPECT_TRUE(input.eof());
+            return output;
+        }
+
+        std::string export_to_string(const SolverExporter& exporter, const std::vector<ptrdiff_t>& indices,
+                                     const Polynomial& objective = Polynomial{}) {
+            std::stringstream ss;
+            exporter.write(ss, indices, objective);
+            return ss.str();
+        }
+    }
+
+    TEST(Export_SDPAExporter, RealMomentMatrix) {
+        AlgebraicMatrixSystem ams{std::make_unique<AlgebraicContext>(AlgebraicPrecontext{2}, true, true)};
+        const auto& symbols = ams.Symbols();
+        const auto [id, mm] = ams.MomentMatrix.create(2);
+        ASSERT_EQ(mm.Dimension(), 6);
+        ASSERT_FALSE(mm.HasComplexBasis());
+
+        SDPAExporter exporter{ams};
+        const auto parsed = parse_sdpa(export_to_string(exporter, {static_cast<ptrdiff_t>(id)}));
+        EXPECT_EQ(parsed.variables, exporter.variable_count());
+        EXPECT_EQ(parsed.variables,
+                  symbols.Basis.RealSymbolCount() - 1 + symbols.Basis.ImaginarySymbolCount());
+        ASSERT_EQ(parsed.block_sizes, std::vector<size_t>{6});
+        for (const auto c : parsed.objective) {
+            EXPECT_EQ(c, 0.0);
+        }
+
+        const auto values = export_test_values(parsed.variables);
+        assert_same_block("Moment matrix", parsed.evaluate(0, values), expected_export_block(mm, values));
+    }
+
+    TEST(Export_SDPAExporter, ComplexMomentMatrix) {
+        AlgebraicMatrixSystem ams{std::make_unique<AlgebraicContext>(2)};
+        const auto [id, mm] = ams.MomentMatrix.create(1);
+        ASSERT_EQ(mm.Dimension(), 3);
+        ASSERT_TRUE(mm.HasComplexBasis());
+
+        SDPAExporter exporter{ams};
+        const auto parsed = parse_sdpa(export_to_string(exporter, {static_cast<ptrdiff_t>(id)}));
+        EXPECT_EQ(parsed.variables, 6); // a, b, aa, ab, bb; and Im(ab).
+        ASSERT_EQ(parsed.block_sizes, std::vector<size_t>{6});
+
+        const auto values = export_test_values(parsed.variables);
+        assert_same_block("Moment matrix", parsed.evaluate(0, values), expected_export_block(mm, values));
+    }
+
+    TEST(Export_SDPAExporter, PolynomialLocalizingMatrix) {
+        AlgebraicMatrixSystem ams{std::make_unique<AlgebraicContext>(2)};
+        const auto& context = ams.Context();
+        const auto& symbols = ams.Symbols();
+        const auto [mm_id, mm] = ams.MomentMatrix.create(1);
+        const auto s_a = symbols.where(OperatorSequence({0}, context))->Id();
+        const auto s_b = symbols.where(OperatorSequence({1}, context))->Id();
+
+        const auto& factory = ams.polynomial_factory();
+        const auto [plm_id, plm] = ams.PolynomialLocalizingMatrix.create(
+                PolynomialLocalizingMatrixIndex{1, factory({Monomial{s_a, -2.0}, Monomial{s_b, 1.0}})});
+        ASSERT_TRUE(plm.is_polynomial());
+
+        SDPAExporter exporter{ams};
+        const auto parsed = parse_sdpa(export_to_string(exporter, {static_cast<ptrdiff_t>(mm_id),
+                                                                   static_cast<ptrdiff_t>(plm_id)}));
+        EXPECT_EQ(parsed.variables, exporter.variable_count());
+        ASSERT_EQ(parsed.block_sizes.size(), 2);
+        EXPECT_EQ(parsed.block_sizes[0], SolverExporter::block_dimension(mm));
+        EXPECT_EQ(parsed.block_sizes[1], SolverExporter::block_dimension(plm));
+
+        const auto values = export_test_values(parsed.variables);
+        assert_same_block("Moment matrix", parsed.evaluate(0, values), expected_export_block(mm, values));
+        assert_same_block("Localizing matrix", parsed.evaluate(1, values), expected_export_block(plm, values));
+    }
+
+    TEST(Export_SDPAExporter, Objective) {
+        AlgebraicMatrixSystem ams{std::make_unique<AlgebraicContext>(2)};
+        const auto& context = ams.Context();
+        const auto& symbols = ams.Symbols();
+        const auto [id, mm] = ams.MomentMatrix.create(1);
+        const auto& s_a = *symbols.where(OperatorSequence({0}, context));
+        const auto& s_ab = *symbols.where(OperatorSequence({0, 1}, context));
+        ASSERT_GE(s_ab.basis_key().second, 0);
+
+        // Re(5 + 2<a> + i<ab>) = 5 + 2 a - Im(<ab>).
+        const auto& factory = ams.polynomial_factory();
+        const auto objective = factory({Monomial{1, 5.0}, Monomial{s_a.Id(), 2.0},
+                                        Monomial{s_ab.Id(), std::complex{0.0, 1.0}}});
+
+        SDPAExporter exporter{ams};
+        const auto parsed = parse_sdpa(export_to_string(exporter, {static_cast<ptrdiff_t>(id)}, objective));
+        ASSERT_EQ(parsed.objective.size(), 6);
+        std::vector<double> expected(6, 0.0);
+        expected[static_cast<size_t>(s_a.basis_key().first) - 1] = 2.0;
+        expected[symbols.Basis.RealSymbolCount() - 1 + static_cast<size_t>(s_ab.basis_key().second)] = -1.0;
+        EXPECT_EQ(parsed.objective, expected);
+        EXPECT_EQ(exporter.objective_coefficients(objective), expected);
+    }
+
+    TEST(Export_SDPAExporter, ParallelMatchesSerial) {
+        AlgebraicMatrixSystem ams{std::make_unique<AlgebraicContext>(3)};
+        const auto& context = ams.Context();
+        std::vector<ptrdiff_t> indices;
+        for (size_t level = 1; level <= 2; ++level) {
+            indices.emplace_back(static_cast<ptrdiff_t>(ams.MomentMatrix.create(level).first));
+        }
+        for (oper_name_t op = 0; op < 3; ++op) {
+            indices.emplace_back(static_cast<ptrdiff_t>(
+                    ams.LocalizingMatrix.create(LocalizingMatrixIndex{1, OperatorSequence{{op}, context}}).first));
+        }
+
+        SDPAExporter serial{ams, Multithreading::MultiThreadPolicy::Never};
+        serial.buffer_capacity = 16;
+        SDPAExporter parallel{ams, Multithreading::MultiThreadPolicy::Always};
+        const auto serial_text = export_to_string(serial, indices);
+        EXPECT_EQ(export_to_string(parallel, indices), serial_text);
+
+        const auto parsed = parse_sdpa(serial_text);
+        ASSERT_EQ(parsed.block_sizes.size(), indices.size());
+        const auto values = export_test_values(parsed.variables);
+        for (size_t block = 0; block < indices.size(); ++block) {
+            assert_same_block("Block " + std::to_string(block), parsed.evaluate(block, values),
+                              expected_export_block(ams[indices[block]], values));
+        }
+    }
+
+    TEST(Export_SDPAExporter, ParallelFormatError) {
+        class FormattingExporter : public SDPAExporter {
+        public:
+            using SDPAExporter::SDPAExporter;
+            using SolverExporter::format_blocks;
+        };
+
+        AlgebraicMatrixSystem ams{std::make_unique<AlgebraicContext>(2)};
+        const auto& mm = ams.MomentMatrix(1);
+        const std::vector<const SymbolicMatrix*> blocks(8, &mm);
+
+        FormattingExporter exporter{ams, Multithreading::MultiThreadPolicy::Always};
+        std::vector<size_t> sunk;
+        auto formatter = [](const size_t block_index, const SymbolicMatrix&) -> std::string {
+            if (block_index == 5) {
+                throw std::runtime_error{"Bad block"};
+            }
+            return std::to_string(block_index);
+        };
+        auto sink = [&sunk](const size_t block_index, std::string&& text) {
+            EXPECT_EQ(text, std::to_string(block_index));
+            sunk.emplace_back(block_index);
+        };
+
+        // Worker exception propagates to caller, and nothing at or after the failing block is passed on
+        EXPECT_THROW(exporter.format_blocks(blocks, formatter, sink), std::runtime_error);
+        ASSERT_LE(sunk.size(), 5);
+        for (size_t index = 0; index < sunk.size(); ++index) {
+            EXPECT_EQ(sunk[index], index);
+        }
+    }
+
+    TEST(Export_SDPAExporter, WriteFile) {
+        AlgebraicMatrixSystem ams{std::make_unique<AlgebraicContext>(2)};
+        const auto [id, mm] = ams.MomentMatrix.create(2);
+        const std::vector<ptrdiff_t> indices{static_cast<ptrdiff_t>(id)};
+
+        SDPAExporter exporter{ams};
+        const auto path = std::filesystem::temp_directory_path() / "moment_sdpa_exporter_test.dat-s";
+        exporter.write_file(path, indices);
+
+        std::ifstream file{path};
+        ASSERT_TRUE(file);
+        std::stringstream file_contents;
+        file_contents << file.rdbuf();
+        file.close();
+        std::filesystem::remove(path);
+
+        EXPECT_EQ(file_contents.str(), export_to_string(exporter, indices));
+    }
+
+    TEST(Export_SDPAExporter, BadMatrices) {
+        AlgebraicMatrixSystem ams{std::make_unique<AlgebraicContext>(2)};
+        const auto& context = ams.Context();
+        [[maybe_unused]] const auto [mm_id, mm] = ams.MomentMatrix.create(1);
+        const auto [lm_id, lm] = ams.LocalizingMatrix.create(LocalizingMatrixIndex{1, OperatorSequence{{0, 1}, context}});
+        ASSERT_FALSE(lm.Hermitian());
+
+        SDPAExporter exporter{ams};
+        std::stringstream ss;
+        EXPECT_THROW(exporter.write(ss, std::vector<ptrdiff_t>{static_cast<ptrdiff_t>(lm_id)}), Moment::errors::bad_export);
+        EXPECT_THROW(exporter.write(ss, std::vector<ptrdiff_t>{5}), Moment::errors::missing_component);
+    }
+}
@@ -0,0 +1,162 @@
+/**
+ * instrumentation_tests.cpp
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+
+#include "gtest/gtest.h"
+
+#include "instrumentation/instrumentation.h"
+
+#include "matrix/operator_matrix/moment_matrix.h"
+#include "scenarios/algebraic/algebraic_context.h"
+#include "scenarios/algebraic/algebraic_matrix_system.h"
+
+#include <chrono>
+#include <sstream>
+#include <string>
+
+namespace Moment::Tests {
+    using namespace Moment::Instrumentation;
+
+    namespace {
+        size_t occurrences(const std::string& haystack, const std::string& needle) {
+            size_t count = 0;
+            for (auto pos = haystack.find(needle); pos != std::string::npos; pos = haystack.find(needle, pos + 1)) {
+                ++count;
+            }
+            return count;
+        }
+    }
+
+    TEST(Instrumentation, Recorder_Empty) {
+        Recorder recorder;
+        for (size_t phase_index = 0; phase_index < phase_count; ++phase_index) {
+            const auto summary = recorder.summary(static_cast<Phase>(phase_index));
+            EXPECT_EQ(summary.calls, 0);
+            EXPECT_EQ(summary.total.count(), 0);
+        }
+        for (size_t counter_index = 0; counter_index < counter_count; ++counter_index) {
+            EXPECT_EQ(recorder.count(static_cast<Counter>(counter_index)), 0);
+        }
+        EXPECT_TRUE(recorder.events().empty());
+        EXPECT_EQ(recorder.dropped_events(), 0);
+    }
+
+    TEST(Instrumentation, Recorder_RecordAndCount) {
+        using namespace std::chrono_literals;
+        Recorder recorder;
+        const auto start = Recorder::clock_t::now();
+        recorder.record(Phase::OSMGeneration, start, start + 3ms);
+        recorder.record(Phase::OSMGeneration, start + 5ms, start + 6ms);
+        recorder.record(Phase::SymbolMerge, start, start + 2us);
+        recorder.add(Counter::OSMElements, 16);
+        recorder.add(Counter::OSMElements);
+        recorder.add(Counter::SymbolsAdded, 5);
+
+        const auto osm = recorder.summary(Phase::OSMGeneration);
+        EXPECT_EQ(osm.calls, 2);
+        EXPECT_EQ(osm.total, 4ms);
+        const auto merge = recorder.summary(Phase::SymbolMerge);
+        EXPECT_EQ(merge.calls, 1);
+        EXPECT_EQ(merge.total, 2us);
+        EXPECT_EQ(recorder.summary(Phase::BasisCreation).calls, 0);
+
+        EXPECT_EQ(recorder.count(Counter::OSMElements), 17);
+        EXPECT_EQ(recorder.count(Counter::SymbolsAdded), 5);
+        EXPECT_EQ(recorder.count(Counter::RulesAdded), 0);
+
+        const auto events = recorder.events();
+        ASSERT_EQ(events.size(), 3);
+        EXPECT_EQ(events[0].phase, Phase::OSMGeneration);
+        EXPECT_EQ(events[0].duration, 3ms);
+        EXPECT_EQ(events[1].start - events[0].start, 5ms);
+        EXPECT_EQ(events[2].phase, Phase::SymbolMerge);
+        EXPECT_EQ(events[0].thread, events[2].thread);
+
+        recorder.reset();
+        EXPECT_EQ(recorder.summary(Phase::OSMGeneration).calls, 0);
+        EXPECT_EQ(recorder.count(Counter::OSMElements), 0);
+        EXPECT_TRUE(recorder.events().empty());
+    }
+
+    TEST(Instrumentation, Recorder_EventLimit) {
+        using namespace std::chrono_literals;
+        Recorder recorder{2};
+        const auto start = Recorder::clock_t::now();
+        for (size_t i = 0; i < 5; ++i) {
+            recorder.record(Phase::BasisCreation, start, start + 1us);
+        }
+        EXPECT_EQ(recorder.events().size(), 2);
+        EXPECT_EQ(recorder.dropped_events(), 3);
+
+        // Summary is unaffected by the event limit
+        const auto summary = recorder.summary(Phase::BasisCreation);
+        EXPECT_EQ(summary.calls, 5);
+        EXPECT_EQ(summary.total, 5us);
+
+        std::stringstream ss;
+        recorder.write_chrome_trace(ss);
+        EXPECT_NE(ss.str().find("\"droppedEvents\":3"), std::string::npos) << ss.str();
+    }
+
+    TEST(Instrumentation, ChromeTrace) {
+        using namespace std::chrono_literals;
+        Recorder recorder;
+        const auto start = Recorder::clock_t::now();
+        recorder.record(Phase::OSGGeneration, start, start + 1500ns);
+        recorder.record(Phase::RulebookCompletion, start + 2us, start + 4us);
+        recorder.add(Counter::RulesAdded, 7);
+
+        std::stringstream ss;
+        recorder.write_chrome_trace(ss);
+        const auto trace = ss.str();
+
+        EXPECT_EQ(trace.rfind("{\"traceEvents\":[", 0), 0) << trace;
+        EXPECT_EQ(occurrences(trace, "\"ph\":\"X\""), 2) << trace;
+        EXPECT_EQ(occurrences(trace, "\"ph\":\"C\""), 1) << trace;
+        EXPECT_NE(trace.find("\"name\":\"OSG generation\""), std::string::npos) << trace;
+        EXPECT_NE(trace.find("\"name\":\"Rulebook completion\""), std::string::npos) << trace;
+        EXPECT_NE(trace.find("\"dur\":1.500"), std::string::npos) << trace;
+        EXPECT_NE(trace.find("\"dur\":2.000"), std::string::npos) << trace;
+        EXPECT_NE(trace.find("\"Rules added\":7"), std::string::npos) << trace;
+
+        // Braces and brackets balance
+        EXPECT_EQ(occurrences(trace, "{"), occurrences(trace, "}")) << trace;
+        EXPECT_EQ(occurrences(trace, "["), occurrences(trace, "]")) << trace;
+    }
+
+    TEST(Instrumentation, SummaryTable) {
+        Recorder recorder;
+        recorder.add(Counter::OSGWords, 42);
+        std::stringstream ss;
+        ss << recorder;
+        const auto table = ss.str();
+        for (size_t phase_index = 0; phase_index < phase_count; ++phase_index) {
+            EXPECT_NE(table.find(phase_name(static_cast<Phase>(phase_index))), std::string::npos) << table;
+        }
+        EXPECT_NE(table.find("42"), std::string::npos) << table;
+    }
+
+    TEST(Instrumentation, Hooks_MomentMatrix) {
+        if constexpr (!enabled) {
+            GTEST_SKIP() << "Library built without MOMENT_INSTRUMENTATION.";
+        }
+
+        Algebraic::AlgebraicMatrixSystem ams{std::make_unique<Algebraic::AlgebraicContext>(2)};
+        const auto& recorder = ams.instrumentation();
+        [[maybe_unused]] const auto& mm = ams.MomentMatrix(2);
+
+        EXPECT_GE(recorder.summary(Phase::OSGGeneration).calls, 1);
+        EXPECT_GE(recorder.summary(Phase::OSMGeneration).calls, 1);
+        EXPECT_GE(recorder.summary(Phase::SymbolIdentification).calls, 1);
+        EXPECT_GE(recorder.summary(Phase::SymbolMerge).calls, 1);
+        EXPECT_GE(recorder.count(Counter::OSMElements), 49);
+        EXPECT_EQ(recorder.count(Counter::SymbolsAdded) + 2, ams.Symbols().size());
+
+        const auto basis_calls = recorder.summary(Phase::BasisCreation).calls;
+        [[maybe_unused]] const auto& basis = mm.Basis.Dense();
+        EXPECT_EQ(recorder.summary(Phase::BasisCreation).calls, basis_calls + 1);
+    }
+}
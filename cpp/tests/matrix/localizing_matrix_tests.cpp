@@ -14,6 +14,9 @@
 
 #include "compare_os_matrix.h"
 
+#include <array>
+#include <vector>
+
 namespace Moment::Tests {
     TEST(Matrix_LocalizingMatrix, OpSeq_OneElem) {
         MatrixSystem system{std::make_unique<Context>(1)}; //One symbol
@@ -118,4 +121,87 @@ namespace Moment::Tests {
                                              OperatorSequence({op1, op1, op1}, context)});
 
     }
-}
\ No newline at end of file
+
+    namespace {
+        void test_create_batch(const Multithreading::MultiThreadPolicy mt_policy) {
+            MatrixSystem system{std::make_unique<Context>(2)};
+            MatrixSystem serial_system{std::make_unique<Context>(2)};
+            const auto& context = system.Context();
+
+            // One matrix exists before batch
+            auto [existing_offset, existing_matrix] =
+                    system.LocalizingMatrix.create(LocalizingMatrixIndex{1, OperatorSequence{{1}, context}});
+            ASSERT_EQ(existing_offset, 0);
+
+            auto make_batch = [](const Context& batch_context) {
+                std::vector<LocalizingMatrixIndex> batch;
+                batch.emplace_back(1, OperatorSequence{{0}, batch_context});
+                batch.emplace_back(1, OperatorSequence{{1}, batch_context}); // pre-existing
+                batch.emplace_back(1, OperatorSequence{{0, 1}, batch_context});
+                batch.emplace_back(2, OperatorSequence{{0}, batch_context});
+                batch.emplace_back(1, OperatorSequence{{0}, batch_context}); // duplicate
+                batch.emplace_back(1, OperatorSequence{{1, 1}, batch_context});
+                batch.emplace_back(0, OperatorSequence{{1, 0}, batch_context});
+                return batch;
+            };
+            const auto batch = make_batch(context);
+
+            auto created = system.LocalizingMatrix.create_batch(batch, mt_policy);
+            ASSERT_EQ(created.size(), batch.size());
+            EXPECT_EQ(system.size(), 6);
+            EXPECT_EQ(created[1].first, existing_offset);
+            EXPECT_EQ(&created[1].second, &existing_matrix);
+            EXPECT_EQ(created[0].first, created[4].first);
+            for (size_t index = 0; index < batch.size(); ++index) {
+                EXPECT_EQ(system.LocalizingMatrix.find_index(batch[index]), created[index].first) << batch[index];
+                EXPECT_EQ(&system[static_cast<ptrdiff_t>(created[index].first)], &created[index].second);
+            }
+
+            // Compare with one-by-one creation (indices must belong to the serial system's own context)
+            const auto serial_batch = make_batch(serial_system.Context());
+            for (const auto& lmi : serial_batch) {
+                std::ignore = serial_system.LocalizingMatrix.create(lmi, Multithreading::MultiThreadPolicy::Never);
+            }
+            EXPECT_EQ(system.Symbols().size(), serial_system.Symbols().size());
+            for (size_t index = 0; index < batch.size(); ++index) {
+                const auto& lmi = batch[index];
+                const auto* batch_lm = LocalizingMatrix::to_operator_matrix_ptr(system.LocalizingMatrix(lmi));
+                const auto* serial_lm = LocalizingMatrix::to_operator_matrix_ptr(
+                        serial_system.LocalizingMatrix(serial_batch[index]));
+                ASSERT_NE(batch_lm, nullptr) << lmi;
+                ASSERT_NE(serial_lm, nullptr) << lmi;
+                ASSERT_EQ(batch_lm->Dimension(), serial_lm->Dimension()) << lmi;
+                for (size_t col = 0; col < serial_lm->Dimension(); ++col) {
+                    for (size_t row = 0; row < serial_lm->Dimension(); ++row) {
+                        EXPECT_EQ((*batch_lm)(std::array<size_t, 2>{row, col}),
+                                  (*serial_lm)(std::array<size_t, 2>{row, col})) << lmi;
+                    }
+                }
+            }
+        }
+    }
+
+    TEST(Matrix_LocalizingMatrix, CreateBatch) {
+        test_create_batch(Multithreading::MultiThreadPolicy::Never);
+    }
+
+    TEST(Matrix_LocalizingMatrix, CreateBatch_Parallel) {
+        test_create_batch(Multithreading::MultiThreadPolicy::Always);
+    }
+
+    TEST(Matrix_LocalizingMatrix, CreateBatch_AllExisting) {
+        MatrixSystem system{std::make_unique<Context>(2)};
+        const auto& context = system.Context();
+        std::vector<LocalizingMatrixIndex> batch;
+        batch.emplace_back(1, OperatorSequence{{0}, context});
+        batch.emplace_back(1, OperatorSequence{{1}, context});
+        std::ignore = system.LocalizingMatrix.create_batch(batch);
+        ASSERT_EQ(system.size(), 2);
+
+        auto again = system.LocalizingMatrix.create_batch(batch);
+        ASSERT_EQ(again.size(), 2);
+        EXPECT_EQ(system.size(), 2);
+        EXPECT_EQ(again[0].first, 0);
+        EXPECT_EQ(again[1].first, 1);
+    }
+}
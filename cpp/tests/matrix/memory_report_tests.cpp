@@ -0,0 +1,131 @@
+/**
+ * memory_report_tests.cpp
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+
+#include "gtest/gtest.h"
+
+#include "matrix_system/memory_report.h"
+
+#include "matrix/monomial_matrix.h"
+#include "matrix/operator_matrix/moment_matrix.h"
+#include "scenarios/algebraic/algebraic_context.h"
+#include "scenarios/algebraic/algebraic_matrix_system.h"
+#include "symbolic/polynomial_factory.h"
+#include "symbolic/rules/moment_rulebook.h"
+#include "symbolic/symbol_table.h"
+
+#include <sstream>
+
+namespace Moment::Tests {
+    using namespace Moment::Algebraic;
+
+    TEST(Matrix_MemoryReport, EmptySystem) {
+        AlgebraicMatrixSystem ams{std::make_unique<AlgebraicContext>(2)};
+        const auto report = ams.memory_report();
+
+        EXPECT_TRUE(report.matrices.empty());
+        EXPECT_EQ(report.component(MemoryComponent::OperatorMatrices), 0);
+        EXPECT_EQ(report.component(MemoryComponent::SymbolData), 0);
+        EXPECT_EQ(report.component(MemoryComponent::Bases), 0);
+        EXPECT_GT(report.dictionary, 0);
+        EXPECT_GT(report.symbol_table, 0);
+        EXPECT_EQ(report.total(), report.dictionary + report.symbol_table + report.rulebooks);
+    }
+
+    TEST(Matrix_MemoryReport, MomentMatrix) {
+        AlgebraicMatrixSystem ams{std::make_unique<AlgebraicContext>(2)};
+        const auto before = ams.memory_report();
+
+        const auto [mm_id, mm] = ams.MomentMatrix.create(2);
+        ASSERT_EQ(mm.Dimension(), 7);
+        const auto report = ams.memory_report();
+
+        ASSERT_EQ(report.matrices.size(), 1);
+        const auto& usage = report.matrices.front();
+        EXPECT_EQ(usage.index, mm_id);
+        EXPECT_EQ(usage.description, mm.Description());
+        EXPECT_GE(usage.operator_matrices, 49 * sizeof(OperatorSequence));
+        EXPECT_GE(usage.symbol_data, 49 * sizeof(Monomial));
+        EXPECT_EQ(usage.bases, 0);
+
+        EXPECT_EQ(report.component(MemoryComponent::OperatorMatrices), usage.operator_matrices);
+        EXPECT_EQ(report.component(MemoryComponent::SymbolData), usage.symbol_data);
+        EXPECT_GT(report.dictionary, before.dictionary);
+        EXPECT_GT(report.symbol_table, before.symbol_table);
+        EXPECT_EQ(report.total(), usage.total() + report.dictionary + report.symbol_table + report.rulebooks);
+    }
+
+    TEST(Matrix_MemoryReport, DropBases) {
+        AlgebraicMatrixSystem ams{std::make_unique<AlgebraicContext>(2)};
+        const auto [mm_id, mm] = ams.MomentMatrix.create(1);
+
+        const auto ref_sparse = mm.Basis.Sparse().first;
+        const auto ref_dense = mm.Basis.Dense().first;
+        ASSERT_GT(ref_dense.size(), 1);
+        const auto with_bases = ams.memory_report();
+        ASSERT_EQ(with_bases.matrices.size(), 1);
+        const size_t basis_bytes = with_bases.matrices.front().bases;
+        EXPECT_GE(basis_bytes, 9 * sizeof(double));
+        EXPECT_EQ(with_bases.component(MemoryComponent::Bases), basis_bytes);
+
+        // Non-regenerable components release nothing
+        EXPECT_EQ(ams.drop_caches(MemoryComponent::SymbolTable), 0);
+        EXPECT_EQ(ams.memory_report().symbol_table, with_bases.symbol_table);
+
+        EXPECT_EQ(ams.drop_caches(MemoryComponent::Bases), basis_bytes);
+        const auto without_bases = ams.memory_report();
+        EXPECT_EQ(without_bases.matrices.front().bases, 0);
+        EXPECT_EQ(without_bases.matrices.front().symbol_data, with_bases.matrices.front().symbol_data);
+        EXPECT_FALSE(mm.Basis.Dense.is_done());
+        EXPECT_FALSE(mm.Basis.Sparse.is_done());
+
+        // Bases are recreated on demand
+        const auto& [re_dense, im_dense] = mm.Basis.Dense();
+        ASSERT_EQ(re_dense.size(), ref_dense.size());
+        for (size_t index = 0; index < ref_dense.size(); ++index) {
+            EXPECT_TRUE(re_dense[index].isApprox(ref_dense[index])) << index;
+        }
+        const auto& [re_sparse, im_sparse] = mm.Basis.Sparse();
+        ASSERT_EQ(re_sparse.size(), ref_sparse.size());
+        for (size_t index = 0; index < ref_sparse.size(); ++index) {
+            EXPECT_TRUE(re_sparse[index].isApprox(ref_sparse[index])) << index;
+        }
+        EXPECT_EQ(ams.memory_report().matrices.front().bases, basis_bytes);
+    }
+
+    TEST(Matrix_MemoryReport, Rulebooks) {
+        AlgebraicMatrixSystem ams{std::make_unique<AlgebraicContext>(2)};
+        [[maybe_unused]] const auto& mm = ams.MomentMatrix(1);
+        const auto before = ams.memory_report();
+        EXPECT_EQ(before.rulebooks, 0);
+
+        auto rule_ptr = std::make_unique<MomentRulebook>(ams);
+        std::vector<Polynomial> raw_rule_polys;
+        raw_rule_polys.emplace_back(ams.polynomial_factory()({Monomial{2, 1.0}, Monomial{1, -0.5}}));
+        rule_ptr->add_raw_rules(std::move(raw_rule_polys));
+        rule_ptr->complete();
+        const size_t rulebook_bytes = rule_ptr->memory_footprint();
+        EXPECT_GT(rulebook_bytes, 0);
+        [[maybe_unused]] auto [rb_id, rulebook] = ams.Rulebook.add(std::move(rule_ptr));
+
+        const auto after = ams.memory_report();
+        EXPECT_GE(after.rulebooks, rulebook_bytes);
+        EXPECT_EQ(after.component(MemoryComponent::Rulebooks), after.rulebooks);
+    }
+
+    TEST(Matrix_MemoryReport, Stream) {
+        AlgebraicMatrixSystem ams{std::make_unique<AlgebraicContext>(2)};
+        [[maybe_unused]] const auto& mm = ams.MomentMatrix(1);
+        std::stringstream ss;
+        ss << ams.memory_report();
+        const auto text = ss.str();
+        for (size_t index = 0; index < memory_component_count; ++index) {
+            EXPECT_NE(text.find(memory_component_name(static_cast<MemoryComponent>(index))), std::string::npos)
+                << text;
+        }
+        EXPECT_NE(text.find(mm.Description()), std::string::npos) << text;
+    }
+}
@@ -15,11 +15,71 @@
 
 #include "scenarios/context.h"
 
+#include "scenarios/algebraic/algebraic_context.h"
+#include "scenarios/algebraic/algebraic_matrix_system.h"
+
+#include "scenarios/inflation/inflation_context.h"
+#include "scenarios/inflation/inflation_matrix_system.h"
+
 #include "scenarios/locality/locality_context.h"
 #include "scenarios/locality/locality_matrix_system.h"
 
+#include "symbolic/symbol_table.h"
+
 
 namespace Moment::Tests {
+    namespace {
+        /** Compare moment matrices of the same level, from different matrix systems. */
+        void compare_nested_moment_matrix(const MatrixSystem& nested_system, const size_t nested_offset,
+                                          const MatrixSystem& direct_system, const size_t direct_offset) {
+            const auto& nested_mm = dynamic_cast<const MonomialMatrix&>(nested_system[nested_offset]);
+            const auto& direct_mm = dynamic_cast<const MonomialMatrix&>(direct_system[direct_offset]);
+            ASSERT_EQ(nested_mm.Dimension(), direct_mm.Dimension());
+            ASSERT_TRUE(nested_mm.has_unaliased_operator_matrix());
+            ASSERT_TRUE(nested_mm.has_aliased_operator_matrix());
+            const auto& nested_ops = nested_mm.unaliased_operator_matrix();
+            const auto& direct_ops = direct_mm.unaliased_operator_matrix();
+            const auto& nested_aliased_ops = nested_mm.aliased_operator_matrix();
+            const auto& direct_aliased_ops = direct_mm.aliased_operator_matrix();
+            EXPECT_EQ(nested_ops.is_hermitian(), direct_ops.is_hermitian());
+
+            for (size_t col = 0; col < direct_mm.Dimension(); ++col) {
+                for (size_t row = 0; row < direct_mm.Dimension(); ++row) {
+                    EXPECT_EQ(nested_ops(row, col), direct_ops(row, col)) << "row = " << row << ", col = " << col;
+                    EXPECT_EQ(nested_aliased_ops(row, col), direct_aliased_ops(row, col))
+                        << "row = " << row << ", col = " << col;
+
+                    // Symbol IDs may differ between systems, but must refer to the same sequences
+                    const auto& nested_mono = nested_mm.SymbolMatrix(row, col);
+                    const auto& direct_mono = direct_mm.SymbolMatrix(row, col);
+                    EXPECT_EQ(nested_mono.factor, direct_mono.factor) << "row = " << row << ", col = " << col;
+                    EXPECT_EQ(nested_mono.conjugated, direct_mono.conjugated) << "row = " << row << ", col = " << col;
+                    EXPECT_EQ(nested_system.Symbols()[nested_mono.id].sequence(),
+                              direct_system.Symbols()[direct_mono.id].sequence())
+                        << "row = " << row << ", col = " << col;
+                }
+            }
+        }
+
+        void test_nested_reuse(std::unique_ptr<MatrixSystem> nested_system, std::unique_ptr<MatrixSystem> direct_system,
+                               const size_t lower_level, const size_t upper_level,
+                               const Multithreading::MultiThreadPolicy mt_policy) {
+            auto [lower_offset, lower_matrix] = nested_system->MomentMatrix.create(lower_level, mt_policy);
+
+            // New matrix should be prepared from lower matrix
+            const auto& lower_mm = dynamic_cast<const MonomialMatrix&>(lower_matrix);
+            auto prepared = MomentMatrix::prepare_nested_matrix(nested_system->Context(), upper_level, lower_mm,
+                                                                mt_policy);
+            EXPECT_EQ(prepared.nested_matrix, &lower_mm);
+
+            auto [upper_offset, upper_matrix] = nested_system->MomentMatrix.create(upper_level, mt_policy);
+            auto [direct_offset, direct_matrix] = direct_system->MomentMatrix.create(upper_level, mt_policy);
+            ASSERT_EQ(direct_offset, 0);
+
+            compare_nested_moment_matrix(*nested_system, upper_offset, *direct_system, direct_offset);
+        }
+    }
+
     TEST(Matrix_MomentMatrix, Empty) {
         MatrixSystem system{std::make_unique<Context>(0)}; // No parties, no symbols
         auto& context = system.Context();
@@ -608,4 +668,108 @@ namespace Moment::Tests {
 
     }
 
+
+    TEST(Matrix_MomentMatrix, NestedReuse_Generic) {
+        test_nested_reuse(std::make_unique<MatrixSystem>(std::make_unique<Context>(2)),
+                          std::make_unique<MatrixSystem>(std::make_unique<Context>(2)),
+                          1, 3, Multithreading::MultiThreadPolicy::Never);
+    }
+
+    TEST(Matrix_MomentMatrix, NestedReuse_Generic_Multithreaded) {
+        test_nested_reuse(std::make_unique<MatrixSystem>(std::make_unique<Context>(2)),
+                          std::make_unique<MatrixSystem>(std::make_unique<Context>(2)),
+                          1, 3, Multithreading::MultiThreadPolicy::Always);
+    }
+
+    TEST(Matrix_MomentMatrix, NestedReuse_Algebraic) {
+        using namespace Moment::Algebraic;
+        auto make_system = []() {
+            std::vector<OperatorRule> rules;
+            rules.emplace_back(
+                    HashedSequence{{1, 0}, ShortlexHasher{2}},
+                    HashedSequence{{0, 1}, ShortlexHasher{2}, SequenceSignType::Negative}
+            );
+            return std::make_unique<AlgebraicMatrixSystem>(
+                std::make_unique<AlgebraicContext>(AlgebraicPrecontext{2}, false, true, std::move(rules)));
+        };
+        test_nested_reuse(make_system(), make_system(), 1, 2, Multithreading::MultiThreadPolicy::Never);
+        test_nested_reuse(make_system(), make_system(), 2, 3, Multithreading::MultiThreadPolicy::Always);
+    }
+
+    TEST(Matrix_MomentMatrix, NestedReuse_Inflation) {
+        using namespace Moment::Inflation;
+        auto make_system = []() {
+            return std::make_unique<InflationMatrixSystem>(
+                std::make_unique<InflationContext>(CausalNetwork{{2, 2, 2}, {{0, 1}, {1, 2}, {0, 2}}}, 2));
+        };
+        test_nested_reuse(make_system(), make_system(), 1, 2, Multithreading::MultiThreadPolicy::Never);
+        test_nested_reuse(make_system(), make_system(), 1, 2, Multithreading::MultiThreadPolicy::Always);
+    }
+
+    TEST(Matrix_MomentMatrix, NestedReuse_SkipsDeletedLevel) {
+        MatrixSystem nested_system{std::make_unique<Context>(2)};
+        MatrixSystem direct_system{std::make_unique<Context>(2)};
+        std::ignore = nested_system.MomentMatrix.create(1);
+        auto [deleted_offset, deleted_matrix] = nested_system.MomentMatrix.create(2);
+        {
+            auto write_lock = nested_system.get_write_lock();
+            ASSERT_TRUE(nested_system.delete_matrix(write_lock, static_cast<ptrdiff_t>(deleted_offset)));
+        }
+
+        auto [offset, matrix] = nested_system.MomentMatrix.create(3);
+        auto [direct_offset, direct_matrix] = direct_system.MomentMatrix.create(3);
+        compare_nested_moment_matrix(nested_system, offset, direct_system, direct_offset);
+    }
+
+    TEST(Matrix_MomentMatrix, NestedReuse_DeletedAfterPreparation) {
+        class PreparingSystem : public MatrixSystem {
+        public:
+            using MatrixSystem::MatrixSystem;
+            using MatrixSystem::prepare_moment_matrix;
+            using MatrixSystem::register_prepared_matrix;
+        };
+
+        PreparingSystem nested_system{std::make_unique<Context>(2)};
+        MatrixSystem direct_system{std::make_unique<Context>(2)};
+        auto [lower_offset, lower_matrix] = nested_system.MomentMatrix.create(1);
+
+        PreparedMonomialMatrix prepared;
+        {
+            auto read_lock = nested_system.get_read_lock();
+            prepared = nested_system.prepare_moment_matrix(read_lock, 2, Multithreading::MultiThreadPolicy::Never);
+        }
+        ASSERT_EQ(prepared.nested_matrix, &lower_matrix);
+        EXPECT_EQ(prepared.nested_offset, lower_offset);
+
+        // Delete nested matrix, and make a replacement (which might reuse the freed address) in a new slot
+        {
+            auto write_lock = nested_system.get_write_lock();
+            ASSERT_TRUE(nested_system.delete_matrix(write_lock, lower_offset));
+        }
+        auto [other_offset, other_matrix] = nested_system.LocalizingMatrix.create(
+                LocalizingMatrixIndex{1, OperatorSequence{{0}, nested_system.Context()}});
+        ASSERT_NE(other_offset, lower_offset);
+        std::ignore = other_matrix;
+
+        std::unique_ptr<MonomialMatrix> registered;
+        {
+            auto write_lock = nested_system.get_write_lock();
+            registered = nested_system.register_prepared_matrix(write_lock, std::move(prepared),
+                                                                Multithreading::MultiThreadPolicy::Never);
+        }
+        ASSERT_TRUE(registered);
+
+        const auto& direct_mm = dynamic_cast<const MonomialMatrix&>(direct_system.MomentMatrix(2));
+        ASSERT_EQ(registered->Dimension(), direct_mm.Dimension());
+        for (size_t row = 0; row < direct_mm.Dimension(); ++row) {
+            for (size_t col = 0; col < direct_mm.Dimension(); ++col) {
+                const auto& nested_mono = registered->SymbolMatrix(row, col);
+                const auto& direct_mono = direct_mm.SymbolMatrix(row, col);
+                EXPECT_EQ(nested_mono.factor, direct_mono.factor) << "row = " << row << ", col = " << col;
+                EXPECT_EQ(nested_system.Symbols()[nested_mono.id].sequence(),
+                          direct_system.Symbols()[direct_mono.id].sequence())
+                    << "row = " << row << ", col = " << col;
+            }
+        }
+    }
 }
@@ -0,0 +1,167 @@
+/**
+ * released_operator_matrix_tests.cpp
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+
+#include "gtest/gtest.h"
+
+#include "matrix/monomial_matrix.h"
+#include "matrix/operator_matrix/localizing_matrix.h"
+#include "matrix/operator_matrix/moment_matrix.h"
+#include "matrix_system/matrix_system.h"
+
+#include "scenarios/algebraic/algebraic_context.h"
+#include "scenarios/algebraic/algebraic_matrix_system.h"
+
+#include "scenarios/pauli/pauli_context.h"
+#include "scenarios/pauli/pauli_matrix_system.h"
+
+#include "symbolic/symbol_table.h"
+
+#include <vector>
+
+namespace Moment::Tests {
+
+    namespace {
+        std::vector<OperatorSequence> copy_sequences(const OperatorMatrix& op_matrix) {
+            return std::vector<OperatorSequence>(op_matrix.begin(), op_matrix.end());
+        }
+
+        void compare_sequences(const std::string& prefix, const OperatorMatrix& op_matrix,
+                               const std::vector<OperatorSequence>& reference) {
+            ASSERT_EQ(op_matrix.ElementCount, reference.size()) << prefix;
+            size_t index = 0;
+            for (const auto& sequence : op_matrix) {
+                EXPECT_EQ(sequence, reference[index]) << prefix << ", index = " << index;
+                ++index;
+            }
+        }
+    }
+
+    TEST(Matrix_ReleasedOperatorMatrix, MomentMatrix) {
+        Algebraic::AlgebraicMatrixSystem ams{std::make_unique<Algebraic::AlgebraicContext>(2)};
+        auto [mm_id, mm] = ams.MomentMatrix.create(2);
+        ASSERT_EQ(mm.Dimension(), 7);
+        ASSERT_FALSE(mm.operator_matrices_released());
+
+        const auto reference = copy_sequences(mm.unaliased_operator_matrix());
+        const bool reference_hermitian = mm.unaliased_operator_matrix().is_hermitian();
+        const size_t op_bytes = mm.operator_matrix_bytes();
+        ASSERT_GT(op_bytes, 0);
+
+        EXPECT_EQ(mm.release_operator_matrices(), op_bytes);
+        EXPECT_TRUE(mm.operator_matrices_released());
+        EXPECT_EQ(mm.operator_matrix_bytes(), 0);
+        EXPECT_EQ(ams.memory_report().component(MemoryComponent::OperatorMatrices), 0);
+        EXPECT_TRUE(mm.has_unaliased_operator_matrix());
+        EXPECT_TRUE(mm.has_aliased_operator_matrix());
+
+        // Releasing again does nothing
+        EXPECT_EQ(mm.release_operator_matrices(), 0);
+
+        // Regenerated on demand
+        const auto& regenerated = mm.unaliased_operator_matrix();
+        EXPECT_FALSE(mm.operator_matrices_released());
+        EXPECT_EQ(mm.operator_matrix_bytes(), op_bytes);
+        compare_sequences("Regenerated", regenerated, reference);
+        EXPECT_EQ(regenerated.is_hermitian(), reference_hermitian);
+
+        const auto* mm_ptr = MomentMatrix::to_operator_matrix_ptr(mm);
+        ASSERT_NE(mm_ptr, nullptr);
+        EXPECT_EQ(mm_ptr->Index, 2);
+        EXPECT_EQ(&mm.aliased_operator_matrix(), &regenerated);
+    }
+
+    TEST(Matrix_ReleasedOperatorMatrix, LocalizingMatrix) {
+        Algebraic::AlgebraicMatrixSystem ams{std::make_unique<Algebraic::AlgebraicContext>(2)};
+        const auto& context = ams.Context();
+        const LocalizingMatrixIndex lmi{1, OperatorSequence{{1}, context}};
+        auto [lm_id, lm] = ams.LocalizingMatrix.create(lmi);
+        const auto reference = copy_sequences(lm.unaliased_operator_matrix());
+
+        EXPECT_GT(lm.release_operator_matrices(), 0);
+        EXPECT_TRUE(lm.operator_matrices_released());
+
+        lm.regenerate_operator_matrices(Multithreading::MultiThreadPolicy::Never);
+        EXPECT_FALSE(lm.operator_matrices_released());
+        compare_sequences("Regenerated", lm.unaliased_operator_matrix(), reference);
+
+        const auto* lm_ptr = LocalizingMatrix::to_operator_matrix_ptr(lm);
+        ASSERT_NE(lm_ptr, nullptr);
+        EXPECT_EQ(lm_ptr->Index.Level, 1);
+        EXPECT_EQ(lm_ptr->Index.Word, lmi.Word);
+    }
+
+    TEST(Matrix_ReleasedOperatorMatrix, Aliased) {
+        Pauli::PauliMatrixSystem system{std::make_unique<Pauli::PauliContext>(2, Pauli::WrapType::None,
+                                                                              Pauli::SymmetryType::Translational)};
+        auto [mm_id, mm] = system.MomentMatrix.create(1);
+        ASSERT_TRUE(system.Context().can_have_aliases());
+        const auto unaliased_reference = copy_sequences(mm.unaliased_operator_matrix());
+        const auto aliased_reference = copy_sequences(mm.aliased_operator_matrix());
+        ASSERT_NE(&mm.unaliased_operator_matrix(), &mm.aliased_operator_matrix());
+
+        EXPECT_GT(mm.release_operator_matrices(), 0);
+        EXPECT_TRUE(mm.has_aliased_operator_matrix());
+
+        // Requesting aliased matrix regenerates both
+        compare_sequences("Aliased", mm.aliased_operator_matrix(), aliased_reference);
+        EXPECT_FALSE(mm.operator_matrices_released());
+        compare_sequences("Unaliased", mm.unaliased_operator_matrix(), unaliased_reference);
+    }
+
+    TEST(Matrix_ReleasedOperatorMatrix, ProductNotReleasable) {
+        Algebraic::AlgebraicMatrixSystem ams{std::make_unique<Algebraic::AlgebraicContext>(2)};
+        const auto& factory = ams.polynomial_factory();
+        auto& symbols = ams.Symbols();
+        const auto& mm = dynamic_cast<const MonomialMatrix&>(ams.MomentMatrix(1));
+
+        auto product_ptr = mm.pre_multiply(Monomial{2, 1.0}, factory, symbols,
+                                           Multithreading::MultiThreadPolicy::Never);
+        ASSERT_TRUE(product_ptr);
+        ASSERT_TRUE(product_ptr->has_unaliased_operator_matrix());
+        const size_t product_bytes = product_ptr->operator_matrix_bytes();
+
+        // Product was not generated from an index, so cannot be regenerated
+        EXPECT_EQ(product_ptr->release_operator_matrices(), 0);
+        EXPECT_FALSE(product_ptr->operator_matrices_released());
+        EXPECT_EQ(product_ptr->operator_matrix_bytes(), product_bytes);
+    }
+
+    TEST(Matrix_ReleasedOperatorMatrix, SystemPolicy) {
+        Algebraic::AlgebraicMatrixSystem reference_system{std::make_unique<Algebraic::AlgebraicContext>(2)};
+        const auto& ref_mm = dynamic_cast<const MonomialMatrix&>(reference_system.MomentMatrix(1));
+        auto ref_product = ref_mm.pre_multiply(Monomial{2, 1.0}, reference_system.polynomial_factory(),
+                                               reference_system.Symbols(), Multithreading::MultiThreadPolicy::Never);
+        ASSERT_TRUE(ref_product);
+
+        Algebraic::AlgebraicMatrixSystem ams{std::make_unique<Algebraic::AlgebraicContext>(2)};
+        EXPECT_EQ(ams.operator_matrix_retention(), OperatorMatrixRetention::Keep);
+        ams.set_operator_matrix_retention(OperatorMatrixRetention::Release);
+        EXPECT_EQ(ams.operator_matrix_retention(), OperatorMatrixRetention::Release);
+
+        const auto& mm = dynamic_cast<const MonomialMatrix&>(ams.MomentMatrix(1));
+        EXPECT_TRUE(mm.operator_matrices_released());
+        EXPECT_EQ(ams.memory_report().component(MemoryComponent::OperatorMatrices), 0);
+        EXPECT_TRUE(mm.Hermitian());
+
+        // Multiplication transparently regenerates
+        auto product = mm.pre_multiply(Monomial{2, 1.0}, ams.polynomial_factory(), ams.Symbols(),
+                                       Multithreading::MultiThreadPolicy::Never);
+        ASSERT_TRUE(product);
+        EXPECT_FALSE(mm.operator_matrices_released());
+        compare_sequences("Product", product->unaliased_operator_matrix(),
+                          copy_sequences(ref_product->unaliased_operator_matrix()));
+
+        // Higher levels are still generated correctly when lower levels are released
+        EXPECT_GT(ams.drop_caches(MemoryComponent::OperatorMatrices), 0);
+        EXPECT_TRUE(mm.operator_matrices_released());
+        const auto& mm2 = ams.MomentMatrix(2);
+        EXPECT_TRUE(mm2.operator_matrices_released());
+        const auto& ref_mm2 = reference_system.MomentMatrix(2);
+        compare_sequences("Level 2", mm2.unaliased_operator_matrix(),
+                          copy_sequences(ref_mm2.unaliased_operator_matrix()));
+    }
+}
@@ -0,0 +1,149 @@
+/**
+ * concurrent_creation_tests.cpp
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+
+#include "gtest/gtest.h"
+
+#include "matrix_system/matrix_system.h"
+#include "matrix/operator_matrix/operator_matrix.h"
+#include "matrix/symbolic_matrix.h"
+#include "symbolic/symbol_table.h"
+
+#include "scenarios/algebraic/algebraic_context.h"
+#include "scenarios/algebraic/algebraic_matrix_system.h"
+
+#include "scenarios/locality/locality_context.h"
+#include "scenarios/locality/locality_matrix_system.h"
+#include "scenarios/locality/party.h"
+
+#include <array>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace Moment::Tests {
+    using namespace Moment::Algebraic;
+
+    TEST(Multithreading_ConcurrentCreation, SameMomentMatrix) {
+        AlgebraicMatrixSystem system{std::make_unique<AlgebraicContext>(3)};
+
+        const size_t thread_count = 8;
+        std::vector<ptrdiff_t> offsets(thread_count, -1);
+        std::vector<const SymbolicMatrix*> matrices(thread_count, nullptr);
+        std::vector<std::thread> threads;
+        for (size_t thread_id = 0; thread_id < thread_count; ++thread_id) {
+            threads.emplace_back([&system, &offsets, &matrices, thread_id]() {
+                auto [offset, matrix] = system.MomentMatrix.create(2, Multithreading::MultiThreadPolicy::Never);
+                offsets[thread_id] = static_cast<ptrdiff_t>(offset);
+                matrices[thread_id] = &matrix;
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        // Only one matrix should have been registered
+        EXPECT_EQ(system.size(), 1);
+        for (size_t thread_id = 0; thread_id < thread_count; ++thread_id) {
+            EXPECT_EQ(offsets[thread_id], 0) << "thread = " << thread_id;
+            EXPECT_EQ(matrices[thread_id], &system[0]) << "thread = " << thread_id;
+        }
+        EXPECT_EQ(system.MomentMatrix.find_index(2), 0);
+    }
+
+    TEST(Multithreading_ConcurrentCreation, DistinctLocalizingMatrices) {
+        AlgebraicMatrixSystem concurrent_system{std::make_unique<AlgebraicContext>(3)};
+        AlgebraicMatrixSystem serial_system{std::make_unique<AlgebraicContext>(3)};
+        auto make_indices = [](const Context& context) {
+            std::vector<LocalizingMatrixIndex> indices;
+            for (oper_name_t lhs = 0; lhs < 3; ++lhs) {
+                indices.emplace_back(1, OperatorSequence{{lhs}, context});
+                for (oper_name_t rhs = 0; rhs < 3; ++rhs) {
+                    indices.emplace_back(1, OperatorSequence{{lhs, rhs}, context});
+                }
+            }
+            return indices;
+        };
+        const auto indices = make_indices(concurrent_system.Context());
+
+        // Request every matrix, each from its own thread (and the first few twice)
+        std::vector<ptrdiff_t> offsets(indices.size() + 3, -1);
+        std::vector<std::thread> threads;
+        for (size_t request = 0; request < offsets.size(); ++request) {
+            threads.emplace_back([&concurrent_system, &indices, &offsets, request]() {
+                const auto& lmi = indices[request % indices.size()];
+                auto [offset, matrix] = concurrent_system.LocalizingMatrix.create(lmi,
+                                                                  Multithreading::MultiThreadPolicy::Never);
+                offsets[request] = static_cast<ptrdiff_t>(offset);
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        // Every index should be registered once
+        ASSERT_EQ(concurrent_system.size(), indices.size());
+        std::set<ptrdiff_t> unique_offsets(offsets.begin(), offsets.end());
+        EXPECT_EQ(unique_offsets.size(), indices.size());
+        for (size_t request = 0; request < offsets.size(); ++request) {
+            EXPECT_EQ(concurrent_system.LocalizingMatrix.find_index(indices[request % indices.size()]),
+                      offsets[request]) << "request = " << request;
+        }
+
+        // Same matrices and symbols as serial creation (indices must belong to the serial system's own context)
+        const auto serial_indices = make_indices(serial_system.Context());
+        for (const auto& lmi : serial_indices) {
+            std::ignore = serial_system.LocalizingMatrix.create(lmi, Multithreading::MultiThreadPolicy::Never);
+        }
+        EXPECT_EQ(concurrent_system.Symbols().size(), serial_system.Symbols().size());
+        for (size_t index = 0; index < indices.size(); ++index) {
+            const auto& lmi = indices[index];
+            const auto& concurrent_matrix = concurrent_system.LocalizingMatrix(lmi);
+            const auto& serial_matrix = serial_system.LocalizingMatrix(serial_indices[index]);
+            ASSERT_EQ(concurrent_matrix.Dimension(), serial_matrix.Dimension()) << lmi;
+            ASSERT_TRUE(concurrent_matrix.has_unaliased_operator_matrix()) << lmi;
+            ASSERT_TRUE(serial_matrix.has_unaliased_operator_matrix()) << lmi;
+            const auto& concurrent_ops = concurrent_matrix.unaliased_operator_matrix();
+            const auto& serial_ops = serial_matrix.unaliased_operator_matrix();
+            for (size_t col = 0; col < serial_matrix.Dimension(); ++col) {
+                for (size_t row = 0; row < serial_matrix.Dimension(); ++row) {
+                    EXPECT_EQ(concurrent_ops(std::array<size_t, 2>{row, col}),
+                              serial_ops(std::array<size_t, 2>{row, col})) << lmi;
+                }
+            }
+        }
+    }
+
+    TEST(Multithreading_ConcurrentCreation, LocalityMixedRequests) {
+        using namespace Moment::Locality;
+        LocalityMatrixSystem system{std::make_unique<LocalityContext>(Party::MakeList(2, 2, 2))};
+        const auto& context = system.localityContext;
+
+        std::vector<std::thread> threads;
+        threads.emplace_back([&system]() {
+            std::ignore = system.MomentMatrix.create(2, Multithreading::MultiThreadPolicy::Never);
+        });
+        for (oper_name_t op = 0; op < static_cast<oper_name_t>(context.size()); ++op) {
+            threads.emplace_back([&system, &context, op]() {
+                std::ignore = system.LocalizingMatrix.create(LocalizingMatrixIndex{1, OperatorSequence{{op}, context}},
+                                                             Multithreading::MultiThreadPolicy::Never);
+            });
+        }
+        threads.emplace_back([&system]() {
+            std::ignore = system.MomentMatrix.create(2, Multithreading::MultiThreadPolicy::Never);
+        });
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        EXPECT_EQ(system.size(), 1 + context.size());
+
+        // Every symbol that appears in level 2 moment matrix is registered
+        LocalityMatrixSystem reference{std::make_unique<LocalityContext>(Party::MakeList(2, 2, 2))};
+        std::ignore = reference.MomentMatrix.create(2, Multithreading::MultiThreadPolicy::Never);
+        EXPECT_EQ(system.Symbols().size(), reference.Symbols().size());
+    }
+}
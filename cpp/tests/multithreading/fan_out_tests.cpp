@@ -0,0 +1,39 @@
+/**
+ * fan_out_tests.cpp
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+
+#include "gtest/gtest.h"
+
+#include "multithreading/fan_out.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+namespace Moment::Tests {
+    using namespace Moment::Multithreading;
+
+    TEST(Multithreading_FanOut, EveryWorkerRuns) {
+        std::vector<size_t> results(4, 0);
+        fan_out(results.size(), [&results](const size_t worker_id) {
+            results[worker_id] = worker_id + 1;
+        });
+        EXPECT_EQ(results, (std::vector<size_t>{1, 2, 3, 4}));
+    }
+
+    TEST(Multithreading_FanOut, WorkerExceptionRethrown) {
+        std::atomic<size_t> finished{0};
+        EXPECT_THROW(fan_out(4, [&finished](const size_t worker_id) {
+            if (worker_id == 2) {
+                throw std::runtime_error{"Worker failed"};
+            }
+            ++finished;
+        }), std::runtime_error);
+
+        // Other workers still ran to completion before the exception was propagated
+        EXPECT_EQ(finished, 3);
+    }
+}
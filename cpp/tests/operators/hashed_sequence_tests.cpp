@@ -9,6 +9,9 @@
 #include "hashed_sequence.h"
 #include "shortlex_hasher.h"
 
+#include <cmath>
+#include <limits>
+
 namespace Moment::Tests {
 
     namespace {
@@ -131,4 +134,61 @@ namespace Moment::Tests {
         EXPECT_EQ(suffix_prefix(seqB, seqA), 2);
     }
 
+    TEST(Operators_HashedSequence, Hasher_RadixPower) {
+        ShortlexHasher hasher{3};
+        hash_t expected = 1;
+        for (size_t power = 0; power < 80; ++power) {
+            EXPECT_EQ(hasher.radix_power(power), expected) << "Power = " << power;
+            expected *= 3;
+        }
+    }
+
+    TEST(Operators_HashedSequence, Hasher_Concatenate) {
+        ShortlexHasher hasher{5};
+        const sequence_storage_t lhs{3, 1, 4};
+        const sequence_storage_t rhs{0, 2};
+        const sequence_storage_t joined{3, 1, 4, 0, 2};
+        EXPECT_EQ(hasher.concatenate(hasher(lhs), hasher(rhs), rhs.size()), hasher(joined));
+        EXPECT_EQ(hasher.concatenate(hasher(lhs), hasher({}), 0), hasher(lhs));
+        EXPECT_EQ(hasher.concatenate(hasher({}), hasher(rhs), rhs.size()), hasher(rhs));
+    }
+
+    TEST(Operators_HashedSequence, Concatenate) {
+        ShortlexHasher hasher{5};
+        HashedSequence lhs{{3, 1}, hasher, SequenceSignType::Imaginary};
+        HashedSequence rhs{{4, 0, 2}, hasher, SequenceSignType::Negative};
+
+        const auto joined = HashedSequence::concatenate(lhs, rhs, hasher);
+        const HashedSequence expected{{3, 1, 4, 0, 2}, hasher, SequenceSignType::NegativeImaginary};
+        EXPECT_EQ(joined, expected);
+        EXPECT_EQ(joined.raw(), expected.raw());
+
+        const auto with_zero = HashedSequence::concatenate(lhs, HashedSequence{true}, hasher);
+        EXPECT_TRUE(with_zero.zero());
+        EXPECT_TRUE(with_zero.empty());
+    }
+
+    TEST(Operators_HashedSequence, Hasher_LongestString) {
+        ShortlexHasher hasher{300};
+        const auto expected = static_cast<size_t>(static_cast<double>(std::numeric_limits<hash_t>::digits)
+                                                  / std::log2(300.0));
+        EXPECT_EQ(hasher.longest_hashable_string(), expected);
+
+        // Longest hashable strings are distinct
+        sequence_storage_t lhs(hasher.longest_hashable_string(), 299);
+        sequence_storage_t rhs(hasher.longest_hashable_string(), 299);
+        rhs[0] = 298;
+        EXPECT_GT(hasher(lhs), hasher(rhs));
+    }
+
+    TEST(Operators_HashedSequence, HashToString) {
+        EXPECT_EQ(hash_to_string(0), "0");
+        EXPECT_EQ(hash_to_string(1), "1");
+        EXPECT_EQ(hash_to_string(18446744073709551615ULL), "18446744073709551615");
+        if constexpr (sizeof(hash_t) > sizeof(uint64_t)) {
+            const hash_t big = static_cast<hash_t>(18446744073709551615ULL) + 1;
+            EXPECT_EQ(hash_to_string(big), "18446744073709551616");
+        }
+    }
+
 }
@@ -320,4 +320,23 @@ namespace Moment::Tests {
         OperatorSequence not_herm_B{{0, 1, 1}, context, SequenceSignType::Imaginary};
         EXPECT_EQ(not_herm_B.hermitian_type(), HermitianType::NotHermitian);
     }
+
+    TEST(Operators_OperatorSequence, Multiply_ContextsOptInToComposedHash) {
+        // Generic contexts do not assume concatenation is canonical
+        Context context{2};
+        OperatorSequence lhs{{0}, context};
+        OperatorSequence rhs{{1}, context};
+        EXPECT_FALSE(context.is_canonical_concatenation(lhs, rhs));
+
+        const auto product = context.multiply(lhs, rhs);
+        const OperatorSequence expected{{0, 1}, context};
+        EXPECT_EQ(product, expected);
+        EXPECT_EQ(product.hash(), expected.hash());
+
+        // Free algebra opts in
+        Algebraic::AlgebraicContext free_context{2};
+        OperatorSequence free_lhs{{0}, free_context};
+        OperatorSequence free_rhs{{1}, free_context};
+        EXPECT_TRUE(free_context.is_canonical_concatenation(free_lhs, free_rhs));
+    }
 }
@@ -0,0 +1,113 @@
+/**
+ * commutative_osg_tests.cpp
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+
+#include "gtest/gtest.h"
+
+#include "dictionary/operator_sequence.h"
+#include "dictionary/operator_sequence_generator.h"
+
+#include "matrix/operator_matrix/moment_matrix.h"
+
+#include "scenarios/algebraic/algebraic_context.h"
+#include "scenarios/algebraic/algebraic_matrix_system.h"
+#include "scenarios/algebraic/commutative_osg.h"
+
+namespace Moment::Tests {
+    using namespace Moment::Algebraic;
+
+    namespace {
+        void compare_to_rulebook(const AlgebraicPrecontext& apc, const size_t max_length) {
+            // Commutative context, with fast path
+            AlgebraicContext fast_context{apc, true, true};
+            ASSERT_TRUE(fast_context.is_pure_commutative());
+
+            // Equivalent context, using commutation rules explicitly
+            AlgebraicContext rule_context{apc, false, true, OperatorRulebook::commutator_rules(apc)};
+            ASSERT_FALSE(rule_context.is_pure_commutative());
+
+            auto fast_osg = fast_context.new_osg(max_length);
+            ASSERT_NE(dynamic_cast<const CommutativeOperatorSequenceGenerator*>(fast_osg.get()), nullptr);
+            OperatorSequenceGenerator rule_osg{rule_context, max_length};
+
+            ASSERT_EQ(fast_osg->size(), rule_osg.size());
+            for (size_t index = 0; index < rule_osg.size(); ++index) {
+                const auto& fast_seq = (*fast_osg)[index];
+                const auto& rule_seq = rule_osg[index];
+                ASSERT_EQ(fast_seq.raw(), rule_seq.raw()) << "index = " << index;
+                EXPECT_EQ(fast_seq.hash(), rule_seq.hash()) << "index = " << index;
+            }
+
+            // Multiplication
+            for (size_t lhs = 0; lhs < rule_osg.size(); ++lhs) {
+                for (size_t rhs = 0; rhs < rule_osg.size(); ++rhs) {
+                    const auto fast_product = (*fast_osg)[lhs] * (*fast_osg)[rhs];
+                    const auto rule_product = rule_osg[lhs] * rule_osg[rhs];
+                    ASSERT_EQ(fast_product.raw(), rule_product.raw()) << "lhs = " << lhs << ", rhs = " << rhs;
+                    EXPECT_EQ(fast_product.hash(), rule_product.hash()) << "lhs = " << lhs << ", rhs = " << rhs;
+                }
+            }
+        }
+    }
+
+    TEST(Scenarios_Algebraic_CommutativeOSG, CountOfLength) {
+        EXPECT_EQ(CommutativeOperatorSequenceGenerator::count_of_length(0, 0), 1);
+        EXPECT_EQ(CommutativeOperatorSequenceGenerator::count_of_length(0, 2), 0);
+        EXPECT_EQ(CommutativeOperatorSequenceGenerator::count_of_length(3, 0), 1);
+        EXPECT_EQ(CommutativeOperatorSequenceGenerator::count_of_length(3, 1), 3);
+        EXPECT_EQ(CommutativeOperatorSequenceGenerator::count_of_length(3, 2), 6);
+        EXPECT_EQ(CommutativeOperatorSequenceGenerator::count_of_length(20, 4), 8855);
+    }
+
+    TEST(Scenarios_Algebraic_CommutativeOSG, ThreeOperators) {
+        AlgebraicContext context{AlgebraicPrecontext{3}, true, true};
+        ASSERT_TRUE(context.is_pure_commutative());
+        auto osg = context.new_osg(2);
+        ASSERT_EQ(osg->size(), 10);
+        EXPECT_EQ((*osg)[0], OperatorSequence::Identity(context));
+        EXPECT_EQ((*osg)[1], OperatorSequence({0}, context));
+        EXPECT_EQ((*osg)[2], OperatorSequence({1}, context));
+        EXPECT_EQ((*osg)[3], OperatorSequence({2}, context));
+        EXPECT_EQ((*osg)[4], OperatorSequence({0, 0}, context));
+        EXPECT_EQ((*osg)[5], OperatorSequence({0, 1}, context));
+        EXPECT_EQ((*osg)[6], OperatorSequence({0, 2}, context));
+        EXPECT_EQ((*osg)[7], OperatorSequence({1, 1}, context));
+        EXPECT_EQ((*osg)[8], OperatorSequence({1, 2}, context));
+        EXPECT_EQ((*osg)[9], OperatorSequence({2, 2}, context));
+    }
+
+    TEST(Scenarios_Algebraic_CommutativeOSG, MatchesRulebook_Hermitian) {
+        compare_to_rulebook(AlgebraicPrecontext{4}, 3);
+    }
+
+    TEST(Scenarios_Algebraic_CommutativeOSG, MatchesRulebook_NonHermitian) {
+        compare_to_rulebook(AlgebraicPrecontext{2, AlgebraicPrecontext::ConjugateMode::Bunched}, 3);
+        compare_to_rulebook(AlgebraicPrecontext{2, AlgebraicPrecontext::ConjugateMode::Interleaved}, 3);
+    }
+
+    TEST(Scenarios_Algebraic_CommutativeOSG, NotPureWithRules) {
+        ShortlexHasher hasher{2};
+        std::vector<OperatorRule> msr;
+        msr.emplace_back(HashedSequence{{0, 1}, hasher}, HashedSequence{{0}, hasher}); // AB-> A
+        AlgebraicContext context{AlgebraicPrecontext{2}, true, true, msr};
+        EXPECT_FALSE(context.is_pure_commutative());
+        EXPECT_EQ(OperatorSequence({1, 0}, context), OperatorSequence({0}, context));
+    }
+
+    TEST(Scenarios_Algebraic_CommutativeOSG, TwentyVariables_MomentMatrix) {
+        AlgebraicMatrixSystem ams{std::make_unique<AlgebraicContext>(AlgebraicPrecontext{20}, true, true)};
+        const auto& mm = ams.MomentMatrix(2);
+        ASSERT_EQ(mm.Dimension(), 231); // 1 + 20 + 210
+        const auto* seqMatPtr = MomentMatrix::to_operator_matrix_ptr(mm);
+        ASSERT_NE(seqMatPtr, nullptr);
+        const auto& seqMat = *seqMatPtr;
+        EXPECT_EQ(seqMat(21, 230), OperatorSequence({0, 0, 19, 19}, ams.Context())); // a0a0 * a19a19
+        EXPECT_EQ(seqMat(230, 21), OperatorSequence({0, 0, 19, 19}, ams.Context()));
+
+        // Symbols: all sorted words of length up to 4 on 20 variables, plus zero.
+        EXPECT_EQ(ams.Symbols().size(), 1 + 1 + 20 + 210 + 1540 + 8855);
+    }
+}
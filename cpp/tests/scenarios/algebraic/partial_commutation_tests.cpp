@@ -0,0 +1,118 @@
+/**
+ * partial_commutation_tests.cpp
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+
+#include "gtest/gtest.h"
+
+#include "dictionary/multi_operator_iterator.h"
+#include "dictionary/operator_sequence.h"
+
+#include "scenarios/algebraic/algebraic_context.h"
+#include "scenarios/algebraic/partial_commutation.h"
+
+namespace Moment::Tests {
+    using namespace Moment::Algebraic;
+
+    TEST(Scenarios_Algebraic_PartialCommutation, Empty) {
+        PartialCommutation pc{3};
+        EXPECT_TRUE(pc.empty());
+        sequence_storage_t seq{2, 1, 0};
+        EXPECT_TRUE(pc.is_normal(seq));
+        EXPECT_FALSE(pc.normalize(seq));
+        EXPECT_EQ(seq, (sequence_storage_t{2, 1, 0}));
+    }
+
+    TEST(Scenarios_Algebraic_PartialCommutation, FullyCommuting_Sorts) {
+        PartialCommutation pc{3};
+        pc.set_commute(0, 1);
+        pc.set_commute(0, 2);
+        pc.set_commute(1, 2);
+        EXPECT_EQ(pc.pairs(), 3);
+
+        sequence_storage_t seq{2, 1, 0, 2, 1};
+        EXPECT_FALSE(pc.is_normal(seq));
+        EXPECT_TRUE(pc.normalize(seq));
+        EXPECT_EQ(seq, (sequence_storage_t{0, 1, 1, 2, 2}));
+        EXPECT_TRUE(pc.is_normal(seq));
+    }
+
+    TEST(Scenarios_Algebraic_PartialCommutation, LexicographicNotBubble) {
+        // a=0, b=1, d=3 commute with each other; c=2 commutes with nothing.
+        PartialCommutation pc{4};
+        pc.set_commute(0, 1);
+        pc.set_commute(0, 3);
+        pc.set_commute(1, 3);
+
+        // "d a b" -> "a b d" (b can move past a? no: a < b, so b stays after a; but d moves to the end).
+        sequence_storage_t seq{3, 0, 1};
+        EXPECT_TRUE(pc.normalize(seq));
+        EXPECT_EQ(seq, (sequence_storage_t{0, 1, 3}));
+
+        // "c d a b" -> "c a b d": nothing moves before c.
+        sequence_storage_t seq2{2, 3, 0, 1};
+        EXPECT_TRUE(pc.normalize(seq2));
+        EXPECT_EQ(seq2, (sequence_storage_t{2, 0, 1, 3}));
+
+        // "b c a" is already normal, as a cannot move past c.
+        sequence_storage_t seq3{1, 2, 0};
+        EXPECT_TRUE(pc.is_normal(seq3));
+    }
+
+    TEST(Scenarios_Algebraic_PartialCommutation, Absorb) {
+        AlgebraicPrecontext apc{3};
+        PartialCommutation pc{3};
+        EXPECT_TRUE(pc.absorb(OperatorRule{HashedSequence{{2, 0}, apc.hasher}, HashedSequence{{0, 2}, apc.hasher}}));
+        EXPECT_TRUE(pc.commute(0, 2));
+        EXPECT_TRUE(pc.commute(2, 0));
+        EXPECT_FALSE(pc.commute(0, 1));
+
+        // Anti-commutation is not absorbed
+        EXPECT_FALSE(pc.absorb(OperatorRule{HashedSequence{{1, 0}, apc.hasher},
+                                            HashedSequence{{0, 1}, apc.hasher, SequenceSignType::Negative}}));
+        // Other rules are not absorbed
+        EXPECT_FALSE(pc.absorb(OperatorRule{HashedSequence{{1, 1}, apc.hasher}, HashedSequence{{1}, apc.hasher}}));
+        EXPECT_FALSE(pc.commute(0, 1));
+        EXPECT_EQ(pc.pairs(), 1);
+    }
+
+    TEST(Scenarios_Algebraic_PartialCommutation, TwoParties_MatchesRulebook) {
+        // Party A: 0, 1; party B: 2, 3. Projective, orthogonal measurements, commuting between parties.
+        AlgebraicPrecontext apc{4};
+        std::vector<OperatorRule> rules;
+        for (oper_name_t a = 0; a < 2; ++a) {
+            for (oper_name_t b = 2; b < 4; ++b) {
+                rules.emplace_back(HashedSequence{{b, a}, apc.hasher}, HashedSequence{{a, b}, apc.hasher});
+            }
+        }
+        rules.emplace_back(HashedSequence{{0, 0}, apc.hasher}, HashedSequence{{0}, apc.hasher});
+        rules.emplace_back(HashedSequence{{1, 1}, apc.hasher}, HashedSequence{{1}, apc.hasher});
+        rules.emplace_back(HashedSequence{{2, 2}, apc.hasher}, HashedSequence{{2}, apc.hasher});
+        rules.emplace_back(HashedSequence{{0, 1}, apc.hasher}, HashedSequence{true});
+        rules.emplace_back(HashedSequence{{1, 0}, apc.hasher}, HashedSequence{true});
+
+        AlgebraicContext context{apc, false, false, rules};
+        ASSERT_TRUE(context.attempt_completion(20));
+        ASSERT_TRUE(context.uses_trace_normal_form());
+        EXPECT_EQ(context.commutation_relations().pairs(), 4);
+
+        for (size_t length = 1; length <= 5; ++length) {
+            for (MultiOperatorIterator iter{context, length}; iter; ++iter) {
+                const auto& raw = iter.raw();
+                const OperatorSequence via_trace{sequence_storage_t(raw), context};
+                const auto via_rulebook = context.rulebook().reduce(HashedSequence{sequence_storage_t(raw), apc.hasher});
+
+                ASSERT_EQ(via_trace.zero(), via_rulebook.zero()) << via_trace;
+                if (!via_trace.zero()) {
+                    EXPECT_EQ(via_trace.raw(), via_rulebook.raw()) << via_trace;
+                    EXPECT_EQ(via_trace.get_sign(), via_rulebook.get_sign()) << via_trace;
+                }
+
+                const bool canonical = context.get_if_canonical(raw).has_value();
+                EXPECT_EQ(canonical, !context.rulebook().can_reduce(raw)) << via_trace;
+            }
+        }
+    }
+}
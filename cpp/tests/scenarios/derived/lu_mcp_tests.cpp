@@ -84,4 +84,69 @@ namespace Moment::Tests {
         EXPECT_DOUBLE_EQ(y_to_x(0,0), 1.0);
         EXPECT_DOUBLE_EQ(y_to_x(0,1), 1.0);
     }
-}
\ No newline at end of file
+
+    TEST(Scenarios_Derived_luMCP, RankReducingMap_OnSparse) {
+        Eigen::SparseMatrix<double> m = make_sparse(3, {1.0, 0.0, 0.0,
+                                                        0.0, 1.0, 1.0,
+                                                        0.0, 1.0, 1.0});
+        SparseMapCore core{DynamicBitset<size_t>(3,false), m};
+
+        auto solution = core.accept(LUMapCoreProcessor{});
+        ASSERT_TRUE(solution);
+        EXPECT_FALSE(solution->trivial_solution);
+        EXPECT_TRUE(solution->sparse_solution);
+        EXPECT_EQ(solution->output_symbols, 1);
+        EXPECT_NO_THROW(core.check_solution(*solution));
+
+        const auto& x_to_y = solution->sparse_map;
+        const auto& y_to_x = solution->sparse_inv_map;
+        ASSERT_EQ(x_to_y.rows(), 2);
+        ASSERT_EQ(x_to_y.cols(), 1);
+        ASSERT_EQ(y_to_x.rows(), 1);
+        ASSERT_EQ(y_to_x.cols(), 2);
+
+        EXPECT_DOUBLE_EQ(x_to_y.coeff(0,0), 1.0);
+        EXPECT_DOUBLE_EQ(x_to_y.coeff(1,0), 1.0);
+        EXPECT_DOUBLE_EQ(y_to_x.coeff(0,0), 1.0);
+        EXPECT_DOUBLE_EQ(y_to_x.coeff(0,1), 1.0);
+    }
+
+    TEST(Scenarios_Derived_luMCP, LargeAverage_SparseMatchesDense) {
+        // Average over cyclic shifts of blocks of size 5: rank should be number of blocks.
+        const Eigen::Index block_size = 5;
+        const Eigen::Index blocks = 120;
+        const Eigen::Index size = 1 + (block_size * blocks);
+        std::vector<Eigen::Triplet<double>> triplets;
+        triplets.emplace_back(0, 0, 1.0);
+        for (Eigen::Index block = 0; block < blocks; ++block) {
+            const Eigen::Index offset = 1 + (block * block_size);
+            for (Eigen::Index row = 0; row < block_size; ++row) {
+                for (Eigen::Index col = 0; col < block_size; ++col) {
+                    triplets.emplace_back(offset + row, offset + col, 1.0 / static_cast<double>(block_size));
+                }
+            }
+        }
+        Eigen::SparseMatrix<double> m(size, size);
+        m.setFromTriplets(triplets.begin(), triplets.end());
+
+        SparseMapCore sparse_core{DynamicBitset<size_t>(size, false), m};
+        auto sparse_solution = sparse_core.accept(LUMapCoreProcessor{});
+        ASSERT_TRUE(sparse_solution);
+        EXPECT_NO_THROW(sparse_core.check_solution(*sparse_solution));
+
+        DenseMapCore dense_core{DynamicBitset<size_t>(size, false), m};
+        auto dense_solution = dense_core.accept(LUMapCoreProcessor{});
+        ASSERT_TRUE(dense_solution);
+
+        EXPECT_EQ(sparse_solution->output_symbols, blocks);
+        EXPECT_EQ(sparse_solution->output_symbols, dense_solution->output_symbols);
+
+        // Product of map and inverse map should reproduce core.
+        const Eigen::SparseMatrix<double> product = sparse_solution->sparse_map * sparse_solution->sparse_inv_map;
+        EXPECT_TRUE(Eigen::MatrixXd(product).isApprox(Eigen::MatrixXd(sparse_core.core)));
+
+        // Sparse factors should not fill in.
+        EXPECT_EQ(sparse_solution->sparse_inv_map.nonZeros(), blocks * block_size);
+        EXPECT_EQ(sparse_solution->sparse_map.nonZeros(), blocks * block_size);
+    }
+}
@@ -288,4 +288,59 @@ namespace Moment::Tests {
         EXPECT_EQ(core.core.coeff(1,1), 7.0);
     }
 
-}
\ No newline at end of file
+    TEST(Scenarios_Derived_MapCore, Large_DenseFromDense) {
+        // Large enough to trigger multithreaded identification of non-trivial parts.
+        const Eigen::Index size = 400;
+        Eigen::MatrixXd m = Eigen::MatrixXd::Zero(size, size);
+        m(0, 0) = 1.0;
+        size_t expected_nontrivial = 0;
+        for (Eigen::Index col = 1; col < size; ++col) {
+            switch (col % 3) {
+                case 0: // Constant
+                    m(0, col) = 0.5;
+                    break;
+                case 1: // Zero
+                    break;
+                case 2: // Non-trivial, with offset
+                    m(0, col) = 2.0;
+                    m(col, col) = 1.0;
+                    ++expected_nontrivial;
+                    break;
+            }
+        }
+
+        DenseMapCore core{DynamicBitset<size_t>(size, false), m};
+        EXPECT_EQ(core.nontrivial_cols.count(), expected_nontrivial);
+        EXPECT_EQ(core.nontrivial_rows.count(), expected_nontrivial);
+        ASSERT_EQ(core.constants.size(), size - 1 - expected_nontrivial);
+        for (Eigen::Index col = 1; col < size; ++col) {
+            if (col % 3 == 2) {
+                EXPECT_TRUE(core.nontrivial_cols.test(col)) << "col = " << col;
+                EXPECT_TRUE(core.nontrivial_rows.test(col)) << "col = " << col;
+            } else {
+                EXPECT_FALSE(core.nontrivial_cols.test(col)) << "col = " << col;
+                EXPECT_FALSE(core.nontrivial_rows.test(col)) << "col = " << col;
+                ASSERT_TRUE(core.constants.contains(col)) << "col = " << col;
+                EXPECT_EQ(core.constants[col], (col % 3 == 0) ? 0.5 : 0.0) << "col = " << col;
+            }
+        }
+        ASSERT_EQ(core.core.rows(), expected_nontrivial);
+        ASSERT_EQ(core.core.cols(), expected_nontrivial);
+        EXPECT_TRUE(core.core.isIdentity());
+        EXPECT_TRUE(core.core_offset.isApproxToConstant(2.0));
+    }
+
+    TEST(Scenarios_Derived_MapCore, PreferSparse) {
+        Eigen::SparseMatrix<double> small = make_sparse(3, {1.0, 0.0, 0.0,
+                                                            0.0, 1.0, 0.0,
+                                                            0.0, 0.0, 1.0});
+        EXPECT_FALSE(MapCore::prefer_sparse(small));
+
+        Eigen::SparseMatrix<double> large_sparse(1000, 1000);
+        large_sparse.setIdentity();
+        EXPECT_TRUE(MapCore::prefer_sparse(large_sparse));
+
+        Eigen::SparseMatrix<double> large_dense = Eigen::MatrixXd::Ones(1000, 1000).sparseView();
+        EXPECT_FALSE(MapCore::prefer_sparse(large_dense));
+    }
+}
@@ -9,6 +9,10 @@
 #include "scenarios/derived/derived_matrix_system.h"
 #include "scenarios/derived/symbol_table_map.h"
 #include "scenarios/derived/lu_map_core_processor.h"
+#include "scenarios/derived/map_core.h"
+
+#include "symbolic/symbol_table.h"
+#include "utilities/dynamic_bitset.h"
 
 #include <Eigen/SparseCore>
 
@@ -50,4 +54,29 @@ namespace Moment::Tests {
                                                              Derived::LUMapCoreProcessor{}, this->src_matrix);
         }
     };
+
+    class SparseCoreSTMFactory : public Derived::DerivedMatrixSystem::STMFactory {
+    public:
+        size_t max_wl;
+        Eigen::SparseMatrix<double> src_matrix;
+    public:
+        explicit SparseCoreSTMFactory(Eigen::SparseMatrix<double> input, size_t max_wl)
+            : Derived::DerivedMatrixSystem::STMFactory{}, src_matrix{std::move(input)}, max_wl{max_wl} {
+
+        }
+
+        std::unique_ptr<Derived::SymbolTableMap> operator()(SymbolTable &origin, SymbolTable &target,
+                                                      Multithreading::MultiThreadPolicy mt_policy) final {
+            origin.OSGIndex.update_if_necessary(this->max_wl);
+            DynamicBitset<size_t> conjugates{static_cast<size_t>(this->src_matrix.cols()), false};
+            for (size_t index = 0; index < conjugates.bit_size; ++index) {
+                if (origin.OSGIndex(index).second) {
+                    conjugates.set(index);
+                }
+            }
+            auto core = std::make_unique<Derived::SparseMapCore>(std::move(conjugates), this->src_matrix);
+            auto solution = core->accept(Derived::LUMapCoreProcessor{});
+            return std::make_unique<Derived::SymbolTableMap>(origin, target, std::move(core), std::move(solution));
+        }
+    };
 }
@@ -73,4 +73,33 @@ namespace Moment::Tests {
         EXPECT_EQ(stm(Polynomial({Monomial{a, 2.0}, Monomial{b, -2.0}})),
                   Polynomial());
     }
-}
\ No newline at end of file
+
+    TEST(Scenarios_Symmetry_SymbolTableMap, Algebraic2to1_SparseCore) {
+        using namespace Moment::Algebraic;
+
+        auto amsPtr = std::make_shared<AlgebraicMatrixSystem>(
+                AlgebraicContext::FromNameList({"a", "b"})
+        );
+
+        auto& ams = *amsPtr;
+        ams.generate_dictionary(1);
+
+        Eigen::SparseMatrix<double> averaging_map = make_sparse(3, {1.0, 0.0, 0.0,
+                                                                    0.0, 0.5, 0.5,
+                                                                    0.0, 0.5, 0.5});
+
+        DerivedMatrixSystem dms{amsPtr, SparseCoreSTMFactory{std::move(averaging_map), 1}};
+        ASSERT_EQ(dms.Symbols().size(),3); // 0, 1, x
+
+        const SymbolTableMap& stm = dms.map();
+        ASSERT_EQ(stm.fwd_size(), 4); // 0, 1, a, b
+        ASSERT_EQ(stm.inv_size(), 3); // 0, 1, x
+        EXPECT_TRUE(stm.is_monomial_map());
+        const symbol_name_t I = 1, a = 2, b = 3, x = 2;
+
+        EXPECT_EQ(stm.inverse(x), Polynomial({Monomial{a, 0.5}, Monomial{b, 0.5}}));
+        EXPECT_EQ(stm(I), Polynomial::Scalar(1.0)); // 1 -> 1
+        EXPECT_EQ(stm(a), Polynomial({Monomial{x, 1.0}})); // a -> x
+        EXPECT_EQ(stm(b), Polynomial({Monomial{x, 1.0}})); // b -> x
+    }
+}
@@ -65,18 +65,82 @@ namespace Moment::Tests {
 
         auto id_A = find_or_fail(symbols, OperatorSequence{{op_A}, ims.Context()});
         auto id_B = find_or_fail(symbols, OperatorSequence{{op_B}, ims.Context()});
+        auto id_C = find_or_fail(symbols, OperatorSequence{{op_C}, ims.Context()});
         auto id_AB = find_or_fail(symbols, OperatorSequence{{op_A, op_B}, ims.Context()});
         auto id_CC = find_or_fail(symbols, OperatorSequence{{op_C, op_C}, ims.Context()});
         auto id_CCC = find_or_fail(symbols, OperatorSequence{{op_C, op_C, op_C}, ims.Context()});
 
         auto suggested = suggester(base_MM);
-        // S2, S3, S6, S11, S21
-        EXPECT_EQ(suggested.size(), 5);
+        // S2, S3, S4, S6, S11, S20
+        EXPECT_EQ(suggested.size(), 6);
         EXPECT_TRUE(suggested.contains(id_A));
         EXPECT_TRUE(suggested.contains(id_B));
+        EXPECT_TRUE(suggested.contains(id_C));
         EXPECT_TRUE(suggested.contains(id_AB));
         EXPECT_TRUE(suggested.contains(id_CC));
         EXPECT_TRUE(suggested.contains(id_CCC));
 
     }
-}
\ No newline at end of file
+
+    TEST(Scenarios_Inflation_ExtensionSuggester, Triangle_CachedAndMultithreaded) {
+        InflationMatrixSystem ims{std::make_unique<InflationContext>(CausalNetwork{{2, 2, 2},
+                                                                                   {{0, 1}, {1, 2}, {0, 2}}}, 2)};
+        auto& context = ims.InflationContext();
+        auto& symbols = ims.Symbols();
+        auto& factors = ims.Factors();
+
+        const auto& base_MM = dynamic_cast<const MonomialMatrix&>(ims.MomentMatrix(1));
+
+        ExtensionSuggester st_suggester{context, symbols, factors, Multithreading::MultiThreadPolicy::Never};
+        ExtensionSuggester mt_suggester{context, symbols, factors, Multithreading::MultiThreadPolicy::Always};
+        EXPECT_EQ(st_suggester.cached_matrix_count(), 0);
+
+        const auto st_suggested = st_suggester(base_MM);
+        EXPECT_FALSE(st_suggested.empty());
+        EXPECT_EQ(st_suggester.cached_matrix_count(), 1);
+
+        const auto mt_suggested = mt_suggester(base_MM);
+        EXPECT_EQ(st_suggested, mt_suggested);
+
+        // New symbols do not invalidate cached matrix information
+        [[maybe_unused]] const auto& other_MM = ims.MomentMatrix(2);
+        const auto st_suggested_again = st_suggester(base_MM);
+        EXPECT_EQ(st_suggested, st_suggested_again);
+        EXPECT_EQ(st_suggester.cached_matrix_count(), 1);
+
+        st_suggester.forget(base_MM);
+        EXPECT_EQ(st_suggester.cached_matrix_count(), 0);
+    }
+
+    TEST(Scenarios_Inflation_ExtensionSuggester, Triangle_DeleteThenRecreate) {
+        auto make_context = []() {
+            return std::make_unique<InflationContext>(CausalNetwork{{2, 2, 2}, {{0, 1}, {1, 2}, {0, 2}}}, 2);
+        };
+        InflationMatrixSystem ims{make_context()};
+        const auto& suggester = ims.extension_suggester();
+        EXPECT_EQ(suggester.cached_matrix_count(), 0);
+
+        auto [deleted_offset, deleted_matrix] = ims.MomentMatrix.create(1);
+        const auto deleted_suggested = ims.suggest_extensions(dynamic_cast<const MonomialMatrix&>(deleted_matrix));
+        EXPECT_FALSE(deleted_suggested.empty());
+        EXPECT_EQ(suggester.cached_matrix_count(), 1);
+
+        // Deleting matrix discards cached information about it
+        {
+            auto write_lock = ims.get_write_lock();
+            ASSERT_TRUE(ims.delete_matrix(write_lock, static_cast<ptrdiff_t>(deleted_offset)));
+        }
+        EXPECT_EQ(suggester.cached_matrix_count(), 0);
+
+        // Replacement matrix (which might reuse the freed address) gets its own suggestions
+        const auto& new_MM = dynamic_cast<const MonomialMatrix&>(ims.MomentMatrix(2));
+        const auto new_suggested = ims.suggest_extensions(new_MM);
+        EXPECT_EQ(suggester.cached_matrix_count(), 1);
+
+        InflationMatrixSystem ref_ims{make_context()};
+        std::ignore = ref_ims.MomentMatrix(1);
+        const auto& ref_MM = dynamic_cast<const MonomialMatrix&>(ref_ims.MomentMatrix(2));
+        ASSERT_EQ(ref_ims.Symbols().size(), ims.Symbols().size());
+        EXPECT_EQ(new_suggested, ref_ims.suggest_extensions(ref_MM));
+    }
+}
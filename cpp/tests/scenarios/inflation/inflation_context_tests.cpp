@@ -7,8 +7,12 @@
 
 #include "gtest/gtest.h"
 
+#include "dictionary/dictionary.h"
+#include "dictionary/operator_sequence_generator.h"
 #include "scenarios/inflation/inflation_context.h"
 
+#include <array>
+
 namespace Moment::Tests {
     using namespace Moment::Inflation;
 
@@ -1033,6 +1037,31 @@ namespace Moment::Tests {
         expect_doesnt_factorize(ic, {id_b11, id_c11});
     }
 
+    TEST(Scenarios_Inflation_InflationContext, Factorize_Cached) {
+        InflationContext ic{CausalNetwork{{2, 2, 2}, {{0, 1}}}, 2};
+        const auto& cache = ic.factorization_cache();
+        ASSERT_EQ(cache.size(), 0);
+
+        const oper_name_t a0 = ic.Observables()[0].variants[0].operator_offset;
+        const oper_name_t b0 = ic.Observables()[1].variants[0].operator_offset;
+        const oper_name_t b1 = ic.Observables()[1].variants[1].operator_offset;
+        const oper_name_t c = ic.Observables()[2].variants[0].operator_offset;
+
+        OperatorSequence seq{{a0, b0, b1, c}, ic};
+        const auto factors = ic.factorize(seq);
+        ASSERT_EQ(factors.size(), 3);
+        EXPECT_EQ(factors[0], OperatorSequence({a0, b0}, ic));
+        EXPECT_EQ(factors[1], OperatorSequence({b1}, ic));
+        EXPECT_EQ(factors[2], OperatorSequence({c}, ic));
+        EXPECT_EQ(cache.size(), 1);
+        EXPECT_EQ(cache.hits(), 0);
+
+        const auto factors_again = ic.factorize(seq);
+        EXPECT_EQ(factors_again, factors);
+        EXPECT_EQ(cache.size(), 1);
+        EXPECT_EQ(cache.hits(), 1);
+    }
+
     TEST(Scenarios_Inflation_InflationContext, CanonicalMoment_Pair) {
         InflationContext ic{CausalNetwork{{3, 2}, {{0, 1}}}, 2};
         const auto& obsA = ic.Observables()[0];
@@ -1071,10 +1100,10 @@ namespace Moment::Tests {
         EXPECT_EQ(ic.canonical_moment(OperatorSequence{{a0_1, b0}, ic}), OperatorSequence({a0_1, b0}, ic));
         EXPECT_EQ(ic.canonical_moment(OperatorSequence{{a1_1, b1}, ic}), OperatorSequence({a0_1, b0}, ic));
 
-        // a0_0 a1_0, cannot further simplify (but could factor then simplify)
+        // a0_0 a1_0, cannot further simplify (but could factor then simplify); a0_1 a1_0 relabels to a0_0 a1_1
         EXPECT_EQ(ic.canonical_moment(OperatorSequence{{a0_0, a1_0}, ic}), OperatorSequence({a0_0, a1_0}, ic));
         EXPECT_EQ(ic.canonical_moment(OperatorSequence{{a0_0, a1_1}, ic}), OperatorSequence({a0_0, a1_1}, ic));
-        EXPECT_EQ(ic.canonical_moment(OperatorSequence{{a0_1, a1_0}, ic}), OperatorSequence({a0_1, a1_0}, ic));
+        EXPECT_EQ(ic.canonical_moment(OperatorSequence{{a0_1, a1_0}, ic}), OperatorSequence({a0_0, a1_1}, ic));
         EXPECT_EQ(ic.canonical_moment(OperatorSequence{{a0_1, a1_1}, ic}), OperatorSequence({a0_1, a1_1}, ic));
 
         // a0_0 b1 -> a0_0 b1; but a1_0 b0 -> a0_0 b1 too??
@@ -1143,6 +1172,109 @@ namespace Moment::Tests {
     }
 
 
+    TEST(Scenarios_Inflation_InflationContext, CanonicalMoment_Cached) {
+        InflationContext ic{CausalNetwork{{2, 2}, {{0, 1}}}, 2};
+        const auto& cache = ic.canonical_moment_cache();
+        ASSERT_EQ(cache.size(), 0);
+
+        const oper_name_t a0 = ic.Observables()[0].variants[0].operator_offset;
+        const oper_name_t a1 = ic.Observables()[0].variants[1].operator_offset;
+        const oper_name_t b0 = ic.Observables()[1].variants[0].operator_offset;
+        const oper_name_t b1 = ic.Observables()[1].variants[1].operator_offset;
+
+        // First call calculates, and caches:
+        EXPECT_EQ(ic.canonical_moment(OperatorSequence{{a1, b1}, ic}), OperatorSequence({a0, b0}, ic));
+        EXPECT_EQ(cache.size(), 1);
+        EXPECT_EQ(cache.hits(), 0);
+
+        // Second call should be answered from cache:
+        EXPECT_EQ(ic.canonical_moment(OperatorSequence{{a1, b1}, ic}), OperatorSequence({a0, b0}, ic));
+        EXPECT_EQ(cache.size(), 1);
+        EXPECT_EQ(cache.hits(), 1);
+
+        // Already canonical sequences are also cached:
+        EXPECT_EQ(ic.canonical_moment(OperatorSequence{{a0, b1}, ic}), OperatorSequence({a0, b1}, ic));
+        EXPECT_EQ(ic.canonical_moment(OperatorSequence{{a0, b1}, ic}), OperatorSequence({a0, b1}, ic));
+        EXPECT_EQ(cache.size(), 2);
+        EXPECT_EQ(cache.hits(), 2);
+    }
+
+    TEST(Scenarios_Inflation_InflationContext, CanonicalMoment_SearchLimit) {
+        InflationContext ic{CausalNetwork{{2, 2}, {{0}, {1}}}, 8};
+        ASSERT_EQ(InflationContext::max_orbit_search_size, 40320); // 8!
+        const auto& obsA = ic.Observables()[0];
+        const auto& obsB = ic.Observables()[1];
+        ASSERT_EQ(obsA.variants.size(), 8);
+        ASSERT_EQ(obsB.variants.size(), 8);
+
+        sequence_storage_t all_a;
+        for (const auto& variant : obsA.variants) {
+            all_a.push_back(variant.operator_offset);
+        }
+        const auto b = [&](const size_t copy) { return obsB.variants[copy].operator_offset; };
+
+        // 8! * 1! relabellings: exactly at limit, so searched exhaustively
+        sequence_storage_t at_limit{all_a};
+        at_limit.push_back(b(5));
+        sequence_storage_t at_limit_canonical{all_a};
+        at_limit_canonical.push_back(b(0));
+        EXPECT_EQ(ic.canonical_moment(OperatorSequence{sequence_storage_t{at_limit}, ic}),
+                  OperatorSequence(std::move(at_limit_canonical), ic));
+
+        // 8! * 2! relabellings: over limit, so found by refinement instead
+        sequence_storage_t over_limit{all_a};
+        over_limit.push_back(b(3));
+        over_limit.push_back(b(5));
+        sequence_storage_t over_limit_canonical{all_a};
+        over_limit_canonical.push_back(b(0));
+        over_limit_canonical.push_back(b(1));
+        EXPECT_EQ(ic.canonical_moment(OperatorSequence{sequence_storage_t{over_limit}, ic}),
+                  OperatorSequence(std::move(over_limit_canonical), ic));
+    }
+
+    TEST(Scenarios_Inflation_InflationContext, CanonicalMoment_RefinedSearch) {
+        // One observable, connected to two sources: moments are bipartite graphs between copies of each source.
+        InflationContext ic{CausalNetwork{{2}, {{0}, {0}}}, 8};
+        const auto& obsA = ic.Observables()[0];
+        ASSERT_EQ(obsA.variants.size(), 64);
+        const auto a = [&](const size_t s, const size_t t) { return obsA.variants[s + (8 * t)].operator_offset; };
+
+        // 8! * 3! relabellings: over search limit
+        const std::vector<std::pair<size_t, size_t>> edges{{0, 0}, {1, 0}, {2, 0}, {3, 0}, {4, 0},
+                                                           {3, 1}, {4, 1}, {5, 1}, {6, 1}, {7, 1},
+                                                           {0, 2}, {7, 2}, {5, 2}};
+        const auto relabelled = [&](const std::array<size_t, 8>& s_perm, const std::array<size_t, 3>& t_perm) {
+            sequence_storage_t ops;
+            for (const auto& [s, t] : edges) {
+                ops.push_back(a(s_perm[s], t_perm[t]));
+            }
+            return OperatorSequence{std::move(ops), ic};
+        };
+
+        const auto canonical = ic.canonical_moment(relabelled({0, 1, 2, 3, 4, 5, 6, 7}, {0, 1, 2}));
+        ASSERT_EQ(canonical.size(), edges.size());
+        EXPECT_EQ(ic.canonical_moment(canonical), canonical);
+
+        // Every relabelling of the same graph has the same canonical moment
+        const std::vector<std::pair<std::array<size_t, 8>, std::array<size_t, 3>>> relabellings{
+                {{7, 6, 5, 4, 3, 2, 1, 0}, {0, 1, 2}},
+                {{0, 1, 2, 3, 4, 5, 6, 7}, {2, 0, 1}},
+                {{3, 0, 6, 1, 7, 2, 5, 4}, {1, 2, 0}},
+                {{5, 7, 1, 0, 2, 6, 4, 3}, {2, 1, 0}},
+                {{1, 3, 5, 7, 0, 2, 4, 6}, {1, 0, 2}}};
+        for (const auto& [s_perm, t_perm] : relabellings) {
+            const auto input = relabelled(s_perm, t_perm);
+            EXPECT_EQ(ic.canonical_moment(input), canonical) << input;
+        }
+
+        // A different graph (one edge moved) is not identified with it
+        sequence_storage_t moved;
+        for (const auto& [s, t] : edges) {
+            moved.push_back(((s == 5) && (t == 2)) ? a(3, 2) : a(s, t));
+        }
+        EXPECT_NE(ic.canonical_moment(OperatorSequence{std::move(moved), ic}), canonical);
+    }
+
     TEST(Scenarios_Inflation_InflationContext, UnflattenOutcomeIndex) {
         InflationContext ic{CausalNetwork{{3, 2}, {{0}, {0, 1}}}, 2}; // mmts: A00, A10, A01, A11, B0, B1
         ASSERT_EQ(ic.observable_variant_count(), 6);
@@ -1254,4 +1386,18 @@ namespace Moment::Tests {
         EXPECT_EQ(ic.get_if_canonical({3, 1}), std::nullopt);
     }
 
+    TEST(Scenarios_Inflation_InflationContext, Multiply_ComposedHash) {
+        InflationContext ic{CausalNetwork{{3, 2}, {{0, 1}}}, 2};
+        const auto& osg = ic.dictionary().Level(2)();
+        for (const auto& lhs : osg) {
+            for (const auto& rhs : osg) {
+                sequence_storage_t raw_product{lhs.raw()};
+                raw_product.insert(raw_product.end(), rhs.begin(), rhs.end());
+                const OperatorSequence expected{std::move(raw_product), ic};
+                const auto actual = lhs * rhs;
+                ASSERT_EQ(actual, expected) << "lhs = " << lhs << ", rhs = " << rhs;
+                EXPECT_EQ(actual.raw(), expected.raw()) << "lhs = " << lhs << ", rhs = " << rhs;
+            }
+        }
+    }
 }
@@ -6,10 +6,16 @@
 
 #include "gtest/gtest.h"
 
+#include "dictionary/dictionary.h"
 #include "dictionary/operator_sequence.h"
+#include "dictionary/operator_sequence_generator.h"
 #include "scenarios/locality/locality_context.h"
 
+#include <algorithm>
 #include <optional>
+#include <random>
+#include <stdexcept>
+#include <vector>
 
 namespace Moment::Tests {
     using namespace Moment::Locality;
@@ -241,4 +247,74 @@ namespace Moment::Tests {
         const std::vector<size_t> expected{0, 1, 2, 3};
         EXPECT_EQ(context.PM_to_global_index(trial), expected);
     }
+    TEST(Scenarios_Locality_LocalityContext, Simplify_Kernel) {
+        // Three parties, two measurements, three outcomes: party = op / 4, global measurement = op / 2
+        LocalityContext context(Party::MakeList(3, 2, 3));
+        ASSERT_EQ(context.size(), 12);
+
+        // Reference: stable sort by party, remove repeats, look for exclusive neighbours.
+        auto reference = [](std::vector<oper_name_t> ops) -> std::optional<std::vector<oper_name_t>> {
+            std::stable_sort(ops.begin(), ops.end(), [](oper_name_t lhs, oper_name_t rhs) {
+                return (lhs / 4) < (rhs / 4);
+            });
+            ops.erase(std::unique(ops.begin(), ops.end()), ops.end());
+            for (size_t index = 1; index < ops.size(); ++index) {
+                if ((ops[index-1] / 2) == (ops[index] / 2)) {
+                    return std::nullopt;
+                }
+            }
+            return ops;
+        };
+
+        std::mt19937 rng{12345};
+        std::uniform_int_distribution<oper_name_t> op_dist{0, 11};
+        for (size_t length = 1; length <= 2 * op_seq_stack_length; ++length) {
+            for (size_t trial = 0; trial < 200; ++trial) {
+                std::vector<oper_name_t> ops(length);
+                // Bias towards operators of the same party, so that repeats and exclusions are tested
+                const oper_name_t party = op_dist(rng) % 3;
+                for (auto& op : ops) {
+                    op = ((trial % 2) == 0) ? op_dist(rng) : static_cast<oper_name_t>(4 * party + (op_dist(rng) % 4));
+                }
+
+                const OperatorSequence actual{sequence_storage_t(ops.begin(), ops.end()), context};
+                const auto expected = reference(ops);
+                if (!expected.has_value()) {
+                    EXPECT_TRUE(actual.zero()) << "Length = " << length << ", trial = " << trial;
+                } else {
+                    ASSERT_FALSE(actual.zero()) << "Length = " << length << ", trial = " << trial;
+                    EXPECT_EQ(std::vector<oper_name_t>(actual.raw().begin(), actual.raw().end()), *expected)
+                        << "Length = " << length << ", trial = " << trial;
+                }
+            }
+        }
+    }
+
+    TEST(Scenarios_Locality_LocalityContext, Simplify_BadOperator) {
+        LocalityContext context(Party::MakeList(2, 2, 2));
+        SequenceSignType sign = SequenceSignType::Positive;
+        sequence_storage_t short_seq{0, 4};
+        EXPECT_THROW(context.additional_simplification(short_seq, sign), std::range_error);
+        sequence_storage_t long_seq(size_t{20}, oper_name_t{4});
+        EXPECT_THROW(context.additional_simplification(long_seq, sign), std::range_error);
+    }
+    TEST(Scenarios_Locality_LocalityContext, Multiply_ComposedHash) {
+        LocalityContext context(Party::MakeList(3, 2, 3));
+        const auto& osg = context.dictionary().Level(2)();
+        size_t composed = 0;
+        for (const auto& lhs : osg) {
+            for (const auto& rhs : osg) {
+                sequence_storage_t raw_product{lhs.raw()};
+                raw_product.insert(raw_product.end(), rhs.begin(), rhs.end());
+                const OperatorSequence expected{std::move(raw_product), context};
+                const auto actual = lhs * rhs;
+                ASSERT_EQ(actual, expected) << "lhs = " << lhs << ", rhs = " << rhs;
+                EXPECT_EQ(actual.raw(), expected.raw()) << "lhs = " << lhs << ", rhs = " << rhs;
+                if (!lhs.empty() && !rhs.empty() && context.is_canonical_concatenation(lhs, rhs)) {
+                    ++composed;
+                }
+            }
+        }
+        EXPECT_GT(composed, 0);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,110 @@
+/**
+ * locality_moment_matrix_factory_tests.cpp
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+#include "gtest/gtest.h"
+
+#include "dictionary/dictionary.h"
+#include "dictionary/operator_sequence.h"
+#include "dictionary/operator_sequence_generator.h"
+#include "matrix/monomial_matrix.h"
+#include "matrix/operator_matrix/moment_matrix.h"
+
+#include "scenarios/locality/locality_context.h"
+#include "scenarios/locality/locality_matrix_system.h"
+#include "scenarios/locality/locality_moment_matrix_factory.h"
+
+#include "symbolic/symbol_table.h"
+
+namespace Moment::Tests {
+    using namespace Moment::Locality;
+
+    namespace {
+        void compare_to_generic(const LocalityContext& context, const size_t level,
+                                const Multithreading::MultiThreadPolicy mt_policy) {
+            LocalityMomentMatrixFactory factory{context, level};
+            auto op_matrix_ptr = factory.make_operator_matrix(mt_policy);
+            ASSERT_TRUE(op_matrix_ptr);
+            const auto& op_matrix = *op_matrix_ptr;
+
+            const auto& osg_pair = context.dictionary().Level(level);
+            const auto& col_gen = osg_pair();
+            const auto& row_gen = osg_pair.conjugate();
+            ASSERT_EQ(factory.Dimension(), col_gen.size());
+            ASSERT_EQ(op_matrix.Dimension(), col_gen.size());
+
+            for (size_t col = 0; col < col_gen.size(); ++col) {
+                for (size_t row = 0; row < row_gen.size(); ++row) {
+                    const auto expected = row_gen[row] * col_gen[col];
+                    const auto& actual = op_matrix(row, col);
+                    EXPECT_EQ(actual, expected) << "Level = " << level << ", row = " << row << ", col = " << col;
+                    EXPECT_EQ(actual.hash(), expected.hash())
+                        << "Level = " << level << ", row = " << row << ", col = " << col;
+                    EXPECT_EQ(actual.zero(), expected.zero())
+                        << "Level = " << level << ", row = " << row << ", col = " << col;
+                }
+            }
+            EXPECT_TRUE(op_matrix.is_hermitian());
+        }
+    }
+
+    TEST(Scenarios_Locality_MomentMatrixFactory, Empty) {
+        LocalityContext context{};
+        compare_to_generic(context, 0, Multithreading::MultiThreadPolicy::Never);
+        compare_to_generic(context, 1, Multithreading::MultiThreadPolicy::Never);
+    }
+
+    TEST(Scenarios_Locality_MomentMatrixFactory, OneParty) {
+        LocalityContext context{Party::MakeList(1, 2, 3)};
+        for (size_t level = 0; level <= 3; ++level) {
+            compare_to_generic(context, level, Multithreading::MultiThreadPolicy::Never);
+        }
+    }
+
+    TEST(Scenarios_Locality_MomentMatrixFactory, CHSH) {
+        LocalityContext context{Party::MakeList(2, 2, 2)};
+        for (size_t level = 0; level <= 3; ++level) {
+            compare_to_generic(context, level, Multithreading::MultiThreadPolicy::Never);
+        }
+    }
+
+    TEST(Scenarios_Locality_MomentMatrixFactory, Tripartite) {
+        LocalityContext context{Party::MakeList(3, 2, 3)};
+        for (size_t level = 0; level <= 2; ++level) {
+            compare_to_generic(context, level, Multithreading::MultiThreadPolicy::Never);
+        }
+    }
+
+    TEST(Scenarios_Locality_MomentMatrixFactory, Tripartite_Multithreaded) {
+        LocalityContext context{Party::MakeList(3, 2, 3)};
+        compare_to_generic(context, 2, Multithreading::MultiThreadPolicy::Always);
+    }
+
+    TEST(Scenarios_Locality_MomentMatrixFactory, MatrixSystem) {
+        LocalityMatrixSystem system{std::make_unique<LocalityContext>(Party::MakeList(2, 2, 3))};
+        auto [id, matrix] = system.MomentMatrix.create(2);
+        ASSERT_TRUE(matrix.is_monomial());
+        ASSERT_NE(MomentMatrix::to_operator_matrix_ptr(matrix), nullptr);
+        EXPECT_TRUE(matrix.Hermitian());
+
+        // Same symbols as generic construction
+        LocalityContext ref_context{Party::MakeList(2, 2, 3)};
+        SymbolTable ref_symbols{ref_context};
+        auto ref_matrix = MomentMatrix::create_matrix(ref_context, ref_symbols, 2);
+        ASSERT_EQ(system.Symbols().size(), ref_symbols.size());
+        for (size_t index = 0; index < ref_symbols.size(); ++index) {
+            EXPECT_EQ(system.Symbols()[index].sequence(), ref_symbols[index].sequence()) << "Index = " << index;
+        }
+
+        const auto& mono_matrix = dynamic_cast<const MonomialMatrix&>(matrix);
+        ASSERT_EQ(mono_matrix.Dimension(), ref_matrix->Dimension());
+        for (size_t col = 0; col < mono_matrix.Dimension(); ++col) {
+            for (size_t row = 0; row < mono_matrix.Dimension(); ++row) {
+                EXPECT_EQ(mono_matrix.SymbolMatrix(row, col), ref_matrix->SymbolMatrix(row, col))
+                    << "row = " << row << ", col = " << col;
+            }
+        }
+    }
+}
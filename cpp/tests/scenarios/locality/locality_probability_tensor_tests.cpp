@@ -10,7 +10,10 @@
 #include "scenarios/locality/locality_matrix_system.h"
 #include "scenarios/locality/locality_probability_tensor.h"
 
+#include "probability/explicit_value_rules.h"
+
 #include "symbolic/polynomial_factory.h"
+#include "symbolic/rules/moment_rulebook.h"
 
 #include "matrix/operator_matrix/moment_matrix.h"
 
@@ -110,6 +113,36 @@ namespace Moment::Tests {
         EXPECT_EQ(iter, range.end());
     }
 
+    TEST(Scenarios_Locality_ProbabilityTensor, CHSH_LazyStorage) {
+        LocalityMatrixSystem system{std::make_unique<LocalityContext>(Party::MakeList(2, 2, 2))};
+        system.RefreshProbabilityTensor();
+        const auto& explicit_pt = system.LocalityProbabilityTensor();
+        ASSERT_EQ(explicit_pt.StorageType, TensorStorageType::Explicit);
+
+        // No moment matrix yet, so elements are incomplete; their block is kept, but they are regenerated on read
+        LocalityProbabilityTensor lazy_pt{system, TensorStorageType::Lazy};
+        ASSERT_EQ(lazy_pt.StorageType, TensorStorageType::Lazy);
+        EXPECT_FALSE(lazy_pt.at(lazy_pt.ElementCount - 1)->hasSymbolPoly);
+        EXPECT_FALSE(lazy_pt.at(lazy_pt.ElementCount - 1)->hasSymbolPoly);
+        EXPECT_EQ(lazy_pt.CachedBlockCount(), 1);
+
+        // Once symbols exist, elements resolve, and the stale block is replaced
+        auto [id, momentMatrix] = system.MomentMatrix.create(1);
+        system.RefreshProbabilityTensor();
+        ASSERT_TRUE(explicit_pt.HasAllPolynomials());
+
+        size_t offset = 0;
+        for (const auto& lazy_elem : lazy_pt) {
+            const auto& explicit_elem = explicit_pt.Data()[offset];
+            ASSERT_TRUE(lazy_elem.hasSymbolPoly) << "offset = " << offset;
+            EXPECT_EQ(lazy_elem.cgPolynomial, explicit_elem.cgPolynomial) << "offset = " << offset;
+            EXPECT_EQ(lazy_elem.symbolPolynomial, explicit_elem.symbolPolynomial) << "offset = " << offset;
+            ++offset;
+        }
+        EXPECT_EQ(offset, explicit_pt.ElementCount);
+        EXPECT_EQ(lazy_pt.CachedBlockCount(), 1);
+    }
+
     TEST(Scenarios_Locality_ProbabilityTensor, OnePartyTwoMmt) {
         LocalityMatrixSystem system{std::make_unique<LocalityContext>(Party::MakeList(1, 2, 2))};
         const auto& context = system.localityContext;
@@ -626,4 +659,75 @@ namespace Moment::Tests {
         EXPECT_EQ(a0_given_b10_rule_poly[0], factory({Monomial{B1, -0.1}, Monomial{A0B1, 1.0}}));
         EXPECT_EQ(a0_given_b10_rule_poly[1], factory({Monomial{B1, 0.1}, Monomial{A0B1, -1.0}}));
     }
+
+    TEST(Scenarios_Locality_ProbabilityTensor, CHSH_CompiledExplicitValueRules) {
+        LocalityMatrixSystem system{std::make_unique<LocalityContext>(Party::MakeList(2, 2, 2))};
+        const auto& context = system.localityContext;
+        auto [id, momentMatrix] = system.MomentMatrix.create(1);
+        system.RefreshProbabilityTensor();
+        const auto &pt = system.LocalityProbabilityTensor();
+
+        // A0B0 measurement; second distribution makes some terms cancel
+        auto a0b0_range = pt.measurement_to_range(std::vector{PMIndex{context, 0, 0}, PMIndex{context, 1, 0}});
+        const auto compiled = pt.compile_explicit_value_rules(a0b0_range);
+        ASSERT_EQ(compiled.rule_count(), 4);
+        EXPECT_EQ(compiled.linear_map().rows(), compiled.term_count());
+        EXPECT_EQ(compiled.linear_map().cols(), 4);
+
+        const std::vector<double> batch{0.1, 0.2, 0.3, 0.4,
+                                        0.0, 0.0, 0.0, 1.0,
+                                        0.25, 0.25, 0.25, 0.25};
+        const auto coefficients = compiled.evaluate(batch);
+        ASSERT_EQ(coefficients.cols(), 3);
+        for (size_t dist = 0; dist < 3; ++dist) {
+            const std::span<const double> values{batch.data() + 4 * dist, 4};
+            const auto expected = pt.explicit_value_rules(a0b0_range, values);
+            const auto actual = compiled.rules(coefficients, dist);
+            ASSERT_EQ(actual.size(), expected.size()) << "dist = " << dist;
+            for (size_t rule = 0; rule < expected.size(); ++rule) {
+                EXPECT_TRUE(actual[rule].approximately_equals(expected[rule]))
+                    << "dist = " << dist << ", rule = " << rule << ", actual = " << actual[rule]
+                    << ", expected = " << expected[rule];
+            }
+        }
+
+        // Single distribution
+        const auto single = compiled(std::span<const double>{batch.data(), 4});
+        const auto single_expected = pt.explicit_value_rules(a0b0_range, std::span<const double>{batch.data(), 4});
+        ASSERT_EQ(single.size(), 4);
+        for (size_t rule = 0; rule < 4; ++rule) {
+            EXPECT_TRUE(single[rule].approximately_equals(single_expected[rule])) << "rule = " << rule;
+        }
+
+        // Feed to rulebook
+        MomentRulebook rulebook{system};
+        compiled.add_to_rulebook(rulebook, coefficients, 0);
+        EXPECT_EQ(rulebook.raw_rule_size(), 4);
+
+        // Bad sizes
+        EXPECT_THROW([[maybe_unused]] auto x = compiled.evaluate(std::vector<double>{0.5, 0.5}),
+                     Moment::errors::BadPTError);
+        EXPECT_THROW([[maybe_unused]] auto x = compiled.rules(coefficients, 3), Moment::errors::BadPTError);
+        EXPECT_THROW([[maybe_unused]] auto x = compiled(batch), Moment::errors::BadPTError);
+
+        // P(A0|B1)
+        auto a0_given_b10_range = pt.measurement_to_range(std::vector{PMIndex{context, 0, 0}},
+                                                         std::vector{PMOIndex{context, 1, 1, 0}});
+        auto b10_elem = pt.outcome_to_element(std::vector{PMOIndex{context, 1, 1, 0}});
+        const auto compiled_cond = pt.compile_explicit_value_rules(a0_given_b10_range, b10_elem);
+        ASSERT_EQ(compiled_cond.rule_count(), 2);
+        const std::vector<double> cond_batch{0.1, 0.9, 1.0, 0.0};
+        const auto cond_coefficients = compiled_cond.evaluate(cond_batch);
+        for (size_t dist = 0; dist < 2; ++dist) {
+            const std::span<const double> values{cond_batch.data() + 2 * dist, 2};
+            const auto expected = pt.explicit_value_rules(a0_given_b10_range, b10_elem, values);
+            const auto actual = compiled_cond.rules(cond_coefficients, dist);
+            ASSERT_EQ(actual.size(), expected.size()) << "dist = " << dist;
+            for (size_t rule = 0; rule < expected.size(); ++rule) {
+                EXPECT_TRUE(actual[rule].approximately_equals(expected[rule]))
+                    << "dist = " << dist << ", rule = " << rule << ", actual = " << actual[rule]
+                    << ", expected = " << expected[rule];
+            }
+        }
+    }
 }
\ No newline at end of file
@@ -9,7 +9,9 @@
 #include "scenarios/locality/locality_context.h"
 #include "scenarios/locality/tensor_conversion.h"
 
+#include <span>
 #include <stdexcept>
+#include <vector>
 
 namespace Moment::Tests {
     using namespace Moment::Locality;
@@ -89,6 +91,59 @@ namespace Moment::Tests {
         EXPECT_EQ(actual_fc, fc);
     }
 
+    TEST(Scenarios_Locality_TensorConversion, Tripartite) {
+        LocalityContext context(Party::MakeList(3, 1, 2));
+        TensorConvertor convertor{context};
+        ASSERT_EQ(convertor.tensor_info.ElementCount, 8);
+
+        // <ABC> = 8 abc - 4 ab - 4 ac - 4 bc + 2 a + 2 b + 2 c - 1
+        const std::vector<double> fc = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0};
+        const std::vector<double> cg = {-1.0, 2.0, 2.0, -4.0, 2.0, -4.0, -4.0, 8.0};
+
+        auto actual_cg = convertor.full_correlator_to_collins_gisin(fc);
+        EXPECT_EQ(actual_cg, cg);
 
+        auto actual_fc = convertor.collins_gisin_to_full_correlator(cg);
+        EXPECT_EQ(actual_fc, fc);
+    }
 
-}
\ No newline at end of file
+    TEST(Scenarios_Locality_TensorConversion, InPlaceBatch) {
+        LocalityContext context(Party::MakeList({3, 2}, {2, 2, 2, 2, 2}));
+        TensorConvertor convertor{context};
+        const size_t tensor_size = convertor.tensor_info.ElementCount;
+        const size_t batch_size = 5;
+
+        std::vector<double> fc_batch(tensor_size * batch_size);
+        for (size_t index = 0; index < fc_batch.size(); ++index) {
+            fc_batch[index] = static_cast<double>((index * 7) % 11) - 5.0;
+        }
+
+        for (const auto policy : {Multithreading::MultiThreadPolicy::Never, Multithreading::MultiThreadPolicy::Always}) {
+            std::vector<double> batch = fc_batch;
+            convertor.full_correlator_to_collins_gisin_in_place(batch, policy);
+            for (size_t tensor = 0; tensor < batch_size; ++tensor) {
+                const std::span<const double> fc_tensor{fc_batch.data() + (tensor * tensor_size), tensor_size};
+                const auto expected_cg = convertor.full_correlator_to_collins_gisin(fc_tensor);
+                for (size_t elem = 0; elem < tensor_size; ++elem) {
+                    EXPECT_DOUBLE_EQ(batch[(tensor * tensor_size) + elem], expected_cg[elem])
+                        << "policy = " << policy << ", tensor = " << tensor << ", elem = " << elem;
+                }
+            }
+
+            // Round trip
+            convertor.collins_gisin_to_full_correlator_in_place(batch, policy);
+            for (size_t index = 0; index < batch.size(); ++index) {
+                EXPECT_DOUBLE_EQ(batch[index], fc_batch[index]) << "policy = " << policy << ", index = " << index;
+            }
+        }
+    }
+
+    TEST(Scenarios_Locality_TensorConversion, InPlaceBadSize) {
+        LocalityContext context(Party::MakeList(2, 2, 2));
+        TensorConvertor convertor{context};
+        std::vector<double> too_short(13, 0.0);
+        EXPECT_THROW(convertor.full_correlator_to_collins_gisin_in_place(too_short), std::invalid_argument);
+        std::vector<double> empty;
+        EXPECT_THROW(convertor.collins_gisin_to_full_correlator_in_place(empty), std::invalid_argument);
+    }
+}
@@ -282,4 +282,40 @@ namespace Moment::Tests {
             }
         }
     }
-}
\ No newline at end of file
+
+    TEST(Scenarios_Symmetry_RepresentationMapper, TwoOps_SignedPermutation_MatchesKronecker) {
+        Algebraic::AlgebraicContext ac{2}; // two operators
+
+        RepresentationMapper rm1{ac};
+        RepresentationMapper rm2{ac, rm1, rm1, 2};
+        RepresentationMapper rm3{ac, rm2, rm1, 3};
+        RepresentationMapper rm4{ac, rm2, rm2, 4};
+
+        // Symmetries: swap a <-> b, and a -> -a.
+        const std::vector<SignedPermutation> elems1{
+            SignedPermutation{3},
+            SignedPermutation{{0, 2, 1}, {false, false, false}},
+            SignedPermutation{{0, 1, 2}, {false, true, false}},
+            SignedPermutation{{0, 2, 1}, {false, true, true}}
+        };
+
+        for (const auto& elem1 : elems1) {
+            const auto mat1 = elem1.to_matrix();
+            const auto kron2 = rm2.kronecker_map(mat1, mat1);
+            const auto direct2 = rm2(elem1, elem1);
+            EXPECT_TRUE(direct2.isApprox(kron2)) << direct2;
+            EXPECT_TRUE(rm2(mat1, mat1).isApprox(kron2));
+
+            const auto elem2 = SignedPermutation::from_matrix(direct2);
+            ASSERT_TRUE(elem2.has_value());
+
+            const auto kron3 = rm3.kronecker_map(kron2, mat1);
+            const auto direct3 = rm3(elem2.value(), elem1);
+            EXPECT_TRUE(direct3.isApprox(kron3)) << direct3;
+
+            const auto kron4 = rm4.kronecker_map(kron2, kron2);
+            const auto direct4 = rm4(elem2.value(), elem2.value());
+            EXPECT_TRUE(direct4.isApprox(kron4)) << direct4;
+        }
+    }
+}
@@ -0,0 +1,118 @@
+/**
+ * signed_permutation_tests.cpp
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+#include "gtest/gtest.h"
+
+#include "../sparse_utils.h"
+
+#include "scenarios/symmetrized/group.h"
+#include "scenarios/symmetrized/signed_permutation.h"
+
+#include <unordered_set>
+
+using namespace Moment::Symmetrized;
+
+namespace Moment::Tests {
+
+    TEST(Scenarios_Symmetry_SignedPermutation, Identity) {
+        SignedPermutation id{3};
+        EXPECT_TRUE(id.is_identity());
+        EXPECT_EQ(id.dimension(), 3);
+        EXPECT_TRUE(id.to_matrix().isApprox(sparse_id(3)));
+    }
+
+    TEST(Scenarios_Symmetry_SignedPermutation, FromMatrix) {
+        const auto matrix = make_sparse<double>(3, {1, 0, 0,
+                                                    0, 0, -1,
+                                                    0, 1, 0});
+        auto maybe_perm = SignedPermutation::from_matrix(matrix);
+        ASSERT_TRUE(maybe_perm.has_value());
+        const auto& perm = maybe_perm.value();
+        EXPECT_EQ(perm.image(0), 0);
+        EXPECT_FALSE(perm.negated(0));
+        EXPECT_EQ(perm.image(1), 2);
+        EXPECT_FALSE(perm.negated(1));
+        EXPECT_EQ(perm.image(2), 1);
+        EXPECT_TRUE(perm.negated(2));
+        EXPECT_TRUE(perm.to_matrix().isApprox(matrix));
+    }
+
+    TEST(Scenarios_Symmetry_SignedPermutation, FromMatrix_NotMonomial) {
+        EXPECT_FALSE(SignedPermutation::from_matrix(make_sparse<double>(2, {1, 0, 1, -1})).has_value());
+        EXPECT_FALSE(SignedPermutation::from_matrix(make_sparse<double>(2, {0.5, 0, 0, 1})).has_value());
+        EXPECT_FALSE(SignedPermutation::from_matrix(make_sparse<double>(2, {1, 0, 1, 0})).has_value());
+    }
+
+    TEST(Scenarios_Symmetry_SignedPermutation, MultiplyAndInvert) {
+        const auto matA = make_sparse<double>(3, {0, -1, 0,
+                                                  1, 0, 0,
+                                                  0, 0, 1});
+        const auto matB = make_sparse<double>(3, {1, 0, 0,
+                                                  0, 0, 1,
+                                                  0, -1, 0});
+        const auto permA = SignedPermutation::from_matrix(matA).value();
+        const auto permB = SignedPermutation::from_matrix(matB).value();
+
+        const repmat_t matAB = matA * matB;
+        EXPECT_TRUE((permA * permB).to_matrix().isApprox(matAB));
+        const repmat_t matBA = matB * matA;
+        EXPECT_TRUE((permB * permA).to_matrix().isApprox(matBA));
+
+        EXPECT_TRUE((permA * permA.inverse()).is_identity());
+        EXPECT_TRUE((permB.inverse() * permB).is_identity());
+    }
+
+    TEST(Scenarios_Symmetry_SignedPermutation, Hash) {
+        const SignedPermutation permA{{1, 0, 2}, {false, false, false}};
+        const SignedPermutation permB{{1, 0, 2}, {false, true, false}};
+        const SignedPermutation permA2{{1, 0, 2}, {false, false, false}};
+        EXPECT_EQ(permA, permA2);
+        EXPECT_EQ(permA.hash(), permA2.hash());
+        EXPECT_NE(permA, permB);
+
+        std::unordered_set<SignedPermutation> set;
+        set.insert(permA);
+        set.insert(permB);
+        set.insert(permA2);
+        EXPECT_EQ(set.size(), 2);
+    }
+
+    TEST(Scenarios_Symmetry_SignedPermutation, Dimino_MatchesMatrixOrder) {
+        // S3 x Z2 (sign flip), acting on 4D space with fixed first element
+        std::vector<SignedPermutation> generators;
+        generators.emplace_back(std::vector<size_t>{0, 2, 1, 3}, std::vector<bool>{false, false, false, false});
+        generators.emplace_back(std::vector<size_t>{0, 1, 3, 2}, std::vector<bool>{false, false, false, false});
+        generators.emplace_back(std::vector<size_t>{0, 1, 2, 3}, std::vector<bool>{false, true, true, true});
+
+        auto perm_group = Group::dimino_generation(generators);
+        ASSERT_EQ(perm_group.size(), 12);
+        EXPECT_TRUE(perm_group[0].is_identity());
+
+        std::vector<repmat_t> mat_generators;
+        for (const auto& gen : generators) {
+            mat_generators.emplace_back(gen.to_matrix());
+        }
+        auto mat_group = Group::dimino_generation(mat_generators);
+        ASSERT_EQ(mat_group.size(), 12);
+        for (size_t index = 0; index < 12; ++index) {
+            EXPECT_TRUE(mat_group[index].isApprox(perm_group[index].to_matrix())) << "index = " << index;
+        }
+    }
+
+    TEST(Scenarios_Symmetry_SignedPermutation, Dimino_S8) {
+        // Symmetric group on 8 objects, generated by transposition and cycle
+        std::vector<SignedPermutation> generators;
+        generators.emplace_back(std::vector<size_t>{1, 0, 2, 3, 4, 5, 6, 7}, std::vector<bool>(8, false));
+        generators.emplace_back(std::vector<size_t>{1, 2, 3, 4, 5, 6, 7, 0}, std::vector<bool>(8, false));
+
+        auto group = Group::dimino_generation(generators);
+        EXPECT_EQ(group.size(), 40320);
+
+        std::unordered_set<SignedPermutation> unique(group.begin(), group.end());
+        EXPECT_EQ(unique.size(), 40320);
+    }
+
+}
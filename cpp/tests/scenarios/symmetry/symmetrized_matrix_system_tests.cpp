@@ -13,6 +13,7 @@
 #include "scenarios/derived/lu_map_core_processor.h"
 
 #include "scenarios/symmetrized/group.h"
+#include "scenarios/symmetrized/orbit_symbol_table_map.h"
 #include "scenarios/symmetrized/representation.h"
 #include "scenarios/symmetrized/symmetrized_matrix_system.h"
 
@@ -462,4 +463,100 @@ namespace Moment::Tests {
 
 
     }
-}
\ No newline at end of file
+
+    TEST(Scenarios_Symmetry_MatrixSystem, Algebraic_SignFlip_Orbits) {
+        // Two variables, a & b
+        auto amsPtr = std::make_shared<Algebraic::AlgebraicMatrixSystem>(
+                Algebraic::AlgebraicContext::FromNameList({"a", "b"})
+        );
+        auto& ams = *amsPtr;
+        auto& context = ams.Context();
+        const auto& algebraic_symbols = ams.Symbols();
+        ams.generate_dictionary(2);
+
+        // Algebraic symbols
+        const auto [a, b, aa, ab, bb] = get_algebraic_symbol_ids(context, algebraic_symbols);
+
+        // Symmetry: a <-> b, and a -> -a
+        std::vector<Eigen::SparseMatrix<double>> generators;
+        generators.emplace_back(make_sparse<double>(3, {1, 0, 0,
+                                                        0, 0, 1,
+                                                        0, 1, 0}));
+        generators.emplace_back(make_sparse<double>(3, {1, 0, 0,
+                                                        0, -1, 0,
+                                                        0, 0, 1}));
+
+        auto group_elems = Group::dimino_generation(generators);
+        auto base_rep = std::make_unique<Representation>(1, std::move(group_elems));
+        auto group = std::make_unique<Group>(context, std::move(base_rep));
+        ASSERT_EQ(group->size, 8); // Dihedral group of square
+        SymmetrizedMatrixSystem sms{amsPtr, std::move(group), 2, std::make_unique<Derived::LUMapCoreProcessor>()};
+
+        const auto& map = sms.map();
+        ASSERT_EQ(map.fwd_size(), 7);
+        EXPECT_TRUE(map.is_monomial_map());
+        ASSERT_EQ(map.inv_size(), 3); // 0, 1, aa + bb.
+        EXPECT_EQ(map.inverse(2), Polynomial({Monomial{aa, 0.5}, Monomial{bb, 0.5}}));
+
+        EXPECT_EQ(map(0), Polynomial());
+        EXPECT_EQ(map(1), Polynomial::Scalar(1.0));
+        EXPECT_EQ(map(a), Polynomial());
+        EXPECT_EQ(map(b), Polynomial());
+        EXPECT_EQ(map(aa), Polynomial({Monomial{2, 1.0}}));
+        EXPECT_EQ(map(ab), Polynomial());
+        EXPECT_EQ(map(bb), Polynomial({Monomial{2, 1.0}}));
+    }
+
+    TEST(Scenarios_Symmetry_MatrixSystem, Algebraic_Z3_OrbitMatchesLU) {
+        Algebraic::AlgebraicMatrixSystem ams{Algebraic::AlgebraicContext::FromNameList({"a", "b", "c"})};
+        auto& context = ams.Context();
+        auto& origin_symbols = ams.Symbols();
+        ams.generate_dictionary(2);
+
+        // Cyclic symmetry: a -> b -> c -> a
+        std::vector<Eigen::SparseMatrix<double>> generators;
+        generators.emplace_back(make_sparse<double>(4, {1, 0, 0, 0,
+                                                        0, 0, 0, 1,
+                                                        0, 1, 0, 0,
+                                                        0, 0, 1, 0}));
+        auto group_elems = Group::dimino_generation(generators);
+        auto base_rep = std::make_unique<Representation>(1, std::move(group_elems));
+        Group group{context, std::move(base_rep)};
+        ASSERT_EQ(group.size, 3);
+        const auto& rep2 = group.create_representation(2);
+        origin_symbols.OSGIndex.update_if_necessary(2);
+
+        std::vector<SignedPermutation> perms;
+        for (const auto& elem : rep2) {
+            auto maybe_perm = SignedPermutation::from_matrix(elem);
+            ASSERT_TRUE(maybe_perm.has_value());
+            perms.emplace_back(maybe_perm.value());
+        }
+
+        SymbolTable orbit_target{context};
+        OrbitSymbolTableMap orbit_map{origin_symbols, orbit_target, perms};
+
+        SymbolTable lu_target{context};
+        const repmat_t average = rep2.sum_of() / static_cast<double>(group.size);
+        Derived::LUMapCoreProcessor processor;
+        Derived::SymbolTableMap lu_map{origin_symbols, lu_target, processor, average};
+
+        ASSERT_EQ(orbit_map.fwd_size(), lu_map.fwd_size());
+        ASSERT_EQ(orbit_map.inv_size(), lu_map.inv_size());
+        ASSERT_EQ(orbit_target.size(), lu_target.size());
+
+        // Orbit symbols might be enumerated in a different order; compare via inverse maps.
+        for (size_t id = 0; id < orbit_map.fwd_size(); ++id) {
+            const auto& orbit_image = orbit_map(static_cast<symbol_name_t>(id));
+            const auto& lu_image = lu_map(static_cast<symbol_name_t>(id));
+            ASSERT_EQ(orbit_image.size(), lu_image.size()) << "id = " << id;
+            if (orbit_image.empty() || orbit_image[0].id <= 1) {
+                EXPECT_EQ(orbit_image, lu_image) << "id = " << id;
+                continue;
+            }
+            ASSERT_EQ(orbit_image.size(), 1);
+            EXPECT_EQ(orbit_image[0].factor, lu_image[0].factor) << "id = " << id;
+            EXPECT_EQ(orbit_map.inverse(orbit_image[0].id), lu_map.inverse(lu_image[0].id)) << "id = " << id;
+        }
+    }
+}
@@ -7,6 +7,9 @@
 #include "gtest/gtest.h"
 #include "tensor/auto_storage_tensor.h"
 
+#include <atomic>
+#include <chrono>
+
 namespace Moment::Tests {
 
     class BoringTensor : public AutoStorageTensor<int, 5> {
@@ -35,6 +38,48 @@ namespace Moment::Tests {
         }
     };
 
+    /** Tensor whose elements take a while to generate; odd elements can be flagged as not cacheable. */
+    class SlowTensor : public AutoStorageTensor<int, 5> {
+    public:
+        const bool cache_odd;
+
+        explicit SlowTensor(std::vector<size_t>&& dims, TensorStorageType tst = TensorStorageType::Automatic,
+                            bool cache_odd = true)
+            : AutoStorageTensor<int, 5>(std::move(dims), tst), cache_odd{cache_odd} { }
+
+    private:
+        [[nodiscard]] int make_element_no_checks(AutoStorageIndexView index) const override {
+            const auto until = std::chrono::steady_clock::now() + std::chrono::microseconds(2);
+            while (std::chrono::steady_clock::now() < until) { }
+            return static_cast<int>(this->index_to_offset_no_checks(index));
+        }
+
+        [[nodiscard]] bool can_cache_element(const int& element) const noexcept override {
+            return this->cache_odd || ((element % 2) == 0);
+        }
+    };
+
+    /** Tensor counting calls to its generator; elements below resolved_count are final, others are -1. */
+    class CountingTensor : public AutoStorageTensor<int, 5> {
+    public:
+        std::atomic<size_t> resolved_count{0};
+        mutable std::atomic<size_t> generated{0};
+
+        explicit CountingTensor(std::vector<size_t>&& dims, TensorStorageType tst = TensorStorageType::Lazy)
+            : AutoStorageTensor<int, 5>(std::move(dims), tst) { }
+
+    private:
+        [[nodiscard]] int make_element_no_checks(AutoStorageIndexView index) const override {
+            ++this->generated;
+            const size_t offset = this->index_to_offset_no_checks(index);
+            return (offset < this->resolved_count) ? static_cast<int>(offset) : -1;
+        }
+
+        [[nodiscard]] bool can_cache_element(const int& element) const noexcept override {
+            return element >= 0;
+        }
+    };
+
     TEST(Tensor_AutoStorage, AutoStorageDeduction) {
         BoringTensor tensor31({3, 1});
         ASSERT_EQ(tensor31.StorageType, TensorStorageType::Explicit);
@@ -319,4 +364,150 @@ namespace Moment::Tests {
     }
 
 
+
+    TEST(Tensor_AutoStorage, Lazy_Elements) {
+        BoringTensor tensor({40, 60}, TensorStorageType::Lazy);
+        ASSERT_EQ(tensor.StorageType, TensorStorageType::Lazy);
+        EXPECT_TRUE(tensor.CachingElements());
+        EXPECT_EQ(tensor.CachedBlockCount(), 0);
+        EXPECT_THROW([[maybe_unused]] const auto& data = tensor.Data(), errors::bad_tensor);
+
+        EXPECT_EQ(tensor(AutoStorageIndex{3, 2}), 83);
+        EXPECT_EQ(tensor.CachedBlockCount(), 1);
+        EXPECT_EQ(tensor.at(2000), 2000);
+        EXPECT_EQ(tensor.CachedBlockCount(), 2);
+
+        size_t expected = 0;
+        for (const auto& elem : tensor) {
+            EXPECT_EQ(elem, expected);
+            ++expected;
+        }
+        EXPECT_EQ(expected, 2400);
+        EXPECT_EQ(tensor.CachedBlockCount(), 3);
+
+        auto range = tensor.Splice(AutoStorageIndex{0, 30}, AutoStorageIndex{40, 31});
+        expected = 1200;
+        for (const auto& elem : range) {
+            EXPECT_EQ(elem, expected);
+            ++expected;
+        }
+        EXPECT_EQ(expected, 1240);
+    }
+
+    TEST(Tensor_AutoStorage, Lazy_BoundedCache) {
+        const size_t max_blocks = lazy_tensor_cache_element_limit / lazy_tensor_block_size;
+        BoringTensor tensor({lazy_tensor_block_size, max_blocks + 3}, TensorStorageType::Lazy);
+        ASSERT_EQ(tensor.StorageType, TensorStorageType::Lazy);
+
+        size_t expected = 0;
+        for (const auto& elem : tensor) {
+            ASSERT_EQ(elem, expected);
+            ++expected;
+        }
+        EXPECT_EQ(tensor.CachedBlockCount(), max_blocks);
+
+        // Evicted block is regenerated
+        EXPECT_EQ(tensor.at(0), 0);
+        EXPECT_EQ(tensor.CachedBlockCount(), max_blocks);
+    }
+
+    TEST(Tensor_AutoStorage, Lazy_UncacheableBlock) {
+        SlowTensor tensor({lazy_tensor_block_size, 2}, TensorStorageType::Lazy, false);
+        ASSERT_EQ(tensor.StorageType, TensorStorageType::Lazy);
+
+        // Blocks are kept, but their odd elements are generated afresh on every read
+        EXPECT_EQ(tensor.at(0), 0);
+        EXPECT_EQ(tensor.at(lazy_tensor_block_size + 1), lazy_tensor_block_size + 1);
+        EXPECT_EQ(tensor.at(lazy_tensor_block_size + 1), lazy_tensor_block_size + 1);
+        EXPECT_EQ(tensor.CachedBlockCount(), 2);
+    }
+
+    TEST(Tensor_AutoStorage, Lazy_PartiallyResolvedBlock) {
+        CountingTensor tensor({lazy_tensor_block_size, 2});
+        ASSERT_EQ(tensor.StorageType, TensorStorageType::Lazy);
+        tensor.resolved_count = 10;
+
+        // First read generates whole block
+        EXPECT_EQ(tensor.at(3), 3);
+        EXPECT_EQ(tensor.generated, lazy_tensor_block_size);
+        EXPECT_EQ(tensor.CachedBlockCount(), 1);
+
+        // Final elements are read from cache
+        EXPECT_EQ(tensor.at(4), 4);
+        EXPECT_EQ(tensor.generated, lazy_tensor_block_size);
+
+        // Each read of an element that is not final generates only that element
+        for (size_t read = 1; read <= 3; ++read) {
+            EXPECT_EQ(tensor.at(20), -1);
+            EXPECT_EQ(tensor.generated, lazy_tensor_block_size + read);
+        }
+        EXPECT_EQ(tensor(AutoStorageIndex{21, 0}), -1);
+        EXPECT_EQ(tensor.generated, lazy_tensor_block_size + 4);
+        EXPECT_EQ(tensor.CachedBlockCount(), 1);
+
+        // Once element resolves, it is seen, and the stale block is dropped...
+        tensor.resolved_count = 30;
+        tensor.generated = 0;
+        EXPECT_EQ(tensor.at(20), 20);
+        EXPECT_EQ(tensor.generated, 1);
+        EXPECT_EQ(tensor.CachedBlockCount(), 0);
+
+        // ...to be regenerated once on next read
+        EXPECT_EQ(tensor.at(25), 25);
+        EXPECT_EQ(tensor.generated, 1 + lazy_tensor_block_size);
+        EXPECT_EQ(tensor.CachedBlockCount(), 1);
+
+        // Iteration also generates only the elements that are not final
+        tensor.generated = 0;
+        size_t offset = 0;
+        for (const auto& elem : tensor.Splice(AutoStorageIndex{0, 0}, AutoStorageIndex{lazy_tensor_block_size, 1})) {
+            EXPECT_EQ(elem, (offset < 30) ? static_cast<int>(offset) : -1) << "offset = " << offset;
+            ++offset;
+        }
+        EXPECT_EQ(offset, lazy_tensor_block_size);
+        EXPECT_EQ(tensor.generated, lazy_tensor_block_size - 30);
+    }
+
+    TEST(Tensor_AutoStorage, Automatic_CheapElementsNotCached) {
+        BoringTensor tensor({40, 60});
+        ASSERT_EQ(tensor.StorageType, TensorStorageType::Virtual);
+        EXPECT_FALSE(tensor.CachingElements());
+        EXPECT_EQ(tensor.ElementCost(), 0);
+
+        EXPECT_EQ(tensor(AutoStorageIndex{3, 2}), 83);
+        EXPECT_GT(tensor.ElementCost(), 0);
+        if (tensor.ElementCost() < lazy_tensor_minimum_element_cost_ns) {
+            EXPECT_FALSE(tensor.CachingElements());
+            EXPECT_EQ(tensor.CachedBlockCount(), 0);
+        }
+    }
+
+    TEST(Tensor_AutoStorage, Automatic_ExpensiveElementsCached) {
+        SlowTensor tensor({lazy_tensor_block_size, 4});
+        ASSERT_EQ(tensor.StorageType, TensorStorageType::Virtual);
+        EXPECT_FALSE(tensor.CachingElements());
+
+        EXPECT_EQ(tensor.at(5), 5);
+        EXPECT_GE(tensor.ElementCost(), lazy_tensor_minimum_element_cost_ns);
+        EXPECT_TRUE(tensor.CachingElements());
+
+        // Remaining blocks are generated (in parallel, if deemed worthwhile) and cached.
+        size_t expected = 0;
+        for (const auto& elem : tensor) {
+            ASSERT_EQ(elem, expected);
+            ++expected;
+        }
+        EXPECT_EQ(expected, 4 * lazy_tensor_block_size);
+        EXPECT_EQ(tensor.CachedBlockCount(), 4);
+    }
+
+    TEST(Tensor_AutoStorage, Virtual_RequestedNeverCached) {
+        SlowTensor tensor({lazy_tensor_block_size, 2}, TensorStorageType::Virtual);
+        ASSERT_EQ(tensor.StorageType, TensorStorageType::Virtual);
+        EXPECT_EQ(tensor.at(5), 5);
+        EXPECT_FALSE(tensor.CachingElements());
+        EXPECT_EQ(tensor.CachedBlockCount(), 0);
+        EXPECT_EQ(tensor.ElementCost(), 0);
+    }
+
 }
@@ -0,0 +1,126 @@
+/**
+ * hashed_index_tests.cpp
+ *
+ * @copyright Copyright (c) 2024 Austrian Academy of Sciences
+ * @author Andrew J. P. Garner
+ */
+#include "gtest/gtest.h"
+
+#include "utilities/hashed_index.h"
+
+#include <thread>
+
+namespace Moment::Tests {
+
+    TEST(Utilities_HashedIndex, Empty) {
+        HashedIndex<int, size_t> index{};
+        EXPECT_TRUE(index.empty());
+        EXPECT_EQ(index.size(), 0);
+        EXPECT_FALSE(index.find(std::vector<int>{}).has_value());
+        EXPECT_FALSE(index.find(std::vector<int>{1, 2}).has_value());
+    }
+
+    TEST(Utilities_HashedIndex, AddAndFind) {
+        HashedIndex<int, size_t> index{};
+        index.add(std::vector<int>{}, 1);
+        index.add(std::vector{3}, 10);
+        index.add(std::vector{3, 4}, 20);
+        index.add(std::vector{4, 3}, 30);
+        EXPECT_EQ(index.size(), 4);
+
+        auto find_empty = index.find(std::vector<int>{});
+        ASSERT_TRUE(find_empty.has_value());
+        EXPECT_EQ(find_empty.value(), 1);
+
+        auto find_3 = index.find(std::vector{3});
+        ASSERT_TRUE(find_3.has_value());
+        EXPECT_EQ(find_3.value(), 10);
+
+        auto find_34 = index.find(std::vector{3, 4});
+        ASSERT_TRUE(find_34.has_value());
+        EXPECT_EQ(find_34.value(), 20);
+
+        auto find_43 = index.find(std::vector{4, 3});
+        ASSERT_TRUE(find_43.has_value());
+        EXPECT_EQ(find_43.value(), 30);
+
+        EXPECT_FALSE(index.find(std::vector{4}).has_value());
+        EXPECT_FALSE(index.find(std::vector{3, 4, 5}).has_value());
+    }
+
+    TEST(Utilities_HashedIndex, AddIfNew) {
+        HashedIndex<int, size_t> index{};
+        auto [val_a, new_a] = index.add_if_new(std::vector{1, 2}, 5);
+        EXPECT_EQ(val_a, 5);
+        EXPECT_TRUE(new_a);
+
+        auto [val_b, new_b] = index.add_if_new(std::vector{1, 2}, 7);
+        EXPECT_EQ(val_b, 5);
+        EXPECT_FALSE(new_b);
+        EXPECT_EQ(index.size(), 1);
+    }
+
+    TEST(Utilities_HashedIndex, Grow) {
+        HashedIndex<int, size_t> index{8};
+        for (int i = 0; i < 1000; ++i) {
+            index.add(std::vector{i / 10, i % 10}, static_cast<size_t>(i));
+        }
+        ASSERT_EQ(index.size(), 1000);
+        for (int i = 0; i < 1000; ++i) {
+            auto val = index.find(std::vector{i / 10, i % 10});
+            ASSERT_TRUE(val.has_value()) << i;
+            EXPECT_EQ(val.value(), i);
+        }
+
+        // Iteration is in order of insertion
+        size_t expected = 0;
+        for (const auto& entry_ptr : index) {
+            EXPECT_EQ(entry_ptr->value, expected);
+            ++expected;
+        }
+        EXPECT_EQ(expected, 1000);
+    }
+
+    TEST(Utilities_HashedIndex, MergeIn) {
+        HashedIndex<int, size_t> indexA{};
+        indexA.add(std::vector{1}, 1);
+        indexA.add(std::vector{1, 2}, 2);
+
+        HashedIndex<int, size_t> indexB{};
+        indexB.add(std::vector{1, 2}, 20);
+        indexB.add(std::vector{2, 3}, 30);
+
+        indexA.merge_in(std::move(indexB));
+        EXPECT_EQ(indexA.size(), 3);
+        EXPECT_EQ(indexA.find(std::vector{1}).value_or(0), 1);
+        EXPECT_EQ(indexA.find(std::vector{1, 2}).value_or(0), 2);
+        EXPECT_EQ(indexA.find(std::vector{2, 3}).value_or(0), 30);
+    }
+
+    TEST(Utilities_HashedIndex, ConcurrentRead) {
+        HashedIndex<int, size_t> index{8};
+        constexpr int max_val = 5000;
+        std::atomic<bool> failed = false;
+
+        std::thread reader{[&]() {
+            for (int i = 0; i < max_val; ++i) {
+                // Spin until written
+                std::optional<size_t> val;
+                do {
+                    val = index.find(std::vector{i, i + 1});
+                } while (!val.has_value());
+                if (val.value() != static_cast<size_t>(i)) {
+                    failed = true;
+                }
+            }
+        }};
+
+        for (int i = 0; i < max_val; ++i) {
+            index.add(std::vector{i, i + 1}, static_cast<size_t>(i));
+        }
+        reader.join();
+        EXPECT_FALSE(failed);
+        EXPECT_EQ(index.size(), max_val);
+    }
+
+}
@@ -142,7 +142,7 @@ namespace Moment::Tests {
 
         sequence_storage_t str{0,4,2};
 
-        const std::set<uint64_t> reference{
+        const std::set<hash_t> reference{
                 hasher.hash(sequence_storage_t{0}),
                 hasher.hash(sequence_storage_t{4}),
                 hasher.hash(sequence_storage_t{2}),
@@ -152,9 +152,9 @@ namespace Moment::Tests {
         };
         ASSERT_EQ(reference.size(), 6);
 
-        std::set<uint64_t> test;
+        std::set<hash_t> test;
         for (auto hash : SubstringHashRange{str, hasher.radix}) {
-            ASSERT_TRUE(reference.contains(hash)) << "hash = " << hash;
+            ASSERT_TRUE(reference.contains(hash)) << "hash = " << hash_to_string(hash);
             test.insert(hash);
         }
         ASSERT_EQ(test.size(), 6);